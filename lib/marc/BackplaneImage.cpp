@@ -0,0 +1,165 @@
+/**
+ * @file BackplaneImage.cpp
+ *
+ * Copyright (C) 2026  Ossama Othman
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * @author Ossama Othman
+ */
+
+#include "BackplaneImage.h"
+#include "BodyData.h"
+#include "Constants.h"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+
+namespace
+{
+    MaRC::BackplaneImage::plane_list
+    validate_planes(MaRC::BackplaneImage::plane_list planes)
+    {
+        if (planes.empty())
+            throw std::invalid_argument("No backplanes specified.");
+
+        return planes;
+    }
+
+    bool
+    is_photometric(MaRC::BackplaneImage::plane const & p)
+    {
+        using backplane = MaRC::BackplaneImage::backplane;
+
+        return
+            p.type == backplane::mu
+            || p.type == backplane::mu0
+            || p.type == backplane::cos_phase;
+    }
+}
+
+MaRC::BackplaneImage::BackplaneImage(std::shared_ptr<BodyData> body,
+                                     double sub_observ_lat,
+                                     double sub_observ_lon,
+                                     double sub_solar_lat,
+                                     double sub_solar_lon,
+                                     double range,
+                                     plane_list planes)
+    : SourceImage()
+    , body_(std::move(body))
+    , sub_observ_lat_(sub_observ_lat * C::degree) // Radians
+    , sub_observ_lon_(sub_observ_lon * C::degree) // Radians
+    , sub_solar_lat_(sub_solar_lat * C::degree)   // Radians
+    , sub_solar_lon_(sub_solar_lon * C::degree)   // Radians
+    , range_(range)
+    , planes_(validate_planes(std::move(planes)))
+    , photometric_(std::any_of(this->planes_.cbegin(),
+                               this->planes_.cend(),
+                               is_photometric))
+    , longitudes_(1, 0)
+{
+}
+
+bool
+MaRC::BackplaneImage::read_data(double lat,
+                                double lon,
+                                double & data) const
+{
+    auto const & p = this->planes_.front();
+
+    cosines c{};
+
+    if (is_photometric(p))
+        this->compute_cosines(lat, lon, c);
+
+    return this->compute(p, lat, lon, c, data);
+}
+
+bool
+MaRC::BackplaneImage::read_bands(double lat,
+                                 double lon,
+                                 double * data) const
+{
+    // Terms shared by the photometric bands are only computed once.
+    cosines c{};
+
+    if (this->photometric_)
+        this->compute_cosines(lat, lon, c);
+
+    bool found = false;
+
+    for (auto const & p : this->planes_) {
+        if (this->compute(p, lat, lon, c, *data))
+            found = true;
+        else
+            *data = std::numeric_limits<double>::quiet_NaN();
+
+        ++data;
+    }
+
+    return found;
+}
+
+void
+MaRC::BackplaneImage::compute_cosines(double lat,
+                                      double lon,
+                                      cosines & c) const
+{
+    this->body_->photometric_cosines(this->sub_observ_lat_,
+                                     this->sub_observ_lon_,
+                                     this->sub_solar_lat_,
+                                     this->sub_solar_lon_,
+                                     lat,
+                                     lon,
+                                     this->range_,
+                                     c.mu,
+                                     c.mu0,
+                                     c.cos_phase);
+}
+
+bool
+MaRC::BackplaneImage::compute(plane const & p,
+                              double lat,
+                              double lon,
+                              cosines const & c,
+                              double & data) const
+{
+    switch (p.type) {
+    case backplane::latitude:
+    case backplane::graphic_latitude:
+        // Valid latitude range is [-90, 90] degrees.
+        if (lat < -C::pi_2 || lat > C::pi_2)
+            return false;
+
+        data = (p.type == backplane::graphic_latitude
+                ? this->body_->graphic_latitude(lat)
+                : lat) / C::degree;
+        break;
+
+    case backplane::longitude:
+        if (!this->longitudes_.read_data(lat, lon, data))
+            return false;
+        break;
+
+    case backplane::mu:
+        data = c.mu;
+        break;
+
+    case backplane::mu0:
+        data = c.mu0;
+        break;
+
+    case backplane::cos_phase:
+        data = c.cos_phase;
+        break;
+    }
+
+    data = data * p.scale + p.offset;
+
+    auto const & minimum = p.minmax.minimum();
+    auto const & maximum = p.minmax.maximum();
+
+    return (!minimum || data >= *minimum) && (!maximum || data <= *maximum);
+}
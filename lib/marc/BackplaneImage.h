@@ -0,0 +1,234 @@
+//   -*- C++ -*-
+/**
+ * @file BackplaneImage.h
+ *
+ * Copyright (C) 2026  Ossama Othman
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * @author Ossama Othman
+ */
+
+#ifndef MARC_BACKPLANE_IMAGE_H
+#define MARC_BACKPLANE_IMAGE_H
+
+#include <marc/SourceImage.h>
+#include <marc/LongitudeImage.h>
+#include <marc/extrema.h>
+#include <marc/Export.h>
+
+#include <memory>
+#include <vector>
+
+
+namespace MaRC
+{
+    class BodyData;
+
+    /**
+     * @class BackplaneImage BackplaneImage.h <marc/BackplaneImage.h>
+     *
+     * @brief Multi-band virtual image of geometric backplanes.
+     *
+     * This image computes several geometric quantities, such as
+     * latitude, longitude, &mu;, &mu;<SUB>0</SUB> and cos(&phi;), at
+     * each point on the body being mapped, one band per quantity.
+     * Unlike mapping the equivalent @c LatitudeImage,
+     * @c LongitudeImage, @c MuImage, @c Mu0Image and
+     * @c CosPhaseImage one at a time, the map is only traversed once
+     * and the terms shared by the photometric quantities are only
+     * computed once per point.
+     *
+     * @note As is the case for @c VirtualImage, the computed data is
+     *       scaled and offset with the values given for each band.
+     *       Unlike a single @c VirtualImage, the range of valid data
+     *       may also differ from band to band.
+     */
+    class MARC_API BackplaneImage final : public SourceImage
+    {
+    public:
+
+        /// Geometric quantities that may be computed.
+        enum class backplane
+        {
+            /// Planetocentric latitude in degrees.
+            latitude,
+
+            /// Planetographic latitude in degrees.
+            graphic_latitude,
+
+            /// Longitude in degrees.
+            longitude,
+
+            /// Cosine of the emission angle, &mu;.
+            mu,
+
+            /// Cosine of the incidence angle, &mu;<SUB>0</SUB>.
+            mu0,
+
+            /// Cosine of the phase angle, cos(&phi;).
+            cos_phase
+        };
+
+        /// Band configuration.
+        struct plane
+        {
+            /// Quantity computed in the band.
+            backplane type;
+
+            /// Linear scaling value by which the quantity will be
+            /// multiplied.
+            double scale = 1;
+
+            /// Offset value to be added to the quantity after the
+            /// scaling factor has been applied.
+            double offset = 0;
+
+            /// Minimum and maximum allowed scaled values.
+            /**
+             * Scaled values outside of this range are treated as
+             * missing data in the band.  Extrema that are not set
+             * impose no limit.
+             */
+            extrema<double> minmax = {};
+        };
+
+        /// List of band configurations.
+        using plane_list = std::vector<plane>;
+
+        /// Constructor
+        /**
+         * @param[in] body           Object representing the body
+         *                           being mapped.
+         * @param[in] sub_observ_lat Planetocentric sub-observer
+         *                           latitude in degrees.
+         * @param[in] sub_observ_lon Sub-observer longitude in
+         *                           degrees.
+         * @param[in] sub_solar_lat  Planetocentric sub-solar latitude
+         *                           in degrees.
+         * @param[in] sub_solar_lon  Sub-solar longitude in degrees.
+         * @param[in] range          Observer to target center
+         *                           distance.
+         * @param[in] planes         Quantities to compute, in band
+         *                           order.
+         *
+         * @throw std::invalid_argument No planes were given.
+         */
+        BackplaneImage(std::shared_ptr<BodyData> body,
+                       double sub_observ_lat,
+                       double sub_observ_lon,
+                       double sub_solar_lat,
+                       double sub_solar_lon,
+                       double range,
+                       plane_list planes);
+
+        // Disallow copying.
+        BackplaneImage(BackplaneImage const &) = delete;
+        BackplaneImage & operator=(BackplaneImage const &) = delete;
+
+        // Disallow moving.
+        BackplaneImage(BackplaneImage &&) = delete;
+        BackplaneImage & operator=(BackplaneImage &&) = delete;
+
+        /// Destructor.
+        ~BackplaneImage() override = default;
+
+        /**
+         * @brief Retrieve data from the first band.
+         *
+         * @see MaRC::SourceImage::read_data().
+         */
+        bool read_data(double lat,
+                       double lon,
+                       double & data) const override;
+
+        /// Number of computed quantities.
+        std::size_t bands() const override
+        {
+            return this->planes_.size();
+        }
+
+        /**
+         * @brief Compute all configured quantities.
+         *
+         * @see MaRC::SourceImage::read_bands().
+         */
+        bool read_bands(double lat,
+                        double lon,
+                        double * data) const override;
+
+        /// Get the band configurations.
+        plane_list const & planes() const { return this->planes_; }
+
+    private:
+
+        /// Photometric quantities shared by all bands at a point.
+        struct cosines
+        {
+            double mu;
+            double mu0;
+            double cos_phase;
+        };
+
+        /**
+         * @brief Compute the photometric quantities at a point.
+         *
+         * @param[in]  lat Planetocentric latitude in radians.
+         * @param[in]  lon Longitude in radians.
+         * @param[out] c   Photometric quantities at the point.
+         */
+        void compute_cosines(double lat, double lon, cosines & c) const;
+
+        /**
+         * @brief Compute the scaled quantity for a given band.
+         *
+         * @param[in]  p    Band configuration.
+         * @param[in]  lat  Planetocentric latitude in radians.
+         * @param[in]  lon  Longitude in radians.
+         * @param[in]  c    Photometric quantities at the point.
+         * @param[out] data Scaled quantity.
+         *
+         * @retval true  Quantity computed.
+         * @retval false Quantity is not defined at the point.
+         */
+        bool compute(plane const & p,
+                     double lat,
+                     double lon,
+                     cosines const & c,
+                     double & data) const;
+
+    private:
+
+        /// Object representing the body being mapped.
+        std::shared_ptr<BodyData> const body_;
+
+        /// Planetocentric sub-observer latitude in radians.
+        double const sub_observ_lat_;
+
+        /// Sub-observer longitude in radians.
+        double const sub_observ_lon_;
+
+        /// Planetocentric sub-solar latitude in radians.
+        double const sub_solar_lat_;
+
+        /// Sub-solar longitude in radians.
+        double const sub_solar_lon_;
+
+        /// Observer to target center distance.
+        double const range_;
+
+        /// Quantities to compute, in band order.
+        plane_list const planes_;
+
+        /// Whether &mu;, &mu;<SUB>0</SUB> or cos(&phi;) is needed.
+        bool const photometric_;
+
+        /// Unscaled longitude image used for the longitude bands.
+        LongitudeImage const longitudes_;
+
+    };
+
+} // End MaRC namespace
+
+
+#endif  /* MARC_BACKPLANE_IMAGE_H */
@@ -1,7 +1,7 @@
 /**
  * @file BilinearInterpolation.cpp
  *
- * Copyright (C) 2003-2004, 2017  Ossama Othman
+ * Copyright (C) 2003-2004, 2017, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -89,3 +89,32 @@ MaRC::BilinearInterpolation::interpolate(double const * data,
 
     return false;
 }
+
+bool
+MaRC::BilinearInterpolation::weights(double x,
+                                     double z,
+                                     weights_type & weights) const
+{
+    auto const l = static_cast<std::size_t>(x); // floor(x) for x >= 0
+    auto const r = l + 1;                       // ceil (x) for x >= 0
+    auto const b = static_cast<std::size_t>(z); // floor(z) for z >= 0
+    auto const t = b + 1;                       // ceil (z) for z >= 0
+
+    if (   l < this->left_ || r >= this->right_
+        || b < this->top_  || t >= this->bottom_)
+        return false;
+
+    /*
+      Expand the four terms averaged by interpolate() when all of
+      the pixels are valid into the weight of each pixel.
+    */
+    double const dx = x - l;
+    double const dz = z - b;
+
+    weights = { (2 - dx - 2 * dz) / 4,  // [l][b]
+                (1 + dx + dz) / 4,      // [r][b]
+                (1 - dx + dz) / 4,      // [l][t]
+                dx / 4 };               // [r][t]
+
+    return true;
+}
@@ -2,7 +2,7 @@
 /**
  * @file BilinearInterpolation.h
  *
- * Copyright (C) 2004-2005, 2017  Ossama Othman
+ * Copyright (C) 2004-2005, 2017, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -73,6 +73,15 @@ namespace MaRC
                        double z,
                        double & datum) const override;
 
+      /// Get the bilinear interpolation weights over a 2x2 area of
+      /// pixels on the given pixel.
+      /**
+       * @see @c InterpolationStrategy::weights()
+       */
+      bool weights(double x,
+                   double z,
+                   weights_type & weights) const override;
+
   private:
 
       /// Number of samples in image.
@@ -2,7 +2,7 @@
 /**
  * @file BodyData.h
  *
- * Copyright (C) 1999, 2003-2004, 2017-2018  Ossama Othman
+ * Copyright (C) 1999, 2003-2004, 2017-2018, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -161,6 +161,59 @@ namespace MaRC
                                  double lon,
                                  double range) const = 0;
 
+        /**
+         * @brief Compute &mu;, &mu;<SUB>0</SUB> and @c cos(&phi;) at
+         *        once.
+         *
+         * Compute the cosines of the emission, incidence and phase
+         * angles at a given point on the body.  Implementations
+         * should override this method to share the terms common to
+         * all three quantities, such as the radius and planetographic
+         * latitude at the point.  The default implementation simply
+         * calls @c mu(), @c mu0() and @c cos_phase().
+         *
+         * @param[in]  sub_observ_lat Planetocentric sub-observation
+         *                            latitude.
+         * @param[in]  sub_observ_lon Sub-observation longitude.
+         * @param[in]  sub_solar_lat  Planetocentric sub-solar
+         *                            latitude.
+         * @param[in]  sub_solar_lon  Sub-solar longitude.
+         * @param[in]  lat            Planetocentric latitude.
+         * @param[in]  lon            Longitude.
+         * @param[in]  range          Observer range to
+         *                            sub-observation point.
+         * @param[out] mu             Cosine of emission angle.
+         * @param[out] mu0            Cosine of incidence angle.
+         * @param[out] cos_phase      Cosine of phase angle.
+         */
+        virtual void photometric_cosines(double sub_observ_lat,
+                                         double sub_observ_lon,
+                                         double sub_solar_lat,
+                                         double sub_solar_lon,
+                                         double lat,
+                                         double lon,
+                                         double range,
+                                         double & mu,
+                                         double & mu0,
+                                         double & cos_phase) const
+        {
+            mu = this->mu(sub_observ_lat,
+                          sub_observ_lon,
+                          lat,
+                          lon,
+                          range);
+
+            mu0 = this->mu0(sub_solar_lat, sub_solar_lon, lat, lon);
+
+            cos_phase = this->cos_phase(sub_observ_lat,
+                                        sub_observ_lon,
+                                        sub_solar_lat,
+                                        sub_solar_lon,
+                                        lat,
+                                        lon,
+                                        range);
+        }
+
     private:
 
         /**
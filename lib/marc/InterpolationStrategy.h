@@ -2,7 +2,7 @@
 /**
  * @file InterpolationStrategy.h
  *
- * Copyright (C) 2004-2005, 2017  Ossama Othman
+ * Copyright (C) 2004-2005, 2017, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -14,6 +14,8 @@
 
 #include <marc/Export.h>
 
+#include <array>
+
 
 namespace MaRC
 {
@@ -30,6 +32,17 @@ namespace MaRC
     {
     public:
 
+        /**
+         * @brief Interpolation weights for a 2x2 block of pixels.
+         *
+         * The weights correspond to the pixels at (@c l, @c b),
+         * (@c l + 1, @c b), (@c l, @c b + 1) and
+         * (@c l + 1, @c b + 1), in that order, where @c l and @c b
+         * are the sample and line containing the interpolated
+         * pixel coordinate, i.e. @c floor(x) and @c floor(z).
+         */
+        using weights_type = std::array<double, 4>;
+
         /// Constructor.
         InterpolationStrategy() = default;
 
@@ -64,6 +77,37 @@ namespace MaRC
                                  double z,
                                  double & datum) const = 0;
 
+        /**
+         * @brief Get the interpolation weights at the given pixel.
+         *
+         * Obtain the weights that @c interpolate() applies to the
+         * 2x2 block of pixels surrounding the given pixel coordinate
+         * when all of them contain valid data.  The interpolated
+         * datum is the weighted sum of those pixels.  This allows
+         * the interpolation to be recorded once, and then applied to
+         * different data with the same geometry.
+         *
+         * The default implementation supports no weights, as is the
+         * case for interpolation techniques that are not linear in
+         * the data.
+         *
+         * @param[in]  x       Floating point sample in image (>= 0).
+         * @param[in]  z       Floating point line   in image (>= 0).
+         * @param[out] weights Interpolation weights, summing to one.
+         *
+         * @retval true  Interpolation weights were obtained.
+         * @retval false Interpolation is not possible at the given
+         *               pixel, or is not supported by this strategy.
+         *
+         * @see @c ResamplingPlan
+         */
+        virtual bool weights(double /* x */,
+                             double /* z */,
+                             weights_type & /* weights */) const
+        {
+            return false;
+        }
+
     };
 
 }
@@ -1,7 +1,7 @@
 /**
  * @file MapFactory.cpp
  *
- * Copyright (C) 2003-2004, 2017-2018  Ossama Othman
+ * Copyright (C) 2003-2004, 2017-2018, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -9,7 +9,659 @@
  */
 
 #include "MapFactory.h"
+#include "graticule.h"
+#include "SourceImage.h"
+#include "BodyData.h"
+#include "Constants.h"
 
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+
+
+namespace
+{
+    /// Location on the body.
+    struct location
+    {
+        /// Planetocentric latitude in radians.
+        double lat;
+
+        /// Longitude in radians.
+        double lon;
+    };
+
+    /**
+     * @brief Distance between two points on the surface of the body.
+     *
+     * @param[in] body Body on which the points lie.
+     * @param[in] a    First point.
+     * @param[in] b    Second point.
+     *
+     * @return Straight line distance between @a a and @a b, in the
+     *         same units as the radii of @a body.
+     */
+    double distance(MaRC::BodyData const & body,
+                    location const & a,
+                    location const & b)
+    {
+        double const ra = body.centric_radius(a.lat);
+        double const rb = body.centric_radius(b.lat);
+
+        double const dx =
+            ra * std::cos(a.lat) * std::cos(a.lon)
+            - rb * std::cos(b.lat) * std::cos(b.lon);
+
+        double const dy =
+            ra * std::cos(a.lat) * std::sin(a.lon)
+            - rb * std::cos(b.lat) * std::sin(b.lon);
+
+        double const dz = ra * std::sin(a.lat) - rb * std::sin(b.lat);
+
+        return std::sqrt(dx * dx + dy * dy + dz * dz);
+    }
+
+    /// Continuous map pixel coordinates.
+    struct map_location
+    {
+        /// Map sample coordinate.
+        double sample;
+
+        /// Map line coordinate.
+        double line;
+    };
+
+    /// Unit vector from the center of the body.
+    struct direction
+    {
+        double x;
+        double y;
+        double z;
+    };
+
+    /**
+     * @brief Direction of a point on the body.
+     *
+     * @param[in] p Point on the body.
+     *
+     * @return Unit vector from the center of the body toward @a p.
+     */
+    direction to_direction(location const & p)
+    {
+        return { std::cos(p.lat) * std::cos(p.lon),
+                 std::cos(p.lat) * std::sin(p.lon),
+                 std::sin(p.lat) };
+    }
+
+    /**
+     * @brief Angle between two directions.
+     *
+     * @param[in] a First direction.
+     * @param[in] b Second direction.
+     *
+     * @return Angle between @a a and @a b in radians.
+     */
+    double angle(direction const & a, direction const & b)
+    {
+        // More accurate than the arc cosine for small angles.
+        double const cx = a.y * b.z - a.z * b.y;
+        double const cy = a.z * b.x - a.x * b.z;
+        double const cz = a.x * b.y - a.y * b.x;
+
+        return std::atan2(std::sqrt(cx * cx + cy * cy + cz * cz),
+                          a.x * b.x + a.y * b.y + a.z * b.z);
+    }
+}
+
+bool
+MaRC::MapFactory::map_coordinates(std::size_t /* samples */,
+                                  std::size_t /* lines */,
+                                  double /* lat */,
+                                  double /* lon */,
+                                  double & /* sample */,
+                                  double & /* line */) const
+{
+    return false;  // Forward projection equations not available.
+}
+
+bool
+MaRC::MapFactory::wraps_longitude() const
+{
+    return false;
+}
+
+MaRC::plot_region
+MaRC::MapFactory::map_coverage(source_list const & images,
+                               std::size_t samples,
+                               std::size_t lines) const
+{
+    auto const tiles = this->coverage_mask(images, samples, lines);
+
+    if (tiles.empty())
+        return plot_region(samples, lines);
+
+    return plot_region(samples, lines, coverage_tile, tiles);
+}
+
+std::vector<bool>
+MaRC::MapFactory::coverage_mask(source_list const & images,
+                                std::size_t samples,
+                                std::size_t lines) const
+{
+    std::vector<bool> const entire_map;
+
+    if (images.empty() || samples == 0 || lines == 0)
+        return entire_map;
+
+    constexpr auto tile = coverage_tile;
+
+    auto const tile_samples = (samples + tile - 1) / tile;
+    auto const tile_lines   = (lines   + tile - 1) / tile;
+
+    std::vector<bool> tiles(tile_samples * tile_lines, false);
+
+    bool found = false;
+
+    // Mark the tiles spanned by the given map pixel coordinates.
+    auto const mark =
+        [&](double s0, double s1, double l0, double l1)
+        {
+            // Skip regions entirely outside of the map.
+            if (s1 < 0 || s0 > samples || l1 < 0 || l0 > lines)
+                return;
+
+            // Clamp map coordinates to the closed interval
+            // [0, samples] and [0, lines].
+            auto const to_tile =
+                [](double x, std::size_t size, std::size_t count)
+                {
+                    x = std::clamp(x, 0.0, static_cast<double>(size));
+
+                    auto const t = static_cast<std::size_t>(x) / tile;
+
+                    return std::min(t, count - 1);
+                };
+
+            auto const first_sample = to_tile(s0, samples, tile_samples);
+            auto const last_sample  = to_tile(s1, samples, tile_samples);
+            auto const first_line   = to_tile(l0, lines,   tile_lines);
+            auto const last_line    = to_tile(l1, lines,   tile_lines);
+
+            for (auto k = first_line; k <= last_line; ++k)
+                for (auto i = first_sample; i <= last_sample; ++i)
+                    tiles[k * tile_samples + i] = true;
+
+            found = true;
+        };
+
+    // Number of map pixels beyond which a region is subdivided.
+    double const max_sample_span = samples / 2.0;
+    double const max_line_span   = lines   / 2.0;
+
+    /*
+      Mark the tiles spanned by the bounding box of the given points
+      on the body.  Points that project outside of the map are kept
+      as well, since a large pixel near the limb may still overlap
+      the map even if none of its vertices fall on it.
+
+      Returns false if the points are too far apart on the map to
+      bound the region between them, e.g. when they straddle a
+      discontinuity in the map projection, such as the longitude
+      seam of a cylindrical map, or when the region between them is
+      strongly distorted by the map projection.
+    */
+    auto const mark_points =
+        [&](double const * lat,
+            double const * lon,
+            std::size_t count,
+            bool force)
+        {
+            constexpr auto max_vertices =
+                SourceImage::footprint_cell::max_vertices;
+
+            double sample[max_vertices];
+            double line[max_vertices];
+            std::size_t n = 0;
+
+            for (std::size_t c = 0; c < count; ++c) {
+                sample[n] = std::nan("");
+                line[n]   = std::nan("");
+
+                this->map_coordinates(samples,
+                                      lines,
+                                      lat[c],
+                                      lon[c],
+                                      sample[n],
+                                      line[n]);
+
+                if (std::isfinite(sample[n]) && std::isfinite(line[n]))
+                    ++n;
+            }
+
+            if (n == 0)
+                return true;  // Not on the projection plane.
+
+            auto const [smin, smax] = std::minmax_element(sample,
+                                                          sample + n);
+            auto const [lmin, lmax] = std::minmax_element(line,
+                                                          line + n);
+
+            if (*smax - *smin <= max_sample_span
+                && *lmax - *lmin <= max_line_span) {
+                mark(*smin, *smax, *lmin, *lmax);
+            } else if (force) {
+                for (std::size_t v = 0; v < n; ++v)
+                    mark(sample[v], sample[v], line[v], line[v]);
+            } else {
+                return false;
+            }
+
+            return true;
+        };
+
+    // Maximum depth of latitude/longitude region subdivision.
+    constexpr int max_depth = 6;
+
+    /*
+      Recursively subdivide a latitude/longitude region of the body
+      until each subregion is small enough on the map to be bounded
+      by its corners.  Subregions that still straddle a map
+      discontinuity at the maximum depth only have their corners
+      marked, and rely on the growth of the covered region below.
+    */
+    std::function<void(double, double, double, double, int)> subdivide =
+        [&](double lat0, double lat1, double lon0, double lon1, int depth)
+        {
+            double const lat[] = { lat0, lat0, lat1, lat1 };
+            double const lon[] = { lon0, lon1, lon1, lon0 };
+
+            if (mark_points(lat, lon, std::size(lat), depth == max_depth))
+                return;
+
+            double const lat_mid = (lat0 + lat1) / 2;
+            double const lon_mid = (lon0 + lon1) / 2;
+
+            subdivide(lat0, lat_mid, lon0, lon_mid, depth + 1);
+            subdivide(lat0, lat_mid, lon_mid, lon1, depth + 1);
+            subdivide(lat_mid, lat1, lon0, lon_mid, depth + 1);
+            subdivide(lat_mid, lat1, lon_mid, lon1, depth + 1);
+        };
+
+    auto const visit =
+        [&](SourceImage::footprint_cell const & cell)
+        {
+            auto const vertices = cell.vertices;
+
+            if (vertices == 0)
+                return;  // Nothing to bound.
+
+            if (mark_points(cell.lat, cell.lon, vertices, false))
+                return;
+
+            /*
+              Subdivide the latitude/longitude bounding box of the
+              cell.  Unwrap the longitudes relative to the first
+              vertex so that cells straddling the 0/360 degree
+              longitude boundary are bounded correctly.
+            */
+            double lon[SourceImage::footprint_cell::max_vertices];
+
+            for (std::size_t c = 0; c < vertices; ++c)
+                lon[c] =
+                    cell.lon[0]
+                    + std::remainder(cell.lon[c] - cell.lon[0], C::_2pi);
+
+            auto const [lat_min, lat_max] =
+                std::minmax_element(cell.lat, cell.lat + vertices);
+            auto const [lon_min, lon_max] =
+                std::minmax_element(lon, lon + vertices);
+
+            subdivide(*lat_min, *lat_max, *lon_min, *lon_max, 1);
+        };
+
+    for (auto const image : images)
+        if (image == nullptr || !image->footprint(visit))
+            return entire_map;
+
+    if (!found)
+        return entire_map;
+
+    // Grow the covered region by one tile in each direction.
+    std::vector<bool> grown(tiles.size(), false);
+
+    for (std::size_t tk = 0; tk < tile_lines; ++tk) {
+        for (std::size_t ti = 0; ti < tile_samples; ++ti) {
+            if (!tiles[tk * tile_samples + ti])
+                continue;
+
+            auto const first_sample = (ti > 0 ? ti - 1 : 0);
+            auto const first_line   = (tk > 0 ? tk - 1 : 0);
+            auto const last_sample  = std::min(ti + 2, tile_samples);
+            auto const last_line    = std::min(tk + 2, tile_lines);
+
+            for (auto k = first_line; k < last_line; ++k)
+                for (auto i = first_sample; i < last_sample; ++i)
+                    grown[k * tile_samples + i] = true;
+        }
+    }
+
+    return grown;
+}
+
+MaRC::plot_region
+MaRC::MapFactory::data_region(source_list const & images,
+                              std::size_t samples,
+                              std::size_t lines,
+                              bool source_driven) const
+{
+    using tile_extent = plot_region::tile_extent;
+    using tile_state  = plot_region::tile_state;
+
+    if (samples == 0 || lines == 0)
+        return plot_region(samples, lines);
+
+    constexpr auto tile = coverage_tile;
+
+    // Map tiles covered by the images, if known.
+    auto const coverage =
+        (source_driven
+         ? this->coverage_mask(images, samples, lines)
+         : std::vector<bool>());
+
+    auto const tile_samples = (samples + tile - 1) / tile;
+
+    // Locate a point on the body through the forward projection.
+    auto const locate =
+        [this, samples, lines](location const & p,
+                               std::vector<map_location> & found)
+        {
+            double sample = std::nan("");
+            double line   = std::nan("");
+
+            this->map_coordinates(samples, lines, p.lat, p.lon, sample, line);
+
+            if (std::isfinite(sample) && std::isfinite(line))
+                found.push_back({ sample, line });
+        };
+
+    /*
+      Locate points spread out across the body, including the poles
+      and the points on the equator 90 degrees apart.  At least one
+      of those is on any side of the body shown by a map projection,
+      so no point is found only if the forward projection equations
+      are not available.  The points also reveal parts of the body
+      that lie within a map tile without crossing its edges, such as
+      a body smaller than a tile.
+    */
+    constexpr int anchor_interval = 30;  // degrees
+
+    std::vector<map_location> body_anchors;
+
+    for (int lat = -90; lat <= 90; lat += anchor_interval) {
+        for (int lon = 0; lon < 360; lon += anchor_interval) {
+            locate({ lat * C::degree, lon * C::degree }, body_anchors);
+
+            if (std::abs(lat) == 90)
+                break;  // Only one point at each pole.
+        }
+    }
+
+    if (body_anchors.empty()) {
+        // Forward projection equations not available.
+        if (coverage.empty())
+            return plot_region(samples, lines);
+
+        return plot_region(samples, lines, tile, coverage);
+    }
+
+    /*
+      Regions of the body in which the images may have data, and the
+      map locations of their centers.  Data could be anywhere on the
+      body if the region of any image isn't bounded.
+    */
+    std::vector<SourceImage::body_cap> caps;
+    bool bounded = !images.empty();
+
+    for (auto const image : images)
+        if (image == nullptr || !image->visibility_bounds(caps))
+            bounded = false;
+
+    std::vector<direction> cap_centers;
+    std::vector<map_location> cap_anchors;
+
+    for (auto const & cap : caps) {
+        location const center{ cap.lat, cap.lon };
+
+        cap_centers.push_back(to_direction(center));
+        locate(center, cap_anchors);
+    }
+
+    // Is any location within the tile, grown by one map pixel?
+    auto const near =
+        [](std::vector<map_location> const & locations,
+           tile_extent const & t)
+        {
+            return std::any_of(
+                locations.cbegin(),
+                locations.cend(),
+                [&t](map_location const & m)
+                {
+                    return
+                        m.sample    >= t.first_sample - 1.0
+                        && m.sample <= t.last_sample  + 1.0
+                        && m.line   >= t.first_line   - 1.0
+                        && m.line   <= t.last_line    + 1.0;
+                });
+        };
+
+    /*
+      Classify a tile from the points on the body at the centers of
+      the map pixels along its edges, in order around the tile, or
+      NaN for map pixels off the body.
+    */
+    auto const classify_tile =
+        [&](tile_extent const & t, std::vector<location> const & loop)
+        {
+            auto const on_body =
+                std::count_if(loop.cbegin(),
+                              loop.cend(),
+                              [](location const & p)
+                              {
+                                  return !std::isnan(p.lat);
+                              });
+
+            /*
+              The body is shown as a convex region of the map, such
+              as the disk of the body on an orthographic map, so it
+              can only be within a tile whose edges are entirely off
+              the body if it lies entirely within the tile.
+            */
+            if (on_body == 0)
+                return
+                    near(body_anchors, t)
+                    ? tile_state::mixed
+                    : tile_state::empty;
+            else if (static_cast<std::size_t>(on_body) < loop.size())
+                return tile_state::mixed;  // Tile straddles the limb.
+            else if (!bounded)
+                return tile_state::full;
+
+            std::vector<direction> edge;
+            edge.reserve(loop.size());
+
+            for (auto const & p : loop)
+                edge.push_back(to_direction(p));
+
+            /*
+              Any point along the edges of the tile is within the
+              largest angle between consecutive edge points of one
+              of them.  Grow the caps by that angle so that a cap
+              crossing the edges between two edge points is still
+              detected.
+            */
+            double step = 0;
+
+            for (std::size_t n = 0; n < edge.size(); ++n)
+                step = std::max(step,
+                                angle(edge[n],
+                                      edge[(n + 1) % edge.size()]));
+
+            auto const inside =
+                std::count_if(
+                    edge.cbegin(),
+                    edge.cend(),
+                    [&](direction const & d)
+                    {
+                        for (std::size_t c = 0; c < caps.size(); ++c)
+                            if (angle(d, cap_centers[c])
+                                <= caps[c].radius + step)
+                                return true;
+
+                        return false;
+                    });
+
+            /*
+              A cap that doesn't cross the edges of a tile can only
+              be within the tile if it lies entirely within the
+              tile, in which case its center does as well.
+            */
+            if (static_cast<std::size_t>(inside) == edge.size())
+                return tile_state::full;
+            else if (inside == 0 && !near(cap_anchors, t))
+                return tile_state::empty;
+
+            return tile_state::mixed;
+        };
+
+    auto const classify =
+        [&](std::vector<tile_extent> const & tiles)
+        {
+            std::vector<tile_state> states(tiles.size(),
+                                           tile_state::mixed);
+
+            // Tiles only partially covered by the images.
+            std::vector<bool> partial(tiles.size(), false);
+
+            // Map pixels along the edges of each tile.
+            std::vector<std::vector<plot_region::span>> rows(lines);
+
+            for (std::size_t n = 0; n < tiles.size(); ++n) {
+                auto const & t = tiles[n];
+
+                if (!coverage.empty()) {
+                    std::size_t covered = 0;
+                    std::size_t count   = 0;
+
+                    for (auto k = t.first_line; k < t.last_line; k += tile)
+                        for (auto i = t.first_sample;
+                             i < t.last_sample;
+                             i += tile) {
+                            ++count;
+
+                            if (coverage[(k / tile) * tile_samples
+                                         + i / tile])
+                                ++covered;
+                        }
+
+                    if (covered == 0) {
+                        states[n] = tile_state::empty;
+                        continue;
+                    }
+
+                    partial[n] = (covered < count);
+                }
+
+                auto const last_line = t.last_line - 1;
+
+                rows[t.first_line].push_back({ t.first_sample,
+                                               t.last_sample });
+                rows[last_line].push_back({ t.first_sample,
+                                            t.last_sample });
+
+                for (auto k = t.first_line + 1; k < last_line; ++k) {
+                    rows[k].push_back({ t.first_sample,
+                                        t.first_sample + 1 });
+                    rows[k].push_back({ t.last_sample - 1,
+                                        t.last_sample });
+                }
+            }
+
+            // Evaluate the edges of all tiles in one map traversal.
+            plot_region const edges(samples, lines, std::move(rows));
+
+            std::vector<std::size_t> offsets;
+            offsets.reserve(edges.size());
+
+            for (std::size_t k = 0; k < lines; ++k)
+                for (auto const & e : edges.spans(k))
+                    for (auto i = e.first; i < e.last; ++i)
+                        offsets.push_back(k * samples + i);
+
+            std::vector<location> points(offsets.size(),
+                                         { std::nan(""), std::nan("") });
+
+            auto const index =
+                [&offsets](std::size_t offset)
+                {
+                    return
+                        std::lower_bound(offsets.cbegin(),
+                                         offsets.cend(),
+                                         offset)
+                        - offsets.cbegin();
+                };
+
+            this->plot_map(edges,
+                           [&](double lat, double lon, std::size_t offset)
+                           {
+                               points[index(offset)] = { lat, lon };
+                           });
+
+            std::vector<location> loop;
+
+            for (std::size_t n = 0; n < tiles.size(); ++n) {
+                if (states[n] == tile_state::empty)
+                    continue;
+
+                auto const & t = tiles[n];
+
+                auto const edge_point =
+                    [&](std::size_t i, std::size_t k)
+                    {
+                        loop.push_back(points[index(k * samples + i)]);
+                    };
+
+                auto const last_sample = t.last_sample - 1;
+                auto const last_line   = t.last_line   - 1;
+
+                // Walk around the tile, clockwise.
+                loop.clear();
+
+                for (auto i = t.first_sample; i <= last_sample; ++i)
+                    edge_point(i, t.first_line);
+
+                for (auto k = t.first_line + 1; k <= last_line; ++k)
+                    edge_point(last_sample, k);
+
+                for (auto i = last_sample; i-- > t.first_sample; )
+                    edge_point(i, last_line);
+
+                for (auto k = last_line; k-- > t.first_line + 1; )
+                    edge_point(t.first_sample, k);
+
+                states[n] = classify_tile(t, loop);
+
+                if (partial[n] && states[n] == tile_state::full)
+                    states[n] = tile_state::mixed;
+            }
+
+            return states;
+        };
+
+    return plot_region(samples, lines, tile, classify);
+}
 
 MaRC::MapFactory::grid_type
 MaRC::MapFactory::make_grid(std::size_t samples,
@@ -39,3 +691,361 @@ MaRC::MapFactory::make_grid(std::size_t samples,
 
     return grid;
 }
+
+void
+MaRC::MapFactory::plot_grid(std::size_t samples,
+                            std::size_t lines,
+                            double lat_interval,
+                            double lon_interval,
+                            grid_type & grid) const
+{
+    auto const forward =
+        [this, samples, lines](double lat,
+                               double lon,
+                               double & sample,
+                               double & line)
+        {
+            /*
+              The location of points off the map is still set, in
+              which case map_coordinates() returns false, unless the
+              point is not visible in the projection.
+            */
+            sample = std::numeric_limits<double>::quiet_NaN();
+            line   = sample;
+
+            this->map_coordinates(samples, lines, lat, lon, sample, line);
+
+            return !std::isnan(sample) && !std::isnan(line);
+        };
+
+    MaRC::plot_graticule(samples,
+                         lines,
+                         lat_interval,
+                         lon_interval,
+                         forward,
+                         grid);
+}
+
+void
+MaRC::MapFactory::coordinate_tolerance(double km)
+{
+    if (!std::isfinite(km) || km < 0)
+        throw std::invalid_argument("Invalid map coordinate tolerance.");
+
+    this->coordinate_tolerance_ = km;
+}
+
+void
+MaRC::MapFactory::plot_coordinates(plot_region const & region,
+                                   BodyData const & body,
+                                   inverse_type const & inverse,
+                                   plot_type const & plot) const
+{
+    this->plot_coordinates(region, body, inverse, nullptr, plot);
+}
+
+void
+MaRC::MapFactory::plot_coordinates(plot_region const & region,
+                                   BodyData const & body,
+                                   inverse_type const & inverse,
+                                   row_inverse_type const & row_inverse,
+                                   plot_type const & plot) const
+{
+    auto const samples = region.samples();
+    auto const lines   = region.lines();
+
+    // Call f(i, k) for each map pixel in the region within the
+    // half-open sample range [i0, i1) and line range [k0, k1).
+    auto const for_each_pixel =
+        [&region](std::size_t i0,
+                  std::size_t i1,
+                  std::size_t k0,
+                  std::size_t k1,
+                  auto f)
+        {
+            for (auto k = k0; k < k1; ++k) {
+                for (auto const & s : region.spans(k)) {
+                    auto const first = std::max(s.first, i0);
+                    auto const last  = std::min(s.last,  i1);
+
+                    for (auto i = first; i < last; ++i)
+                        f(i, k);
+                }
+            }
+        };
+
+    // Plot a map pixel through the exact inverse projection.
+    auto const plot_exact =
+        [&](std::size_t i, std::size_t k)
+        {
+            location p;
+
+            if (inverse(i + 0.5, k + 0.5, p.lat, p.lon))
+                plot(p.lat, p.lon, k * samples + i);
+        };
+
+    double const tolerance = this->coordinate_tolerance_;
+
+    if (tolerance == 0 && row_inverse) {
+        // Locations of the map pixels in a run.
+        std::vector<double> lat(samples);
+        std::vector<double> lon(samples);
+
+        for (std::size_t k = 0; k < lines; ++k) {
+            for (auto const & s : region.spans(k)) {
+                auto const count = s.last - s.first;
+
+                row_inverse(s.first + 0.5,
+                            k + 0.5,
+                            count,
+                            lat.data(),
+                            lon.data());
+
+                auto const offset = k * samples + s.first;
+
+                for (std::size_t n = 0; n < count; ++n)
+                    if (!std::isnan(lat[n]))
+                        plot(lat[n], lon[n], offset + n);
+            }
+        }
+
+        return;
+    }
+
+    if (tolerance == 0) {
+        for_each_pixel(0, samples, 0, lines, plot_exact);
+        return;
+    }
+
+    // Width and height of the coarse cells in map pixels.
+    constexpr std::size_t cell_size = 32;
+
+    // Cells smaller than this are not worth interpolating.
+    constexpr std::size_t min_cell_size = 3;
+
+    std::function<void(std::size_t, std::size_t, std::size_t, std::size_t)>
+        plot_cell =
+        [&](std::size_t i0, std::size_t i1, std::size_t k0, std::size_t k1)
+        {
+            // Skip cells without any map pixels in the region.
+            bool empty = true;
+
+            for (auto k = k0; empty && k < k1; ++k)
+                for (auto const & s : region.spans(k))
+                    if (s.first < i1 && s.last > i0)
+                        empty = false;
+
+            if (empty)
+                return;
+
+            if (i1 - i0 < min_cell_size || k1 - k0 < min_cell_size) {
+                for_each_pixel(i0, i1, k0, k1, plot_exact);
+                return;
+            }
+
+            // Centers of the map pixels at the corners of the cell.
+            double const s0 = i0 + 0.5;
+            double const s1 = i1 - 0.5;
+            double const l0 = k0 + 0.5;
+            double const l1 = k1 - 0.5;
+
+            // Exact locations at the corners of the cell.
+            location c[4];
+
+            bool accurate =
+                inverse(s0, l0, c[0].lat, c[0].lon)
+                && inverse(s1, l0, c[1].lat, c[1].lon)
+                && inverse(s0, l1, c[2].lat, c[2].lon)
+                && inverse(s1, l1, c[3].lat, c[3].lon);
+
+            // Unwrap the longitudes relative to the first corner.
+            for (std::size_t n = 1; accurate && n < std::size(c); ++n)
+                c[n].lon =
+                    c[0].lon + std::remainder(c[n].lon - c[0].lon, C::_2pi);
+
+            // Bilinearly interpolate between the corners, where
+            // (u, v) is the fractional location within the cell.
+            auto const interpolate =
+                [&c](double u, double v)
+                {
+                    auto const lerp =
+                        [u, v](double f00, double f10, double f01, double f11)
+                        {
+                            return
+                                (1 - v) * ((1 - u) * f00 + u * f10)
+                                + v * ((1 - u) * f01 + u * f11);
+                        };
+
+                    return location {
+                        lerp(c[0].lat, c[1].lat, c[2].lat, c[3].lat),
+                        lerp(c[0].lon, c[1].lon, c[2].lon, c[3].lon)
+                    };
+                };
+
+            // Check the interpolation error at the center of the cell
+            // and at the middle of each of its edges.
+            static constexpr double checks[][2] = {
+                { 0.5, 0.5 },
+                { 0.5, 0   },
+                { 0.5, 1   },
+                { 0,   0.5 },
+                { 1,   0.5 }
+            };
+
+            for (std::size_t n = 0; accurate && n < std::size(checks); ++n) {
+                double const u = checks[n][0];
+                double const v = checks[n][1];
+
+                location exact;
+
+                accurate =
+                    inverse(s0 + u * (s1 - s0),
+                            l0 + v * (l1 - l0),
+                            exact.lat,
+                            exact.lon)
+                    && distance(body, exact, interpolate(u, v)) <= tolerance;
+            }
+
+            if (accurate) {
+                for_each_pixel(
+                    i0, i1, k0, k1,
+                    [&](std::size_t i, std::size_t k)
+                    {
+                        auto const p =
+                            interpolate((i + 0.5 - s0) / (s1 - s0),
+                                        (k + 0.5 - l0) / (l1 - l0));
+
+                        plot(p.lat, p.lon, k * samples + i);
+                    });
+
+                return;
+            }
+
+            // Subdivide the cell into quadrants.
+            auto const im = (i0 + i1) / 2;
+            auto const km = (k0 + k1) / 2;
+
+            plot_cell(i0, im, k0, km);
+            plot_cell(im, i1, k0, km);
+            plot_cell(i0, im, km, k1);
+            plot_cell(im, i1, km, k1);
+        };
+
+    for (std::size_t k = 0; k < lines; k += cell_size)
+        for (std::size_t i = 0; i < samples; i += cell_size)
+            plot_cell(i,
+                      std::min(i + cell_size, samples),
+                      k,
+                      std::min(k + cell_size, lines));
+}
+
+MaRC::ResamplingPlan
+MaRC::MapFactory::make_plan(SourceImage const & image,
+                            std::size_t samples,
+                            std::size_t lines) const
+{
+    auto sources = image.resampling_sources();
+
+    if (sources.empty())
+        throw std::invalid_argument("Source image does not support "
+                                    "resampling plans.");
+
+    if (sources.size() > std::numeric_limits<std::uint32_t>::max())
+        throw std::invalid_argument("Too many source images in "
+                                    "resampling plan.");
+
+    // Map offset of each recorded tap, in the order recorded.
+    struct entry
+    {
+        std::size_t offset;
+        ResamplingPlan::tap tap;
+    };
+
+    std::vector<entry> entries;
+
+    ResamplingPlan::tap_list taps;
+
+    auto plot =
+        [&image, &entries, &taps](double lat,
+                                  double lon,
+                                  std::size_t offset)
+        {
+            double weight = 1;  // Unused.
+
+            static constexpr std::size_t first = 0;
+            static constexpr bool scan = false;
+
+            taps.clear();
+
+            if (image.read_taps(lat, lon, first, taps, weight, scan))
+                for (auto const & t : taps)
+                    entries.push_back({ offset, t });
+        };
+
+    this->plot_map(this->data_region(source_list{ &image }, samples, lines),
+                   plot);
+
+    /*
+      Arrange the taps by map offset since map projections aren't
+      required to traverse the map in order.
+    */
+    auto const size = samples * lines;
+
+    std::vector<std::uint64_t> offsets(size + 1, 0);
+
+    for (auto const & e : entries)
+        ++offsets[e.offset + 1];
+
+    for (std::size_t n = 1; n <= size; ++n)
+        offsets[n] += offsets[n - 1];
+
+    auto const count = entries.size();
+
+    std::vector<std::uint32_t> images(count);
+    std::vector<std::uint64_t> pixels(count);
+    std::vector<double>        weights(count);
+
+    {
+        std::vector<std::uint64_t> next(offsets.cbegin(),
+                                        offsets.cend() - 1);
+
+        for (auto const & e : entries) {
+            auto const n = next[e.offset]++;
+
+            images[n]  = static_cast<std::uint32_t>(e.tap.image);
+            pixels[n]  = e.tap.pixel;
+            weights[n] = e.tap.weight;
+        }
+    }
+
+    return ResamplingPlan(samples,
+                          lines,
+                          std::move(sources),
+                          std::move(offsets),
+                          std::move(images),
+                          std::move(pixels),
+                          std::move(weights));
+}
+
+std::size_t
+MaRC::MapFactory::count_planes(source_list const & images)
+{
+    if (images.empty())
+        throw std::invalid_argument("No source images to map.");
+
+    std::size_t planes = 0;
+
+    for (auto const image : images) {
+        if (image == nullptr)
+            throw std::invalid_argument("Null source image.");
+
+        auto const bands = image->bands();
+
+        if (bands == 0)
+            throw std::invalid_argument("Source image has no bands.");
+
+        planes += bands;
+    }
+
+    return planes;
+}
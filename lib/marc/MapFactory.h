@@ -2,7 +2,7 @@
 /**
  * @file MapFactory.h
  *
- * Copyright (C) 2003-2004, 2017-2018  Ossama Othman
+ * Copyright (C) 2003-2004, 2017-2018, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -14,6 +14,9 @@
 
 #include <marc/Export.h>
 #include <marc/extrema.h>
+#include <marc/ResamplingPlan.h>
+#include <marc/plot_region.h>
+#include <marc/fast_math.h>
 
 #include <vector>
 #include <functional>
@@ -23,6 +26,7 @@
 namespace MaRC
 {
     class SourceImage;
+    class BodyData;
     template <typename T> class extrema;
     template <typename T> class plot_info;
 
@@ -44,6 +48,20 @@ namespace MaRC
         /// Type returned from @c make_grid() method.
         using grid_type = std::vector<std::uint8_t>;
 
+        /// Source images mapped in a single map traversal.
+        using source_list = std::vector<SourceImage const *>;
+
+        /**
+         * @brief Size of the square map tiles marked by
+         *        @c map_coverage(), and of the smallest map tiles
+         *        culled by @c data_region().
+         */
+        static constexpr std::size_t coverage_tile = 8;
+
+        /// User-specified data extrema for each source image.
+        template <typename T>
+        using extrema_list = std::vector<extrema<T>>;
+
         /**
          * @brief Map plot functor type.
          *
@@ -81,6 +99,135 @@ namespace MaRC
         /// Return the name of the map projection.
         virtual char const * projection_name() const = 0;
 
+        /**
+         * @brief Locate a point on the body within the map.
+         *
+         * Compute the map location of the point on the body at the
+         * given latitude and longitude through the forward map
+         * projection equations.  This is the inverse of the
+         * latitude and longitude computation done when plotting the
+         * map.  Locations are continuous map pixel coordinates
+         * measured from the first sample and line, i.e. the center
+         * of the map pixel at sample @c i and line @c k is at
+         * (@c i + 0.5, @c k + 0.5).
+         *
+         * The default implementation returns @c false, meaning the
+         * forward projection equations are not available.
+         *
+         * @note The location of a point that projects outside of the
+         *       map is still set, if the projection is defined
+         *       there, in which case @c false is returned.  Callers
+         *       may use it to bound regions extending beyond the map.
+         *
+         * @param[in]  samples Number of samples in the map.
+         * @param[in]  lines   Number of lines   in the map.
+         * @param[in]  lat     Planetocentric latitude in radians.
+         * @param[in]  lon     Longitude in radians.
+         * @param[out] sample  Map sample coordinate.
+         * @param[out] line    Map line coordinate.
+         *
+         * @retval true  The point falls within the map.
+         * @retval false The point is not on the map, or the forward
+         *               projection equations are not available.
+         */
+        virtual bool map_coordinates(std::size_t samples,
+                                     std::size_t lines,
+                                     double lat,
+                                     double lon,
+                                     double & sample,
+                                     double & line) const;
+
+        /**
+         * @brief Does the map wrap around in longitude?
+         *
+         * A map wraps around in longitude if its samples span all
+         * 360 degrees of longitude, in which case the left edge of
+         * the first map sample and the right edge of the last map
+         * sample lie on the same meridian.  Points on either side of
+         * that seam are adjacent on the body, even though they are
+         * at opposite ends of a map line.
+         *
+         * The default implementation returns @c false.
+         *
+         * @see @c map_coordinates()
+         */
+        virtual bool wraps_longitude() const;
+
+        /**
+         * @brief Find the map pixels covered by source images.
+         *
+         * Project the footprint of each source image onto the map
+         * through the forward map projection equations.  Map pixels
+         * are marked in square tiles of @c coverage_tile pixels,
+         * grown by one tile in each direction to account for pixels
+         * only partially on the body, so the coverage is a
+         * conservative estimate of the region in which the source
+         * images have data.  Empty tiles are culled hierarchically
+         * so that the map projection never visits them.
+         *
+         * @param[in] images  Images whose footprints will be
+         *                    projected onto the map.
+         * @param[in] samples Number of samples in the map.
+         * @param[in] lines   Number of lines   in the map.
+         *
+         * @return Region of the map covered by @a images.  The
+         *         entire map is returned if the footprint of an
+         *         image, or the forward projection equations, are not
+         *         available, or if no part of any footprint fell on
+         *         the map.
+         *
+         * @see @c SourceImage::footprint()
+         * @see @c map_coordinates()
+         */
+        plot_region map_coverage(source_list const & images,
+                                 std::size_t samples,
+                                 std::size_t lines) const;
+
+        /**
+         * @brief Find the map pixels in which source images may have
+         *        data.
+         *
+         * Cull the map top-down, quadtree style, starting from a
+         * single tile spanning the entire map.  The map pixels on
+         * the edges of all tiles at a given depth are evaluated
+         * through the inverse map projection equations in a single
+         * map traversal.  A tile is empty if its edges are entirely
+         * off the body, or entirely outside of the spherical caps
+         * bounding the regions of the body in which the source
+         * images may have data, i.e. their visibility bounds, unless
+         * the body or a cap could lie entirely within the tile.
+         * Such islands are found by locating the body, and the
+         * centers of the caps, through the forward map projection
+         * equations.  A tile is full if its edges are entirely on
+         * the body, and within the caps.  Only the remaining mixed
+         * tiles are split into quadrants, down to tiles of
+         * @c coverage_tile map pixels.  Mixed tiles of that size
+         * are kept.  The culling is conservative, since source
+         * image data can only be plotted at map pixels that are on
+         * the body and within the caps.
+         *
+         * @param[in] images        Images whose data will be plotted
+         *                          on the map.
+         * @param[in] samples       Number of samples in the map.
+         * @param[in] lines         Number of lines   in the map.
+         * @param[in] source_driven Also cull map tiles outside of
+         *                          the region covered by the
+         *                          footprints of @a images.
+         *
+         * @return Region of the map in which @a images may have
+         *         data.  If the forward projection equations are not
+         *         available, the region is the one returned by
+         *         @c map_coverage() in source-driven mode, and the
+         *         entire map otherwise.
+         *
+         * @see @c SourceImage::visibility_bounds()
+         * @see @c map_coverage()
+         */
+        plot_region data_region(source_list const & images,
+                                std::size_t samples,
+                                std::size_t lines,
+                                bool source_driven = false) const;
+
         /**
          * @brief Create the map projection.
          *
@@ -114,6 +261,160 @@ namespace MaRC
                              extrema<T> const & minmax,
                              plot_info<T> & info) const;
 
+        /**
+         * @brief Create the map projection in caller-supplied
+         *        storage.
+         *
+         * This variant of @c make_map() plots the map into an
+         * existing container rather than allocating a new one,
+         * allowing map buffers to be reused across map planes.
+         *
+         * @tparam        T      Map element data type.
+         * @param[in]     image  Image from which data to be
+         *                       plotted to the map will be read.
+         * @param[in]     minmax User-specified minimum and maximum
+         *                       allowed physical data values on the
+         *                       map.
+         * @param[in,out] info   Map plotting information.
+         * @param[in,out] map    Map container.  It will be resized
+         *                       to fit the map, and all of its
+         *                       previous contents will be
+         *                       overwritten.
+         *
+         * @see @c make_map(SourceImage const &, extrema<T> const &,
+         *                  plot_info<T> &)
+         */
+        template <typename T>
+        void make_map(SourceImage const & image,
+                      extrema<T> const & minmax,
+                      plot_info<T> & info,
+                      map_type<T> & map) const;
+
+        /**
+         * @brief Create map projections of all bands in a
+         *        multi-band source image.
+         *
+         * This variant of @c make_map() plots one map per band of
+         * @a image, e.g. one per plane of a multispectral image
+         * cube, in a single traversal of the map.  Each latitude and
+         * longitude on the map is therefore only computed once, and
+         * all bands are read from @a image at that location through
+         * a single call to @c SourceImage::read_bands().
+         *
+         * @tparam        T      Map element data type.
+         * @param[in]     image  Image from which data to be
+         *                       plotted to the maps will be read.
+         * @param[in]     minmax User-specified minimum and maximum
+         *                       allowed physical data values on the
+         *                       maps.
+         * @param[in,out] info   Map plotting information.  The
+         *                       mapped data extrema span all bands.
+         * @param[in,out] maps   Map containers, one per band.  It
+         *                       will be resized to
+         *                       @c image.bands() elements, each of
+         *                       which will be resized to fit the
+         *                       map.
+         *
+         * @see @c make_map(SourceImage const &, extrema<T> const &,
+         *                  plot_info<T> &, map_type<T> &)
+         */
+        template <typename T>
+        void make_maps(SourceImage const & image,
+                       extrema<T> const & minmax,
+                       plot_info<T> & info,
+                       std::vector<map_type<T>> & maps) const;
+
+        /**
+         * @brief Create map projections of several source images.
+         *
+         * Plot the data from all bands of all @a images in a single
+         * traversal of the map, rather than one traversal per image.
+         * The map latitudes and longitudes, and the progress
+         * notifications, are therefore only computed once for all
+         * map planes.  Each band of each image is plotted to a
+         * separate map plane, in order.
+         *
+         * @tparam        T      Map element data type.
+         * @param[in]     images Images from which data to be plotted
+         *                       to the maps will be read.
+         * @param[in]     minmax User-specified minimum and maximum
+         *                       allowed physical data values for the
+         *                       planes of each image in @a images.
+         * @param[in,out] info   Map plotting information.  The
+         *                       mapped data extrema span all planes.
+         * @param[in,out] maps   Map containers, one per plane.  It
+         *                       will be resized to the total number
+         *                       of bands in @a images, each of which
+         *                       will be resized to fit the map.
+         *
+         * @throw std::invalid_argument No images, a null image, or
+         *                              mismatched @a minmax size.
+         *
+         * @see @c make_interleaved_maps()
+         */
+        template <typename T>
+        void make_maps(source_list const & images,
+                       extrema_list<T> const & minmax,
+                       plot_info<T> & info,
+                       std::vector<map_type<T>> & maps) const;
+
+        /**
+         * @brief Create plane-interleaved map projections of several
+         *        source images.
+         *
+         * This variant of @c make_maps() plots all planes to a single
+         * container in which the data for each map pixel of all
+         * planes is contiguous, i.e. the element for plane @c p at
+         * map offset @c i is found at @c i * planes + p.
+         *
+         * @tparam        T      Map element data type.
+         * @param[in]     images Images from which data to be plotted
+         *                       to the map will be read.
+         * @param[in]     minmax User-specified minimum and maximum
+         *                       allowed physical data values for the
+         *                       planes of each image in @a images.
+         * @param[in,out] info   Map plotting information.  The
+         *                       mapped data extrema span all planes.
+         * @param[in,out] map    Plane-interleaved map container.  It
+         *                       will be resized to fit all planes.
+         *
+         * @return Number of interleaved planes.
+         *
+         * @throw std::invalid_argument No images, a null image, or
+         *                              mismatched @a minmax size.
+         */
+        template <typename T>
+        std::size_t make_interleaved_maps(source_list const & images,
+                                          extrema_list<T> const & minmax,
+                                          plot_info<T> & info,
+                                          map_type<T> & map) const;
+
+        /**
+         * @brief Record how a source image is resampled onto the
+         *        map.
+         *
+         * Traverse the map once, recording the source image pixels
+         * and weights that contribute to each map pixel rather than
+         * the data itself.  The resulting plan may be applied to new
+         * data with the same viewing geometry, such as images in a
+         * time series, without repeating the map projection and
+         * viewing geometry computations.
+         *
+         * @param[in] image   Image whose geometry will be recorded.
+         * @param[in] samples Number of samples in the map.
+         * @param[in] lines   Number of lines   in the map.
+         *
+         * @return The resampling plan.
+         *
+         * @throw std::invalid_argument @a image doesn't support
+         *                              resampling plans.
+         *
+         * @see @c ResamplingPlan
+         */
+        ResamplingPlan make_plan(SourceImage const & image,
+                                 std::size_t samples,
+                                 std::size_t lines) const;
+
         /**
          * @brief Create the latitude/longitude grid for the map
          *        projection.
@@ -143,6 +444,163 @@ namespace MaRC
                             double lat_interval,
                             double lon_interval) const;
 
+        /**
+         * @brief Set the accuracy of interpolated map coordinates.
+         *
+         * Map projections with expensive inverse projection
+         * equations may compute the latitudes and longitudes exactly
+         * on a coarse grid of map pixels, and interpolate between
+         * them wherever the interpolation error is no larger than
+         * @a km.  Coordinates are computed exactly at every map
+         * pixel if @a km is zero, the default.
+         *
+         * @param[in] km Maximum distance on the surface of the body
+         *               between interpolated and exact map pixel
+         *               locations, in kilometers.
+         *
+         * @throw std::invalid_argument Negative or non-finite
+         *                              @a km.
+         *
+         * @see @c plot_coordinates()
+         */
+        void coordinate_tolerance(double km);
+
+        /// Get the accuracy of interpolated map coordinates in km.
+        double coordinate_tolerance() const
+        {
+            return this->coordinate_tolerance_;
+        }
+
+        /**
+         * @brief Set the transcendental math implementation used by
+         *        inverse projection equations.
+         *
+         * Map projections may use the faster, slightly less accurate
+         * functions in the @c MaRC::fast namespace rather than the
+         * C++ standard library ones when @a mode is
+         * @c math_mode::fast.  Their error bounds are documented in
+         * @c <marc/fast_math.h>.  Standard library functions are used
+         * by default.
+         *
+         * @note Only the @c Orthographic and @c PolarStereographic
+         *       inverse projection equations currently honor
+         *       @a mode.  Computations done by the body and source
+         *       images, such as latitude conversions and photometric
+         *       angles, always use the standard library functions.
+         *
+         * @param[in] mode Transcendental math implementation.
+         */
+        void math(math_mode mode) { this->math_ = mode; }
+
+        /// Get the transcendental math implementation.
+        math_mode math() const { return this->math_; }
+
+    protected:
+
+        /**
+         * @brief Inverse map projection functor type.
+         *
+         * @param[in]  sample Continuous map sample coordinate, where
+         *                    the center of the map pixel at sample
+         *                    @c i is at @c i + 0.5.
+         * @param[in]  line   Continuous map line coordinate.
+         * @param[out] lat    Planetocentric latitude in radians.
+         * @param[out] lon    Longitude in radians.
+         *
+         * @retval true  The map location is on the body.
+         * @retval false The map location is not on the body.
+         */
+        using inverse_type =
+            std::function<bool(double sample,
+                               double line,
+                               double & lat,
+                               double & lon)>;
+
+        /**
+         * @brief Inverse map projection functor type for a run of
+         *        consecutive map pixels along a line.
+         *
+         * Evaluating the inverse projection equations for a run of
+         * map pixels at a time allows quantities that are constant or
+         * linear along the line to be computed once per run, and
+         * the remaining computations to be vectorized.
+         *
+         * @param[in]  sample Continuous map sample coordinate of the
+         *                    first map pixel in the run.
+         * @param[in]  line   Continuous map line coordinate.
+         * @param[in]  count  Number of map pixels in the run.
+         * @param[out] lat    Planetocentric latitude in radians of
+         *                    each map pixel in the run, or @c NaN
+         *                    if the map pixel is not on the body.
+         * @param[out] lon    Longitude in radians of each map pixel
+         *                    in the run.
+         *
+         * @see @c inverse_type
+         */
+        using row_inverse_type =
+            std::function<void(double sample,
+                               double line,
+                               std::size_t count,
+                               double * lat,
+                               double * lon)>;
+
+        /**
+         * @brief Plot the map through its inverse projection
+         *        equations.
+         *
+         * Call @a plot with the latitude and longitude of each map
+         * pixel in @a region that is on the body.  If a coordinate
+         * tolerance is set, the map is divided into square cells
+         * with @a inverse only evaluated at their corners.  The
+         * latitudes and longitudes within a cell are bilinearly
+         * interpolated between its corners if the interpolation
+         * error at the center of the cell and at the middle of each
+         * of its edges is within the tolerance.  Otherwise the cell
+         * is subdivided, down to the evaluation of @a inverse at
+         * every map pixel.  Cells that aren't entirely on the body,
+         * such as those along the limb, are always subdivided.
+         *
+         * @param[in] region  Region of the map to be plotted.
+         * @param[in] body    Body being mapped.
+         * @param[in] inverse Inverse map projection equations.
+         * @param[in] plot    Functor to be called when plotting data
+         *                    on the map.
+         *
+         * @see @c coordinate_tolerance()
+         */
+        void plot_coordinates(plot_region const & region,
+                              BodyData const & body,
+                              inverse_type const & inverse,
+                              plot_type const & plot) const;
+
+        /**
+         * @brief Plot the map through its inverse projection
+         *        equations, a run of map pixels at a time.
+         *
+         * Map pixel coordinates that are computed exactly are
+         * computed through @a row_inverse for each run of
+         * consecutive map pixels in @a region along a line.  The
+         * coordinate tolerance checks still evaluate @a inverse at
+         * individual map pixels, so both functors must implement the
+         * same equations.
+         *
+         * @param[in] region      Region of the map to be plotted.
+         * @param[in] body        Body being mapped.
+         * @param[in] inverse     Inverse map projection equations.
+         * @param[in] row_inverse Inverse map projection equations
+         *                        for a run of map pixels.
+         * @param[in] plot        Functor to be called when plotting
+         *                        data on the map.
+         *
+         * @see The @c inverse_type overload of
+         *      @c plot_coordinates().
+         */
+        void plot_coordinates(plot_region const & region,
+                              BodyData const & body,
+                              inverse_type const & inverse,
+                              row_inverse_type const & row_inverse,
+                              plot_type const & plot) const;
+
     private:
 
         /**
@@ -193,8 +651,6 @@ namespace MaRC
             /// Get the map image container.
             auto & map() { return map_; }
 
-        private:
-
             /**
              * @brief Get valid extrema.
              *
@@ -210,7 +666,7 @@ namespace MaRC
              *
              * @return Suitably initialized extrema.
              */
-            MaRC::extrema<T> get_extrema(extrema<T> const & e);
+            static MaRC::extrema<T> get_extrema(extrema<T> const & e);
 
         private:
 
@@ -231,13 +687,17 @@ namespace MaRC
         /**
          * @brief Create the desired map projection.
          *
-         * @param[in] samples Number of samples in map.
-         * @param[in] lines   Number of lines   in map.
-         * @param[in] plot    Functor to be called when plotting data
-         *                    on the map.
+         * Only the map pixels in @a region should be plotted.  The
+         * latitude and longitude computations for map lines without
+         * any pixels in @a region should be skipped entirely.
+         *
+         * @param[in] region Region of the map to be plotted,
+         *                   including the number of samples and
+         *                   lines in the map.
+         * @param[in] plot   Functor to be called when plotting data
+         *                   on the map.
          */
-        virtual void plot_map(std::size_t samples,
-                              std::size_t lines,
+        virtual void plot_map(plot_region const & region,
                               plot_type const & plot) const = 0;
 
         /**
@@ -273,9 +733,75 @@ namespace MaRC
                   double lon,
                   std::size_t offset) const;
 
+        /**
+         * @brief Plot the data from several source images in a single
+         *        map traversal.
+         *
+         * @see @c make_maps(source_list const &,
+         *                   extrema_list<T> const &,
+         *                   plot_info<T> &,
+         *                   std::vector<map_type<T>> &)
+         *
+         * @tparam        T      Map element data type.
+         * @tparam        Store  Functor taking the plane, map offset
+         *                       and datum that stores the datum in
+         *                       the caller's map containers.
+         * @param[in]     images Images from which data will be read.
+         * @param[in]     minmax User-specified minimum and maximum
+         *                       allowed physical data values for the
+         *                       planes of each image in @a images.
+         * @param[in,out] info   Map plotting information.
+         * @param[in]     store  Functor that stores mapped data.
+         */
+        template <typename T, typename Store>
+        void plot_planes(source_list const & images,
+                         extrema_list<T> const & minmax,
+                         plot_info<T> & info,
+                         Store store) const;
+
+        /// Get the total number of bands in the given source images.
+        static std::size_t count_planes(source_list const & images);
+
+        /**
+         * @brief Find the map tiles covered by source images.
+         *
+         * @return Row-major mask of the map tiles of
+         *         @c coverage_tile map pixels covered by @a images,
+         *         or an empty mask if the entire map is covered.
+         *
+         * @see @c map_coverage()
+         */
+        std::vector<bool> coverage_mask(source_list const & images,
+                                        std::size_t samples,
+                                        std::size_t lines) const;
+
+        /**
+         * @brief Get the region of the map to be plotted.
+         *
+         * @tparam    T      Map element data type.
+         * @param[in] images Images whose data will be plotted on the
+         *                   map.
+         * @param[in] info   Map plotting information, including the
+         *                   map dimensions and whether map tiles are
+         *                   culled.
+         *
+         * @see @c data_region()
+         * @see @c map_coverage()
+         */
+        template <typename T>
+        plot_region map_region(source_list const & images,
+                               plot_info<T> const & info) const;
+
         /**
          * @brief Plot latitude/longitude grid for the map.
          *
+         * The default implementation rasterizes the grid lines as
+         * connected polylines through the forward map projection
+         * equations, i.e. @c map_coordinates(), at a resolution
+         * adapted to the map size.  Subclasses need only override
+         * it if the grid may be plotted more directly, such as when
+         * grid lines are straight map lines.
+         *
          * @param[in]     samples      Number of samples in grid.
          * @param[in]     lines        Number of lines   in grid.
          * @param[in]     lat_interval Number of degrees between each
@@ -292,7 +818,24 @@ namespace MaRC
                                std::size_t lines,
                                double lat_interval,
                                double lon_interval,
-                               grid_type & grid) const = 0;
+                               grid_type & grid) const;
+
+    private:
+
+        /**
+         * @brief Maximum error of interpolated map coordinates in
+         *        kilometers.
+         *
+         * @see @c coordinate_tolerance()
+         */
+        double coordinate_tolerance_ = 0;
+
+        /**
+         * @brief Transcendental math implementation.
+         *
+         * @see @c math()
+         */
+        math_mode math_ = math_mode::exact;
 
     };
 
@@ -1,7 +1,7 @@
 /**
  * @file MapFactory_t.cpp
  *
- * Copyright (C) 2003-2004, 2017-2018, 2024  Ossama Othman
+ * Copyright (C) 2003-2004, 2017-2018, 2024, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -17,8 +17,10 @@
 #include "marc/plot_info.h"
 
 #include <type_traits>
+#include <vector>
 #include <limits>
 #include <stdexcept>
+#include <cmath>
 
 
 template <typename T>
@@ -36,27 +38,56 @@ MaRC::MapFactory::parameters<T>::get_extrema(extrema<T> const & e)
 
 // -----------------------------------------------------------------------
 
+template <typename T>
+MaRC::plot_region
+MaRC::MapFactory::map_region(source_list const & images,
+                             plot_info<T> const & info) const
+{
+    auto const samples = info.samples();
+    auto const lines   = info.lines();
+
+    /*
+      Skip map tiles in which the images cannot have data, and only
+      plot the map region covered by the images in source-driven
+      mode.
+    */
+    if (info.tile_culling())
+        return this->data_region(images,
+                                 samples,
+                                 lines,
+                                 info.source_driven());
+    else if (info.source_driven())
+        return this->map_coverage(images, samples, lines);
+
+    return plot_region(samples, lines);
+}
+
+// -----------------------------------------------------------------------
+
 template <typename T>
 MaRC::MapFactory::map_type<T>
 MaRC::MapFactory::make_map(SourceImage const & image,
                            extrema<T> const & minmax,
                            plot_info<T> & info) const
 {
-    // Set up blank value for the map.
-    auto blank = Map_traits<T>::empty_value();
+    map_type<T> map;
 
-    if (std::is_integral<T>::value && info.blank()) {
-        if (info.blank() < std::numeric_limits<T>::lowest()
-            || info.blank() > std::numeric_limits<T>::max()) {
-            throw std::invalid_argument("Blank map value does not fit "
-                                        "within map data type.");
-        }
+    this->make_map(image, minmax, info, map);
 
-        blank = static_cast<T>(*info.blank());
-    }
+    return map;
+}
+
+template <typename T>
+void
+MaRC::MapFactory::make_map(SourceImage const & image,
+                           extrema<T> const & minmax,
+                           plot_info<T> & info,
+                           map_type<T> & map) const
+{
+    // Initialize the map, reusing existing storage if available.
+    map.assign(info.samples() * info.lines(), info.blank_value());
 
-    // Set up physical data value extrema.
-    map_type<T> map(info.samples() * info.lines(), blank);
+    auto const region = this->map_region(source_list{ &image }, info);
 
     // Begin mapping.
     parameters<T> p(image, minmax, info, map);
@@ -67,12 +98,72 @@ MaRC::MapFactory::make_map(SourceImage const & image,
             this->plot(p, lat, lon, offset);
         };
 
-    this->plot_map(info.samples(), info.lines(), plot);
+    this->plot_map(region, plot);
 
     // Inform "observers" of map completion.
     info.notifier().notify_done(map.size());
+}
 
-    return map;
+template <typename T>
+void
+MaRC::MapFactory::make_maps(SourceImage const & image,
+                            extrema<T> const & minmax,
+                            plot_info<T> & info,
+                            std::vector<map_type<T>> & maps) const
+{
+    this->make_maps(source_list{ &image },
+                    extrema_list<T>{ minmax },
+                    info,
+                    maps);
+}
+
+template <typename T>
+void
+MaRC::MapFactory::make_maps(source_list const & images,
+                            extrema_list<T> const & minmax,
+                            plot_info<T> & info,
+                            std::vector<map_type<T>> & maps) const
+{
+    auto const planes = count_planes(images);
+    auto const blank  = info.blank_value();
+
+    // Initialize the maps, reusing existing storage if available.
+    maps.resize(planes);
+
+    for (auto & map : maps)
+        map.assign(info.samples() * info.lines(), blank);
+
+    auto store =
+        [&maps](std::size_t plane, std::size_t offset, T datum)
+        {
+            maps[plane][offset] = datum;
+        };
+
+    this->plot_planes(images, minmax, info, store);
+}
+
+template <typename T>
+std::size_t
+MaRC::MapFactory::make_interleaved_maps(source_list const & images,
+                                        extrema_list<T> const & minmax,
+                                        plot_info<T> & info,
+                                        map_type<T> & map) const
+{
+    auto const planes = count_planes(images);
+
+    // Initialize the map, reusing existing storage if available.
+    map.assign(info.samples() * info.lines() * planes,
+               info.blank_value());
+
+    auto store =
+        [&map, planes](std::size_t plane, std::size_t offset, T datum)
+        {
+            map[offset * planes + plane] = datum;
+        };
+
+    this->plot_planes(images, minmax, info, store);
+
+    return planes;
 }
 
 template <typename T>
@@ -106,5 +197,71 @@ MaRC::MapFactory::plot(parameters<T> & p,
     info.notifier().notify_plotted(map.size());
 }
 
+template <typename T, typename Store>
+void
+MaRC::MapFactory::plot_planes(source_list const & images,
+                              extrema_list<T> const & minmax,
+                              plot_info<T> & info,
+                              Store store) const
+{
+    if (minmax.size() != images.size())
+        throw std::invalid_argument("Number of source images and "
+                                    "extrema do not match.");
+
+    // Number of bands and valid data range of each source image.
+    std::vector<std::size_t> bands;
+    std::vector<extrema<T>> ranges;
+
+    bands.reserve(images.size());
+    ranges.reserve(images.size());
+
+    for (std::size_t i = 0; i < images.size(); ++i) {
+        bands.push_back(images[i]->bands());
+        ranges.push_back(parameters<T>::get_extrema(minmax[i]));
+    }
+
+    auto const map_size = info.samples() * info.lines();
+
+    // Data read from each plane at a given map location.
+    std::vector<double> data(count_planes(images));
+
+    auto const region = this->map_region(images, info);
+
+    auto plot =
+        [&](double lat, double lon, std::size_t offset)
+        {
+            std::size_t plane = 0;
+
+            for (std::size_t i = 0; i < images.size(); ++i) {
+                auto const n = bands[i];
+                auto const & e = ranges[i];
+
+                if (images[i]->read_bands(lat, lon, &data[plane])) {
+                    for (std::size_t b = plane; b < plane + n; ++b) {
+                        double const datum = data[b];
+
+                        // Bands with no data at this location are NaN.
+                        if (!std::isnan(datum) && e.in_range(datum)) {
+                            auto const d = static_cast<T>(datum);
+
+                            store(b, offset, d);
+                            info.update_extrema(d);
+                        }
+                    }
+                }
+
+                plane += n;
+            }
+
+            // Inform "observers" of mapping progress.
+            info.notifier().notify_plotted(map_size);
+        };
+
+    this->plot_map(region, plot);
+
+    // Inform "observers" of map completion.
+    info.notifier().notify_done(map_size);
+}
+
 
 #endif  // MARC_MAP_FACTORY_T_CPP
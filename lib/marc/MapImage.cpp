@@ -0,0 +1,141 @@
+/**
+ * @file MapImage.cpp
+ *
+ * Copyright (C) 2026  Ossama Othman
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * @author Ossama Othman
+ */
+
+#include "MapImage.h"
+#include "MapFactory.h"
+#include "BilinearInterpolation.h"
+#include "NullInterpolation.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <cmath>
+
+
+namespace
+{
+    /**
+     * @brief Pad each map line with @a pad samples from the opposite
+     *        side of the map.
+     *
+     * @throw std::invalid_argument Invalid map dimensions.
+     */
+    std::vector<double> pad_map(std::vector<double> && map,
+                                std::size_t samples,
+                                std::size_t lines,
+                                std::size_t pad)
+    {
+        if (samples < 2 || lines < 2)
+            throw std::invalid_argument("Map dimensions are too small.");
+
+        if (map.size() != samples * lines)
+            throw std::invalid_argument("Map size does not match "
+                                        "samples and lines.");
+
+        if (pad == 0)
+            return std::move(map);
+
+        auto const width = samples + 2 * pad;
+
+        std::vector<double> padded(width * lines);
+
+        for (std::size_t k = 0; k < lines; ++k) {
+            auto const first = map.cbegin() + k * samples;
+            auto const last  = first + samples;
+            auto const line  = padded.begin() + k * width;
+
+            std::copy(last - pad, last, line);
+            std::copy(first, last, line + pad);
+            std::copy(first, first + pad, line + pad + samples);
+        }
+
+        return padded;
+    }
+
+    std::unique_ptr<MaRC::InterpolationStrategy>
+    make_interpolator(std::size_t samples,
+                      std::size_t lines,
+                      bool interpolate)
+    {
+        if (!interpolate)
+            return std::make_unique<MaRC::NullInterpolation>();
+
+        // Maps have no nibbled edges.
+        constexpr std::size_t nibble = 0;
+
+        return std::make_unique<MaRC::BilinearInterpolation>(samples,
+                                                             lines,
+                                                             nibble,
+                                                             nibble,
+                                                             nibble,
+                                                             nibble);
+    }
+}
+
+MaRC::MapImage::MapImage(std::shared_ptr<MapFactory const> projection,
+                         std::vector<double> && map,
+                         std::size_t samples,
+                         std::size_t lines,
+                         bool interpolate)
+    : SourceImage()
+    , projection_(std::move(projection))
+    , samples_(samples)
+    , lines_(lines)
+    , pad_(projection_ && projection_->wraps_longitude() ? 1 : 0)
+    , map_(pad_map(std::move(map), samples, lines, pad_))
+    , interpolator_(make_interpolator(samples + 2 * pad_,
+                                      lines,
+                                      interpolate))
+{
+    if (!this->projection_)
+        throw std::invalid_argument("Null map projection.");
+}
+
+MaRC::MapImage::~MapImage() = default;
+
+bool
+MaRC::MapImage::read_data(double lat, double lon, double & data) const
+{
+    double x = 0;  // Map sample coordinate
+    double z = 0;  // Map line   coordinate
+
+    if (!this->projection_->map_coordinates(this->samples_,
+                                            this->lines_,
+                                            lat,
+                                            lon,
+                                            x,
+                                            z))
+        return false;
+
+    // The last sample and line edges are on the map as well.
+    auto const i =
+        std::min(static_cast<std::size_t>(x), this->samples_ - 1);
+    auto const k =
+        std::min(static_cast<std::size_t>(z), this->lines_ - 1);
+
+    auto const width = this->samples_ + 2 * this->pad_;
+
+    data = this->map_[k * width + i + this->pad_];
+
+    /*
+      Interpolate relative to the map pixel centers.  The nearest map
+      pixel is used where interpolation isn't possible, such as along
+      the map edges.  The padding of maps that wrap around in
+      longitude allows interpolation across the longitude seam.
+    */
+    double const xp = x + this->pad_ - 0.5;
+
+    if (xp >= 0 && z >= 0.5)
+        this->interpolator_->interpolate(this->map_.data(),
+                                         xp,
+                                         z - 0.5,
+                                         data);
+
+    return !std::isnan(data);
+}
@@ -0,0 +1,122 @@
+//   -*- C++ -*-
+/**
+ * @file MapImage.h
+ *
+ * Copyright (C) 2026  Ossama Othman
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * @author Ossama Othman
+ */
+
+#ifndef MARC_MAP_IMAGE_H
+#define MARC_MAP_IMAGE_H
+
+#include <marc/SourceImage.h>
+#include <marc/Export.h>
+
+#include <memory>
+#include <vector>
+
+
+namespace MaRC
+{
+    class MapFactory;
+    class InterpolationStrategy;
+
+    /**
+     * @class MapImage MapImage.h <marc/MapImage.h>
+     *
+     * @brief Source image backed by an existing map.
+     *
+     * This concrete @c SourceImage retrieves data from a previously
+     * created map, such as a mosaic of many photos, allowing that
+     * map to be reprojected without processing the underlying photos
+     * again.  Data is located on the map through the forward
+     * equations of the map projection used to create it.  Data is
+     * interpolated across the longitude seam of maps that wrap
+     * around in longitude.
+     *
+     * @see MapFactory::map_coordinates()
+     */
+    class MARC_API MapImage final : public SourceImage
+    {
+    public:
+
+        /// Constructor
+        /**
+         * @param[in] projection  Map projection used to create the
+         *                        map.  It must provide the forward
+         *                        projection equations.
+         * @param[in] map         Physical map data, where blank map
+         *                        pixels are @c NaN.
+         * @param[in] samples     Number of samples in the map.
+         * @param[in] lines       Number of lines   in the map.
+         * @param[in] interpolate Interpolate between map pixels.
+         *
+         * @throw std::invalid_argument Invalid map dimensions.
+         *
+         * @note No data will be retrieved if @a projection doesn't
+         *       provide the forward projection equations.
+         */
+        MapImage(std::shared_ptr<MapFactory const> projection,
+                 std::vector<double> && map,
+                 std::size_t samples,
+                 std::size_t lines,
+                 bool interpolate);
+
+        // Disallow copying.
+        MapImage(MapImage const &) = delete;
+        MapImage & operator=(MapImage const &) = delete;
+
+        // Disallow moving.
+        MapImage(MapImage &&) = delete;
+        MapImage & operator=(MapImage &&) = delete;
+
+        /// Destructor.
+        ~MapImage() override;
+
+        /**
+         * @brief Retrieve data from the map.
+         *
+         * @see MaRC::SourceImage::read_data().
+         */
+        bool read_data(double lat,
+                       double lon,
+                       double & data) const override;
+
+    private:
+
+        /// Map projection used to create the map.
+        std::shared_ptr<MapFactory const> const projection_;
+
+        /// Number of samples in the map.
+        std::size_t const samples_;
+
+        /// Number of lines in the map.
+        std::size_t const lines_;
+
+        /**
+         * @brief Number of samples copied to each side of the map.
+         *
+         * Each line of a map that wraps around in longitude is
+         * padded with the map sample from the opposite side of the
+         * map so that interpolation across the longitude seam reads
+         * contiguous map data.
+         *
+         * @see MapFactory::wraps_longitude()
+         */
+        std::size_t const pad_;
+
+        /// Physical map data, including padding.
+        std::vector<double> const map_;
+
+        /// Strategy used to interpolate between map pixels.
+        std::unique_ptr<InterpolationStrategy> const interpolator_;
+
+    };
+
+} // End MaRC namespace
+
+
+#endif  /* MARC_MAP_IMAGE_H */
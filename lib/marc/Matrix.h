@@ -4,7 +4,7 @@
  *
  * %MaRC matrix class and operations.
  *
- * Copyright (C) 2004, 2017-2018, 2021-2022, 2024  Ossama Othman
+ * Copyright (C) 2004, 2017-2018, 2021-2022, 2024, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -19,6 +19,7 @@
 #include <type_traits>
 #include <algorithm>
 #include <iterator>
+#include <utility>
 #include <stdexcept>
 
 
@@ -71,7 +72,7 @@ namespace MaRC
         ///@}
 
         /// Constructor.
-        Matrix()
+        constexpr Matrix()
             : matrix_{}
         {
             static_assert(std::is_arithmetic<T>(),
@@ -326,6 +327,104 @@ namespace MaRC
 
     // ---------------------------------------------------------
 
+    namespace details
+    {
+        /**
+         * @brief Unrolled dot product of a matrix row and a column of
+         *        another matrix.
+         *
+         * The products are summed from left to right, in the same
+         * order as a loop over the row, so results are unchanged to
+         * the last bit.
+         *
+         * @note This function is not part of the public %MaRC
+         *       library API.
+         */
+        template <typename T,
+                  std::size_t M,
+                  std::size_t N,
+                  std::size_t R,
+                  std::size_t ... I>
+        constexpr T row_column(Matrix<T, M, N> const & A,
+                               Matrix<T, N, R> const & B,
+                               std::size_t row,
+                               std::size_t column,
+                               std::index_sequence<I ...>)
+        {
+            return (T(0) + ... + (A(row, I) * B(I, column)));
+        }
+
+        /**
+         * @brief Unrolled matrix/matrix multiplication.
+         *
+         * @tparam I Flattened row-major indices of the elements of
+         *           the resulting matrix.
+         *
+         * @note This function is not part of the public %MaRC
+         *       library API.
+         */
+        template <typename T,
+                  std::size_t M,
+                  std::size_t N,
+                  std::size_t R,
+                  std::size_t ... I>
+        constexpr Matrix<T, M, R> multiply(Matrix<T, M, N> const & A,
+                                           Matrix<T, N, R> const & B,
+                                           std::index_sequence<I ...>)
+        {
+            Matrix<T, M, R> C;
+
+            ((C(I / R, I % R) =
+              row_column(A, B, I / R, I % R, std::make_index_sequence<N>())),
+             ...);
+
+            return C;
+        }
+
+        /**
+         * @brief Unrolled dot product of a matrix row and a vector.
+         *
+         * The products are summed from left to right.
+         *
+         * @note This function is not part of the public %MaRC
+         *       library API.
+         */
+        template <typename T,
+                  std::size_t M,
+                  std::size_t N,
+                  std::size_t ... I>
+        constexpr T row_vector(Matrix<T, M, N> const & A,
+                               Vector<T, N> const & x,
+                               std::size_t row,
+                               std::index_sequence<I ...>)
+        {
+            return (T(0) + ... + (A(row, I) * x[I]));
+        }
+
+        /**
+         * @brief Unrolled matrix/vector multiplication.
+         *
+         * The resulting vector is constructed directly from the
+         * products of each matrix row and the vector, allowing
+         * composite expressions such as @c A*(b-c) to be evaluated
+         * entirely in registers.
+         *
+         * @note This function is not part of the public %MaRC
+         *       library API.
+         */
+        template <typename T,
+                  std::size_t M,
+                  std::size_t N,
+                  std::size_t ... I>
+        constexpr Vector<T, M> multiply(Matrix<T, M, N> const & A,
+                                        Vector<T, N> const & x,
+                                        std::index_sequence<I ...>)
+        {
+            return Vector<T, M>(
+                row_vector(A, x, I, std::make_index_sequence<N>()) ...);
+        }
+    }
+
     /**
      * @brief Matrix transpose.
      *
@@ -383,21 +482,13 @@ MaRC::Matrix<T, M, N> operator-(MaRC::Matrix<T, M, N> const & lhs,
  * @relates MaRC::Matrix
  */
 template <typename T, std::size_t M, std::size_t N, std::size_t R>
-MaRC::Matrix<T, M, R> operator*(MaRC::Matrix<T, M, N> const & lhs,
-                                MaRC::Matrix<T, N, R> const & rhs)
+constexpr MaRC::Matrix<T, M, R>
+operator*(MaRC::Matrix<T, M, N> const & lhs,
+          MaRC::Matrix<T, N, R> const & rhs)
 {
-    MaRC::Matrix<T, M, R> matrix;
-
-    for (std::size_t m = 0; m < M; ++m) {
-        for (std::size_t r = 0; r < R; ++r) {
-            T & element = matrix(m, r); // Already default initialized.
-
-            for (std::size_t n = 0; n < N; ++n)
-                element += lhs(m, n) * rhs(n, r);
-        }
-    }
-
-    return matrix;
+    return MaRC::details::multiply(lhs,
+                                   rhs,
+                                   std::make_index_sequence<M * R>());
 }
 
 /**
@@ -406,16 +497,10 @@ MaRC::Matrix<T, M, R> operator*(MaRC::Matrix<T, M, N> const & lhs,
  * @relates MaRC::Matrix
  */
 template <typename T, std::size_t M, std::size_t N>
-MaRC::Vector<T, M> operator*(MaRC::Matrix<T, M, N> const & A,
-                             MaRC::Vector<T, N> const & x)
+constexpr MaRC::Vector<T, M> operator*(MaRC::Matrix<T, M, N> const & A,
+                                       MaRC::Vector<T, N> const & x)
 {
-    MaRC::Vector<T, M> v;
-
-    for (std::size_t m = 0; m < M; ++m)
-        for (std::size_t n = 0; n < N; ++n)
-            v[m] += A(m, n) * x[n];
-
-    return v;
+    return MaRC::details::multiply(A, x, std::make_index_sequence<M>());
 }
 
 /**
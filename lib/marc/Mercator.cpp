@@ -1,7 +1,7 @@
 /**
  * @file Mercator.cpp
  *
- * Copyright (C) 1999, 2004, 2017-2019  Ossama Othman
+ * Copyright (C) 1999, 2004, 2017-2019, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -12,7 +12,6 @@
 #include "Constants.h"
 #include "DefaultConfiguration.h"
 #include "Mathematics.h"
-#include "root_find.h"
 #include "OblateSpheroid.h"
 // #include "marc/config.h"  // For NDEBUG and FMT_HEADER_ONLY
 
@@ -58,6 +57,7 @@ namespace
 MaRC::Mercator::Mercator(std::shared_ptr<OblateSpheroid> body)
     : MapFactory()
     , body_(std::move(body))
+    , conformal_(body_->first_eccentricity())
 {
     using namespace MaRC::default_configuration;
 
@@ -87,12 +87,56 @@ MaRC::Mercator::projection_name() const
     return "Mercator";
 }
 
+bool
+MaRC::Mercator::map_coordinates(std::size_t samples,
+                                std::size_t lines,
+                                double lat,
+                                double lon,
+                                double & sample,
+                                double & line) const
+{
+    using namespace MaRC::default_configuration;
+
+    static constexpr double lo_lon = longitude_low * C::degree;
+
+    // Invert the longitude computation in get_longitude().
+    // PROGRADE ----> longitudes increase to the left
+    // RETROGRADE --> longitudes increase to the right
+    auto lon_shift =
+        std::fmod(this->body_->prograde()
+                  ? C::_2pi - lon - lo_lon
+                  : lon - lo_lon,
+                  C::_2pi);
+
+    if (lon_shift < 0)
+        lon_shift += C::_2pi;
+
+    // See plot_map() for the derivation of xmax.
+    double const xmax =
+        static_cast<double>(lines) / samples * C::pi;
+
+    double const x =
+        mercator_x(*this->body_, this->body_->graphic_latitude(lat));
+
+    sample = lon_shift / C::_2pi * samples;
+    line   = (x + xmax) / (2 * xmax) * lines;
+
+    // The poles are at infinity.
+    return std::isfinite(line) && line >= 0 && line <= lines;
+}
+
+bool
+MaRC::Mercator::wraps_longitude() const
+{
+    return true;  // Mercator maps always span 360 degrees.
+}
+
 void
-MaRC::Mercator::plot_map(std::size_t samples,
-                         std::size_t lines,
+MaRC::Mercator::plot_map(plot_region const & region,
                          plot_type const & plot) const
 {
-    std::size_t offset = 0;
+    auto const samples = region.samples();
+    auto const lines   = region.lines();
 
     /**
      * @todo Confirm that the following calculation is correct.
@@ -115,50 +159,35 @@ MaRC::Mercator::plot_map(std::size_t samples,
     double const xmax =
         static_cast<double>(lines) / samples * C::pi;
 
-    auto const map_equation =
-        [&](double latg){ return mercator_x(*this->body_, latg); };
-
     for (std::size_t k = 0; k < lines; ++k) {
+        auto const spans = region.spans(k);
+
+        if (spans.empty())
+            continue;
+
         double const x = (k + 0.5) / lines * 2 * xmax - xmax;
 
-        /**
-         * @todo We shouldn't have to search from pole-to-pole for
-         *       the latitude that gives us the above value for @c x.
-         *       Try to get the root finding code to work with the
-         *       initial guess instead, or at the very least reduce
-         *       the size of the search bracket.
-         */
-
-        // Obtain initial guess from inverse Mercator equation for a
-        // sphere (first eccentricity is zero).
-        // double const latg_guess = -C::pi_2 + 2 * std::atan(std::exp(x));
-
-        // double const ll = latg_guess - 0.5;
-        // double const ul = latg_guess + 0.5;
-        double const ll = -C::pi_2;
-        double const ul =  C::pi_2;
-
-        /**
-         * @todo Pass in a function that directly computes the first
-         *       derivative of the Mercator equation, without relying
-         *       on numerical differentation techniques, to speed up
-         *       root finding and improve accuracy.
-         */
-        // planetoGRAPHIC latitude.
-        double const latg =
-            MaRC::root_find(x, ll, ul, map_equation);
-
-        // MaRC::debug("latg_guess, latg) = ({}, {})", latg_guess, latg);
+        /*
+          The Mercator equation for an oblate spheroid is that of a
+          sphere in terms of the conformal latitude, i.e. "x" is the
+          isometric latitude.  Invert the spherical equation, and
+          convert the resulting conformal latitude to a
+          planetoGRAPHIC latitude.
+        */
+        double const chi = std::atan(std::sinh(x));
+        double const latg = this->conformal_.graphic(chi);
 
         // MaRC::debug("(line, latg) = ({}, {})", k, latg / C::degree);
 
         // Convert to planetoCENTRIC latitude
         double const lat = this->body_->centric_latitude(latg);
 
-        for (std::size_t i = 0; i < samples; ++i, ++offset) {
-            double const lon = this->get_longitude(i, samples);
+        for (auto const & s : spans) {
+            for (auto i = s.first; i < s.last; ++i) {
+                double const lon = this->get_longitude(i, samples);
 
-            plot(lat, lon, offset);
+                plot(lat, lon, k * samples + i);
+            }
         }
     }
 }
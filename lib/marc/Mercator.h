@@ -2,7 +2,7 @@
 /**
  * @file Mercator.h
  *
- * Copyright (C) 1999, 2004, 2017-2018  Ossama Othman
+ * Copyright (C) 1999, 2004, 2017-2018, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -13,6 +13,7 @@
 #define MARC_MERCATOR_H
 
 #include <marc/MapFactory.h>
+#include <marc/conformal_latitude.h>
 
 #include <memory>
 
@@ -78,6 +79,15 @@ namespace MaRC
          */
         ///@{
         char const * projection_name() const override;
+
+        bool map_coordinates(std::size_t samples,
+                             std::size_t lines,
+                             double lat,
+                             double lon,
+                             double & sample,
+                             double & line) const override;
+
+        bool wraps_longitude() const override;
         ///@}
 
         /**
@@ -95,8 +105,7 @@ namespace MaRC
          *
          * @see @c MaRC::MapFactory::plot_map().
          */
-        void plot_map(std::size_t samples,
-                      std::size_t lines,
+        void plot_map(plot_region const & region,
                       plot_type const & plot) const override;
 
         /**
@@ -126,6 +135,9 @@ namespace MaRC
         /// mapped.
         std::shared_ptr<OblateSpheroid> const body_;
 
+        /// Conformal latitude conversion for the body.
+        conformal_latitude const conformal_;
+
     };
 
 }
@@ -1,7 +1,7 @@
 /**
  * @file MosaicImage.cpp
  *
- * Copyright (C) 2003-2004, 2017, 2020-2021  Ossama Othman
+ * Copyright (C) 2003-2004, 2017, 2020-2021, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -17,7 +17,14 @@ MaRC::MosaicImage::MosaicImage(
     std::unique_ptr<compositing_strategy> compositor)
     : images_(std::move(images))
     , compositor_(std::move(compositor))
+    , firsts_()
 {
+    std::size_t first = 0;
+
+    for (auto const & image : this->images_) {
+        this->firsts_.push_back(first);
+        first += image->resampling_sources().size();
+    }
 }
 
 bool
@@ -28,3 +35,84 @@ MaRC::MosaicImage::read_data(double lat,
     return
         this->compositor_->composite(this->images_, lat, lon, data) > 0;
 }
+
+std::vector<std::uint64_t>
+MaRC::MosaicImage::resampling_sources() const
+{
+    std::vector<std::uint64_t> sources;
+
+    for (auto const & image : this->images_) {
+        auto const s = image->resampling_sources();
+
+        if (s.empty())
+            return {};  // Resampling plans not supported by all images.
+
+        sources.insert(sources.end(), s.cbegin(), s.cend());
+    }
+
+    return sources;
+}
+
+bool
+MaRC::MosaicImage::read_taps(double lat,
+                             double lon,
+                             std::size_t first,
+                             ResamplingPlan::tap_list & taps,
+                             double & /* weight */,
+                             bool /* scan */) const
+{
+    auto const begin = taps.size();
+
+    if (this->compositor_->composite(this->images_,
+                                     this->firsts_,
+                                     lat,
+                                     lon,
+                                     taps) == 0)
+        return false;
+
+    // Account for the mosaic's own position in the resampling plan.
+    for (auto t = begin; t < taps.size(); ++t)
+        taps[t].image += first;
+
+    return true;
+}
+
+bool
+MaRC::MosaicImage::resampling_data(std::size_t band,
+                                   ResamplingPlan::source_list & data) const
+{
+    if (band != 0)
+        return false;
+
+    auto const size = data.size();
+
+    for (auto const & image : this->images_) {
+        if (!image->resampling_data(band, data)) {
+            data.resize(size);  // Drop partially retrieved data.
+
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool
+MaRC::MosaicImage::footprint(footprint_visitor const & visit) const
+{
+    for (auto const & image : this->images_)
+        if (!image->footprint(visit))
+            return false;
+
+    return true;
+}
+
+bool
+MaRC::MosaicImage::visibility_bounds(std::vector<body_cap> & caps) const
+{
+    for (auto const & image : this->images_)
+        if (!image->visibility_bounds(caps))
+            return false;
+
+    return true;
+}
@@ -2,7 +2,7 @@
 /**
  * @file MosaicImage.h
  *
- * Copyright (C) 2003-2004, 2017-2018, 2021  Ossama Othman
+ * Copyright (C) 2003-2004, 2017-2018, 2021, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -77,6 +77,64 @@ namespace MaRC
                        double lon,
                        double & data) const override;
 
+        /// Get the sizes of all mosaic images.
+        /**
+         * @return The sizes of the images underlying each mosaic
+         *         image, in order, or an empty list if any of them
+         *         do not support resampling plans.
+         *
+         * @see @c MaRC::SourceImage::resampling_sources()
+         */
+        std::vector<std::uint64_t> resampling_sources() const override;
+
+        /// Retrieve the pixels contributing to the composited data
+        /// at a given latitude and longitude.
+        /**
+         * The configured data compositing strategy determines the
+         * weight of the pixels from each mosaic image.
+         *
+         * @see @c MaRC::SourceImage::read_taps()
+         */
+        bool read_taps(double lat,
+                       double lon,
+                       std::size_t first,
+                       ResamplingPlan::tap_list & taps,
+                       double & weight,
+                       bool scan) const override;
+
+        /// Retrieve the data of all mosaic images.
+        /**
+         * Mosaics have a single band, composited from the first
+         * band of each mosaic image.
+         *
+         * @see @c MaRC::SourceImage::resampling_data()
+         */
+        bool resampling_data(
+            std::size_t band,
+            ResamplingPlan::source_list & data) const override;
+
+        /// Visit the footprints of all mosaic images.
+        /**
+         * @retval true  The footprints of all images were visited.
+         * @retval false The footprint of at least one image is not
+         *               known.
+         *
+         * @see @c MaRC::SourceImage::footprint()
+         */
+        bool footprint(footprint_visitor const & visit) const override;
+
+        /// Bound the regions of the body in all mosaic images.
+        /**
+         * @retval true  All mosaic images only have data within the
+         *               appended caps.
+         * @retval false At least one mosaic image may have data
+         *               anywhere on the body.
+         *
+         * @see @c MaRC::SourceImage::visibility_bounds()
+         */
+        bool visibility_bounds(
+            std::vector<body_cap> & caps) const override;
+
     private:
 
         /// Set of images
@@ -85,6 +143,14 @@ namespace MaRC
         /// Data compositing strategy.
         std::unique_ptr<compositing_strategy const> const compositor_;
 
+        /**
+         * @brief Index of the first underlying image of each mosaic
+         *        image in a resampling plan.
+         *
+         * @see @c resampling_sources()
+         */
+        std::vector<std::size_t> firsts_;
+
     };
 
 } // End MaRC namespace
@@ -1,7 +1,7 @@
 /**
  * @file NullInterpolation.cpp
  *
- * Copyright (C) 2004, 2017  Ossama Othman
+ * Copyright (C) 2004, 2017, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -19,3 +19,13 @@ MaRC::NullInterpolation::interpolate(double const *,
 {
     return true;
 }
+
+bool
+MaRC::NullInterpolation::weights(double,
+                                 double,
+                                 weights_type & weights) const
+{
+    weights = { 1, 0, 0, 0 };
+
+    return true;
+}
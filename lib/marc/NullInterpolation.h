@@ -2,7 +2,7 @@
 /**
  * @file NullInterpolation.h
  *
- * Copyright (C) 2004-2005, 2017  Ossama Othman
+ * Copyright (C) 2004-2005, 2017, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -40,6 +40,14 @@ namespace MaRC
                          double,
                          double &) const override;
 
+        /// Select the pixel containing the given pixel coordinate.
+        /**
+         * @see @c InterpolationStrategy::weights()
+         */
+        bool weights(double,
+                     double,
+                     weights_type & weights) const override;
+
     };
 
 }
@@ -1,7 +1,7 @@
 /**
  * @file NullPhotometricCorrection.cpp
  *
- * Copyright (C) 1999, 2003-2004, 2017  Ossama Othman
+ * Copyright (C) 1999, 2003-2004, 2017, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -17,3 +17,9 @@ MaRC::NullPhotometricCorrection::correct(ViewingGeometry const &,
 {
     return true;
 }
+
+bool
+MaRC::NullPhotometricCorrection::identity() const
+{
+    return true;
+}
@@ -2,7 +2,7 @@
 /**
  * @file NullPhotometricCorrection.h
  *
- * Copyright (C) 2003-2004, 2017  Ossama Othman
+ * Copyright (C) 2003-2004, 2017, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -41,6 +41,7 @@ namespace MaRC
          * base class.
          *
          * @see @c PhotometricCorrection::correct()
+         * @see @c PhotometricCorrection::identity()
          */
         ///@{
         /**
@@ -52,6 +53,13 @@ namespace MaRC
          */
         bool correct(ViewingGeometry const & geometry,
                      double & data) override;
+
+        /**
+         * @brief Does this strategy leave the data unchanged?
+         *
+         * @return @c true in all cases.
+         */
+        bool identity() const override;
         ///@}
 
     };
@@ -1,7 +1,7 @@
 /**
  * @file OblateSpheroid.cpp
  *
- * Copyright (C) 1999, 2003-2004, 2017-2018  Ossama Othman
+ * Copyright (C) 1999, 2003-2004, 2017-2018, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -10,9 +10,12 @@
 
 #include "OblateSpheroid.h"
 #include "Vector.h"
+#include "vector_batch.h"
 #include "Mathematics.h"
 #include "config.h"  // For NDEBUG.
 
+#include <algorithm>
+#include <limits>
 #include <stdexcept>
 #include <cmath>
 #include <cassert>
@@ -33,10 +36,21 @@ namespace
 MaRC::OblateSpheroid::OblateSpheroid(bool prograde,
                                      double eq_rad,
                                      double pol_rad)
+    : OblateSpheroid(prograde, eq_rad, pol_rad, false)
+{
+}
+
+MaRC::OblateSpheroid::OblateSpheroid(bool prograde,
+                                     double eq_rad,
+                                     double pol_rad,
+                                     bool sphere)
     : BodyData(prograde)
     , eq_rad_(validate_radius(eq_rad))
     , pol_rad_(validate_radius(pol_rad))
-    , first_eccentricity_(std::sqrt(1 - std::pow(pol_rad / eq_rad, 2)))
+    , centric_ratio_((pol_rad / eq_rad) * (pol_rad / eq_rad))
+    , graphic_ratio_((eq_rad / pol_rad) * (eq_rad / pol_rad))
+    , first_eccentricity_(std::sqrt(1 - centric_ratio_))
+    , sphere_(sphere)
 {
     // a >= c for oblate spheroid.
     if (eq_rad < pol_rad)
@@ -104,9 +118,7 @@ MaRC::OblateSpheroid::centric_latitude(double latg) const
                                     2
                  (equatorial radius)
     */
-    return
-        std::atan(std::pow(this->pol_rad_ / this->eq_rad_, 2)
-                  * std::tan(latg));
+    return std::atan(this->centric_ratio_ * std::tan(latg));
 }
 
 double
@@ -119,9 +131,7 @@ MaRC::OblateSpheroid::graphic_latitude(double lat) const
                                    2
                      (polar radius)
     */
-    return
-        std::atan(std::pow(this->eq_rad_ / this->pol_rad_, 2)
-                  * std::tan(lat));
+    return std::atan(this->graphic_ratio_ * std::tan(lat));
 }
 
 double
@@ -201,6 +211,78 @@ MaRC::OblateSpheroid::cos_phase(double sub_observ_lat,
                    std::cos(lat) * std::cos(sub_observ_lon - lon)));
 }
 
+void
+MaRC::OblateSpheroid::photometric_cosines(double sub_observ_lat,
+                                          double sub_observ_lon,
+                                          double sub_solar_lat,
+                                          double sub_solar_lon,
+                                          double lat,
+                                          double lon,
+                                          double range,
+                                          double & mu,
+                                          double & mu0,
+                                          double & cos_phase) const
+{
+    /*
+      Same equations as mu(), mu0() and cos_phase() above, with the
+      trigonometric terms common to all of them computed only once.
+    */
+    double const sin_lat = std::sin(lat);
+    double const cos_lat = std::cos(lat);
+
+    double const ellipse_radius =
+        1 / std::hypot(cos_lat / this->eq_rad_,
+                       sin_lat / this->pol_rad_);
+
+    /*
+      The planetographic latitude satisfies
+
+                                       2
+                    (equatorial radius)
+        tan(latg) = -------------------- * tan(lat)
+                                     2
+                       (polar radius)
+
+      so its sine and cosine follow directly from those of the
+      planetocentric latitude without calling atan().  The cosine of
+      both latitudes is non-negative.
+    */
+    double const k = this->graphic_ratio_;
+    double const h = std::hypot(cos_lat, k * sin_lat);
+    double const sin_latg = k * sin_lat / h;
+    double const cos_latg = cos_lat / h;
+
+    // cos(lat - latg)
+    double const cos_dlat = cos_lat * cos_latg + sin_lat * sin_latg;
+
+    double const sin_so = std::sin(sub_observ_lat);
+    double const cos_so = std::cos(sub_observ_lat);
+    double const sin_ss = std::sin(sub_solar_lat);
+    double const cos_ss = std::cos(sub_solar_lat);
+
+    double const cos_observ_dlon = std::cos(sub_observ_lon - lon);
+    double const cos_solar_dlon  = std::cos(sub_solar_lon - lon);
+
+    // Magnitude of vector from observer to point on body.
+    double const distance =
+        std::sqrt(range * range + ellipse_radius * ellipse_radius
+                  - 2 * range * ellipse_radius *
+                  (sin_so * sin_lat + cos_so * cos_lat * cos_observ_dlon));
+
+    mu =
+        (range * sin_so * sin_latg
+         - ellipse_radius * cos_dlat
+         + range * cos_so * cos_latg * cos_observ_dlon) / distance;
+
+    mu0 = sin_ss * sin_latg + cos_ss * cos_latg * cos_solar_dlon;
+
+    cos_phase =
+        (range * (cos_so * cos_ss * std::cos(sub_observ_lon - sub_solar_lon)
+                  + sin_so * sin_ss)
+         - ellipse_radius * (cos_lat * cos_ss * cos_solar_dlon
+                             + sin_lat * sin_ss)) / distance;
+}
+
 double
 MaRC::OblateSpheroid::M(double lat)
 {
@@ -317,3 +399,90 @@ MaRC::OblateSpheroid::ellipse_intersection(DVector const & vec,
 
     return 0; // Successful
 }
+
+void
+MaRC::OblateSpheroid::ellipse_intersection(
+    DVector const & vec,
+    vector_batch const & dvec,
+    std::vector<double> & lat,
+    std::vector<double> & lon) const
+{
+    auto const n = dvec.size();
+
+    lat.resize(n);
+    lon.resize(n);
+
+    /*
+      Same approach as the single line ellipse_intersection() above,
+      split into an arithmetic pass over the batch that the compiler
+      can auto-vectorize, and a pass with the inverse trigonometric
+      functions.  The line terms that only depend on the common point
+      "vec" are computed once.
+    */
+    double const semis[] = {
+        this->eq_rad_, this->eq_rad_, this->pol_rad_
+    };
+
+    double const vx = vec[0] / semis[0];
+    double const vy = vec[1] / semis[1];
+    double const vz = vec[2] / semis[2];
+
+    double const c = vx * vx + vy * vy + vz * vz - 1;
+
+    double const * const dx = dvec.x();
+    double const * const dy = dvec.y();
+    double const * const dz = dvec.z();
+
+    // Points of intersection, reusing the output arrays for the x
+    // and y components.
+    double * const px = lat.data();
+    double * const py = lon.data();
+    std::vector<double> pz(n);
+
+    constexpr auto not_a_number =
+        std::numeric_limits<double>::quiet_NaN();
+
+    for (std::size_t i = 0; i < n; ++i) {
+        double const m1x = dx[i] / semis[0];
+        double const m1y = dy[i] / semis[1];
+        double const m1z = dz[i] / semis[2];
+
+        double const a = m1x * m1x + m1y * m1y + m1z * m1z;
+        double const b = 2 * (m1x * vx + m1y * vy + m1z * vz);
+
+        double const discriminant = b * b - 4 * a * c;
+
+        // See MaRC::quadratic_roots().  The root closest to "vec" is
+        // c / q.
+        double const root = std::sqrt(std::max(discriminant, 0.));
+        double const q = -(b + (b < 0 ? -root : root)) / 2;
+
+        double const k =
+            (discriminant < 0 || !(a > 0)) ? not_a_number : c / q;
+
+        px[i] = vec[0] + k * dx[i];
+        py[i] = vec[1] + k * dy[i];
+        pz[i] = vec[2] + k * dz[i];
+    }
+
+    for (std::size_t i = 0; i < n; ++i) {
+        double const x = px[i];
+        double const y = py[i];
+
+        // NaN propagates where there is no intersection.
+        lat[i] = std::atan(pz[i] / std::hypot(x, y));
+        lon[i] = std::atan2(x, -y);
+    }
+}
+
+void
+MaRC::OblateSpheroid::centric_radius(std::vector<double> const & lat,
+                                     std::vector<double> & radius) const
+{
+    radius.resize(lat.size());
+
+    // See the single latitude centric_radius() above.
+    for (std::size_t i = 0; i < lat.size(); ++i)
+        radius[i] = 1 / std::hypot(std::cos(lat[i]) / this->eq_rad_,
+                                   std::sin(lat[i]) / this->pol_rad_);
+}
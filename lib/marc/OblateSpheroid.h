@@ -2,7 +2,7 @@
 /**
  * @file OblateSpheroid.h
  *
- * Copyright (C) 1999, 2003-2004, 2017-2018  Ossama Othman
+ * Copyright (C) 1999, 2003-2004, 2017-2018, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -16,12 +16,16 @@
 #include <marc/Vector.h>
 #include <marc/Export.h>
 
+#include <vector>
+
 
 namespace MaRC
 {
     /// Internal convenience type.
     using DVector = Vector<double, 3>;
 
+    class vector_batch;
+
     /**
      * @class OblateSpheroid OblateSpheroid.h <marc/OblateSpheroid.h>
      *
@@ -29,8 +33,11 @@ namespace MaRC
      *
      * An oblate spheroid is an ellipsoidal body with potentially
      * different equatorial and polar radii.
+     *
+     * @see MaRC::Sphere for bodies with equal equatorial and polar
+     *      radii.
      */
-    class MARC_API OblateSpheroid final : public BodyData
+    class MARC_API OblateSpheroid : public BodyData
     {
     public:
 
@@ -81,6 +88,19 @@ namespace MaRC
             return this->first_eccentricity_;
         }
 
+        /**
+         * @brief Is this body a @c MaRC::Sphere?
+         *
+         * @note An @c OblateSpheroid with equal equatorial and polar
+         *       radii is not a @c MaRC::Sphere.
+         *
+         * @see MaRC::visit_body()
+         */
+        bool is_sphere() const noexcept
+        {
+            return this->sphere_;
+        }
+
         /**
          * @name MaRC::BodyData Virtual Methods
          *
@@ -112,6 +132,17 @@ namespace MaRC
                          double lat,
                          double lon,
                          double range) const override;
+
+        void photometric_cosines(double sub_observ_lat,
+                                 double sub_observ_lon,
+                                 double sub_solar_lat,
+                                 double sub_solar_lon,
+                                 double lat,
+                                 double lon,
+                                 double range,
+                                 double & mu,
+                                 double & mu0,
+                                 double & cos_phase) const override;
         ///@}
 
         /// Radius of curvature of the meridian.
@@ -157,6 +188,55 @@ namespace MaRC
                                  double & lat,
                                  double & lon) const;
 
+        /**
+         * @brief Intersection of tri-axial ellipsoid with a batch of
+         *        lines through a common point.
+         *
+         * Batch variant of @c ellipse_intersection() for lines
+         * \f$\vec{line_i} = \vec{vec} + k * \vec{dvec_i}\f$, such as
+         * the lines of sight from an observer through each pixel on
+         * an image line.
+         *
+         * @param[in]  vec  Vector from ellipsoid center to observer.
+         * @param[in]  dvec Vectors along each line.
+         * @param[out] lat  Planetocentric latitudes in radians, or
+         *                  @c NaN where there is no intersection.
+         * @param[out] lon  Planetocentric east longitudes in radians,
+         *                  or @c NaN where there is no intersection.
+         */
+        void ellipse_intersection(DVector const & vec,
+                                  vector_batch const & dvec,
+                                  std::vector<double> & lat,
+                                  std::vector<double> & lon) const;
+
+        /**
+         * @brief Compute the radii of the body at a batch of
+         *        latitudes.
+         *
+         * @param[in]  lat    Planetocentric latitudes in radians.
+         * @param[out] radius Radii at the corresponding latitudes.
+         *
+         * @see centric_radius()
+         */
+        void centric_radius(std::vector<double> const & lat,
+                            std::vector<double> & radius) const;
+
+    protected:
+
+        /// Constructor
+        /**
+         * @param[in] prograde   Flag that states whether body
+         *                       rotation is prograde or retrograde.
+         * @param[in] eq_rad     Equatorial radius in kilometers.
+         * @param[in] pol_rad    Polar radius in kilometers.
+         * @param[in] sphere     Flag that states whether this object
+         *                       is a @c MaRC::Sphere.
+         */
+        OblateSpheroid(bool prograde,
+                       double eq_rad,
+                       double pol_rad,
+                       bool sphere);
+
     private:
 
         /// Equatorial radius (kilometers).
@@ -165,6 +245,26 @@ namespace MaRC
         /// Polar radius (kilometers).
         double const pol_rad_;
 
+        /**
+         * @brief Square of the ratio of the polar radius to the
+         *        equatorial radius.
+         *
+         * Planetographic latitudes are converted to planetocentric
+         * latitudes through
+         * \f$\tan(lat) = (\frac{c}{a})^2 \tan(latg)\f$.
+         */
+        double const centric_ratio_;
+
+        /**
+         * @brief Square of the ratio of the equatorial radius to the
+         *        polar radius.
+         *
+         * Planetocentric latitudes are converted to planetographic
+         * latitudes through
+         * \f$\tan(latg) = (\frac{a}{c})^2 \tan(lat)\f$.
+         */
+        double const graphic_ratio_;
+
         /// First eccentricity.
         /**
          * A measure of the oblate spheroid's deviation from being
@@ -178,6 +278,9 @@ namespace MaRC
          */
         double const first_eccentricity_;
 
+        /// Is this object a @c MaRC::Sphere?
+        bool const sphere_;
+
   };
 
 }
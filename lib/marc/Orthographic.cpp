@@ -1,7 +1,7 @@
 /**
  * @file Orthographic.cpp
  *
- * Copyright (C) 1996-1997, 1999, 2003-2004, 2017-2020  Ossama Othman
+ * Copyright (C) 1996-1997, 1999, 2003-2004, 2017-2020, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -21,8 +21,8 @@
 #include <algorithm>
 #include <memory>
 #include <limits>
-
-#include <sys/types.h>
+#include <numeric>
+#include <vector>
 
 
 namespace MaRC
@@ -86,65 +86,6 @@ namespace MaRC
         double line_center_;
 
     };
-
-    /**
-     * @class ortho_grid_parameters
-     *
-     * @brief Map grid parameters specific to a chosen map size.
-     */
-    class ortho_grid_parameters
-    {
-    public:
-
-        /// Constructor.
-        ortho_grid_parameters(DMatrix const & body2obs,
-                              double lat_interval,
-                              double lon_interval,
-                              ortho_map_parameters const & parameters)
-            : body2obs_(body2obs)
-            , lat_interval_(lat_interval)
-            , lon_interval_(lon_interval)
-            , parameters_(parameters)
-        {
-        }
-
-        /// Get map grid latitude line interval.
-        auto const & body2obs() const { return this->body2obs_; }
-
-        /// Get map grid latitude line interval.
-        auto lat_interval() const { return this->lat_interval_; }
-
-        /// Get map grid longitude line interval.
-        auto lon_interval() const { return this->lon_interval_; }
-
-        /// Get underlying map size specific map parameters.
-        auto const & parameters() const
-        {
-            return this->parameters_;
-        }
-
-        /// Value to be plotted on map grid.
-        static constexpr auto white()
-        {
-            return std::numeric_limits<
-                typename Orthographic::grid_type::value_type>::max();
-        }
-
-    private:
-
-        /// Body-to-observer coordinate transformation matrix.
-        DMatrix const body2obs_;
-
-        /// Map grid latitude interval.
-        double const lat_interval_;
-
-        /// Map grid longitude interval.
-        double const lon_interval_;
-
-        /// Map parameters.
-        ortho_map_parameters const & parameters_;
-
-    };
 }
 
 // -------------------------------------------------------------------
@@ -296,302 +237,369 @@ MaRC::Orthographic::projection_name() const
     return "Orthographic";
 }
 
-void
-MaRC::Orthographic::plot_map(std::size_t samples,
-                             std::size_t lines,
-                             plot_type const & plot) const
+bool
+MaRC::Orthographic::map_coordinates(std::size_t samples,
+                                    std::size_t lines,
+                                    double lat,
+                                    double lon,
+                                    double & sample,
+                                    double & line) const
 {
+    /*
+      Invert the steps in plot_map(), i.e. transform the point on the
+      surface of the body at the given latitude and longitude from
+      body coordinates back to image coordinates.
+    */
     ortho_map_parameters mp;
 
     this->map_parameters(samples, lines, mp);
 
-    DVector ImgCoord, Rotated;
+    double const radius = this->body_->centric_radius(lat);
+    double const rho    = radius * std::cos(lat);
 
-    DMatrix const rotY(MaRC::Geometry::RotYMatrix(-this->PA_));
-    DMatrix const rotX(MaRC::Geometry::RotXMatrix(this->sub_observ_lat_));
+    // Angle satisfying the longitude equation in plot_map().
+    double const alpha =
+        (this->body_->prograde()
+         ? this->sub_observ_lon_ - lon + C::pi
+         : lon - this->sub_observ_lon_ + C::pi);
 
-    double const a2   = this->body_->eq_rad() * this->body_->eq_rad();
-    double const c2   = this->body_->pol_rad() * this->body_->pol_rad();
+    DVector Rotated = { -rho * std::sin(alpha),   // x
+                         rho * std::cos(alpha),   // y
+                         radius * std::sin(lat) };
 
-    /*
-      Reduce cancellation due to subtraction from being catastrophic
-      to benign by using the form (a-c)(a+c) instead of (a*a - c*c).
-     */
-    double const diff =
-        (this->body_->eq_rad() - this->body_->pol_rad())
-        * (this->body_->eq_rad() + this->body_->pol_rad());
+    // Outward normal to the surface of the body at the point.
+    double const a2 = this->body_->eq_rad() * this->body_->eq_rad();
+    double const c2 = this->body_->pol_rad() * this->body_->pol_rad();
 
-    // "a" coefficient of the Quadratic Formula.
-    double const CA =
-        diff * std::pow(std::sin(this->sub_observ_lat_), 2) + c2;
-
-    std::size_t offset = 0;
-
-    for (std::size_t k = 0; k < lines; ++k) {
-        double const z =
-            (k + 0.5 - mp.line_center()) * mp.km_per_pixel();
-
-        for (std::size_t i = 0; i < samples; ++i, ++offset) {
-            double x =
-                (i + 0.5 - mp.sample_center()) * mp.km_per_pixel();
-            double zz;
-
-            if (!this->polar_) {
-                ImgCoord[0] = x;
-                ImgCoord[1] = 0;
-                ImgCoord[2] = z;
-                Rotated = rotY * ImgCoord;
-                x  = Rotated[0];
-                zz = Rotated[2];
-            } else {
-                zz = z;
-            }
+    DVector Normal = { Rotated[0] / a2,
+                       Rotated[1] / a2,
+                       Rotated[2] / c2 };
 
-            double const CB =
-                diff * zz * std::sin(2 * this->sub_observ_lat_);
-            double const CC =
-                a2 * zz * zz + c2 * x * x - a2 * c2 - diff *
-                zz * zz * std::pow(std::sin(this->sub_observ_lat_), 2);
-
-            std::pair<double, double> roots;
-
-            if (MaRC::quadratic_roots(CA, CB, CC, roots)) {
-                double y = std::min(roots.first, roots.second);
-                ImgCoord[0] = x;
-                ImgCoord[1] = y;
-                ImgCoord[2] = zz;
-                Rotated = rotX * ImgCoord;
-                if (this->polar_) {
-                    // Rotate about z-axis by (-this->PA_).
-                    x =  Rotated[0] * std::cos(-this->PA_) +
-                        Rotated[1] * std::sin(-this->PA_);
-
-                    y = -Rotated[0] * std::sin(-this->PA_) +
-                        Rotated[1] * std::cos(-this->PA_);
-                } else {
-                    x = Rotated[0];
-                    y = Rotated[1];
-                }
+    if (this->polar_) {
+        // Undo the rotation about the z-axis by (-this->PA_).
+        double const c = std::cos(-this->PA_);
+        double const s = std::sin(-this->PA_);
 
-                zz = Rotated[2];
+        for (auto v : { &Rotated, &Normal }) {
+            double const x = (*v)[0];
+            double const y = (*v)[1];
 
-                double const lat = std::atan2(zz, std::hypot(x, y));
+            (*v)[0] = c * x - s * y;
+            (*v)[1] = s * x + c * y;
+        }
+    }
 
-                double lon;
+    DMatrix const rotX(
+        MaRC::transpose(MaRC::Geometry::RotXMatrix(this->sub_observ_lat_)));
 
-                if (this->body_->prograde())
-                    lon = this->sub_observ_lon_ - std::atan2(-x, y) + C::pi;
-                else
-                    lon = this->sub_observ_lon_ + std::atan2(-x, y) - C::pi;
+    DVector ImgCoord = rotX * Rotated;
 
-                plot(lat, lon, offset);
-            }
-        }
+    /*
+      Only the intersection closest to the observer, i.e. the
+      smaller root along the y-axis in plot_map(), is visible.  The
+      surface normal points towards the observer there.  Allow for
+      round-off on the limb, where the normal is perpendicular to
+      the line of sight.
+    */
+    DVector const ImgNormal = rotX * Normal;
+
+    if (ImgNormal[1] > 1e-9 * ImgNormal.magnitude())
+        return false;
+
+    if (!this->polar_) {
+        DMatrix const rotY(
+            MaRC::transpose(MaRC::Geometry::RotYMatrix(-this->PA_)));
+
+        ImgCoord[1] = 0;
+        ImgCoord = rotY * ImgCoord;
     }
 
-    /**
-     * @bug This is printed after each map plane plotting run, and
-     *      interferes with the map progress output.  Print only once
-     *      per orthographic map.
-     *
-     * @todo Inform the user of the kilometers per pixel, and sample and
-     *       line center or latitude/longitude at the center,  if the
-     *       user didn't provide those values.
-     */
-    MaRC::debug("Body center in ORTHOGRAPHIC projection "
-                "(line, sample): ({}, {})",
-                mp.line_center(),
-                mp.sample_center());
+    sample = ImgCoord[0] / mp.km_per_pixel() + mp.sample_center();
+    line   = ImgCoord[2] / mp.km_per_pixel() + mp.line_center();
+
+    return
+        sample >= 0 && sample <= samples
+        && line >= 0 && line <= lines;
 }
 
 void
-MaRC::Orthographic::plot_grid(std::size_t samples,
-                              std::size_t lines,
-                              double lat_interval,
-                              double lon_interval,
-                              grid_type & grid) const
+MaRC::Orthographic::plot_map(plot_region const & region,
+                             plot_type const & plot) const
 {
+    auto const samples = region.samples();
+    auto const lines   = region.lines();
+
     ortho_map_parameters mp;
 
     this->map_parameters(samples, lines, mp);
 
-    // Tranformation matrix to rotate about x than new y
-    DMatrix const body2obs(Geometry::RotYMatrix(-this->PA_) *
-                           Geometry::RotXMatrix(this->sub_observ_lat_));
-
-    ortho_grid_parameters gp(body2obs, lat_interval, lon_interval, mp);
-
-    plot_lat_lines(samples, lines, gp, grid);
-    plot_lon_lines(samples, lines, gp, grid);
-}
-
-void
-MaRC::Orthographic::plot_lat_lines(std::size_t samples,
-                                   std::size_t lines,
-                                   ortho_grid_parameters const & p,
-                                   grid_type & grid) const
-{
-    auto const & mp = p.parameters();
-
-    // Draw latitude lines
-    for (double n = -90; n <= 90; n += p.lat_interval()) {
-        auto const nn =  n * C::degree; // Convert to radians
+    double const a2   = this->body_->eq_rad() * this->body_->eq_rad();
+    double const c2   = this->body_->pol_rad() * this->body_->pol_rad();
+    double const a2c2 = a2 * c2;
 
-        double low_bound, high_bound;
+    /*
+      Reduce cancellation due to subtraction from being catastrophic
+      to benign by using the form (a-c)(a+c) instead of (a*a - c*c).
+     */
+    double const diff =
+        (this->body_->eq_rad() - this->body_->pol_rad())
+        * (this->body_->eq_rad() + this->body_->pol_rad());
 
-        constexpr int ulps = 8;
+    double const sin_lat  = std::sin(this->sub_observ_lat_);
+    double const cos_lat  = std::cos(this->sub_observ_lat_);
+    double const sin2_lat = sin_lat * sin_lat;
 
-        if (n == 0
-            && MaRC::almost_equal(std::abs(this->sub_observ_lat_),
-                                  C::pi_2,
-                                  ulps)) {
-            // Polar case
-            low_bound = -C::pi;
-            high_bound= C::pi;
-        } else {
-            // General case
-
-            // tan(graphic lat) * tan(sub observ lat)
-            double const cosine =
-                this->body_->eq_rad() * this->body_->eq_rad() /
-                this->body_->pol_rad() / this->body_->pol_rad() *
-            std::tan(nn) * std::tan(this->sub_observ_lat_);
-
-            if (cosine >= -1 && cosine <= 1) {
-                low_bound  =
-                    this->sub_observ_lon_ - std::abs(std::acos(-cosine));
-
-                high_bound =
-                    this->sub_observ_lon_ + std::abs(std::acos(-cosine));
-            } else if (cosine > 1) {
-                low_bound  = -C::pi;
-                high_bound =  C::pi;
-            } else {
-                continue;
-            }
-        }
+    // "a" coefficient of the Quadratic Formula.
+    double const CA = diff * sin2_lat + c2;
 
-        auto const radius = this->body_->centric_radius(nn);
+    /*
+      The body coordinates are obtained by rotating the image
+      coordinates (x, y, zz) through a rotation about the x-axis by
+      the sub-observer latitude below, giving the following
+      coefficient of zz in the linear term.
+    */
+    double const CB_zz = -diff * std::sin(2 * this->sub_observ_lat_);
 
-        constexpr double imax = 2000;
-        for (double m = 0; m < imax; ++m) {
-            auto mm = m / imax * C::degree * 360;
+    /*
+      The discriminant of the quadratic, nonnegative only on the
+      disk of the body, is then a quadratic form in the image
+      coordinates (x, zz):
 
-            if (mm < low_bound)
-                mm += C::_2pi;
-            else if (mm > high_bound)
-                mm -= C::_2pi;
+          disc = disc_zz2 * zz * zz + disc_x2 * x * x + disc_0
+    */
+    double const disc_zz2 = CB_zz * CB_zz - 4 * CA * (a2 - diff * sin2_lat);
+    double const disc_x2  = -4 * CA * c2;
+    double const disc_0   =  4 * CA * a2c2;
 
-            if (mm >= low_bound && mm <= high_bound) {
-                if (this->body_->prograde())
-                    mm = this->sub_observ_lon_ + C::pi - mm;
-                else
-                    mm -= C::pi - this->sub_observ_lon_;
+    /*
+      The image coordinates (x, zz) are linear in the map sample and
+      line.  Non-polar projections rotate them about the y-axis by
+      the position angle before solving for y, and polar projections
+      rotate the resulting body coordinates about the z-axis by the
+      position angle instead.
+    */
+    double const kmpp    = mp.km_per_pixel();
+    double const cos_pa  = std::cos(-this->PA_);
+    double const sin_pa  = std::sin(-this->PA_);
+    double const dx_ds   = (this->polar_ ?  kmpp : cos_pa * kmpp);
+    double const dx_dl   = (this->polar_ ?  0    : -sin_pa * kmpp);
+    double const dz_ds   = (this->polar_ ?  0    : sin_pa * kmpp);
+    double const dz_dl   = (this->polar_ ?  kmpp : cos_pa * kmpp);
+    double const cos_rot = (this->polar_ ? cos_pa : 1);
+    double const sin_rot = (this->polar_ ? sin_pa : 0);
+
+    double const sample_center = mp.sample_center();
+    double const line_center   = mp.line_center();
 
-                DVector const coord = p.body2obs() * DVector(
-                     radius * std::cos(nn) * std::sin(mm),
-                    -radius * std::cos(nn) * std::cos(mm),
-                     radius * std::sin(nn));
+    /*
+      Longitude is the sub-observer longitude plus lon_sign * theta
+      plus lon_offset, where theta is the angle of the body point
+      about the body z-axis.  Keeping the rotation sense out of the
+      per-pixel loops allows them to be vectorized.
+    */
+    double const sub_observ_lon = this->sub_observ_lon_;
+    bool   const prograde       = this->body_->prograde();
+    double const lon_sign       = (prograde ? -1 : 1);
+    double const lon_offset     = (prograde ? C::pi : -C::pi);
 
-                auto const x = coord[0] / mp.km_per_pixel();
-                auto const z = coord[2] / mp.km_per_pixel();
+    bool const fast_math = this->math() == math_mode::fast;
 
-                auto const i = static_cast<ssize_t>(
-                    std::round(mp.sample_center() - x));
-                auto const k = static_cast<ssize_t>(
-                    std::round(mp.line_center() + z));
+    // Body x coordinates of the map pixels in a run.
+    std::vector<double> body_x;
 
-                if (i >= 0 && static_cast<std::size_t>(i) < samples
-                    && k >= 0 && static_cast<std::size_t>(k) < lines) {
-                    auto const index =
-                        static_cast<std::size_t>(k) * samples +
-                        static_cast<std::size_t>(i);
+    /*
+      Offsets 0, 1, 2, ... of the map pixels from the start of a run.
+      Reading them from an array avoids an integer to floating point
+      conversion that prevents vectorization on some targets.
+    */
+    std::vector<double> offset;
+
+    // Inverse Orthographic projection along a run of map pixels.
+    auto const row_inverse =
+        [&](double sample,
+            double line,
+            std::size_t count,
+            double * lat,
+            double * lon)
+        {
+            if (offset.size() < count) {
+                offset.resize(count);
+                std::iota(offset.begin(), offset.end(), 0.0);
+                body_x.resize(count);
+            }
 
-                    grid[index] = p.white();
+            double       * const bx       = body_x.data();
+            double const * const k_offset = offset.data();
+
+            /*
+              Copy the constants into locals so that the compiler
+              knows they are not modified through the latitude,
+              longitude and body x coordinate arrays, allowing the
+              loops below to be auto-vectorized.
+            */
+            double const k_a2    = a2;
+            double const k_c2    = c2;
+            double const k_a2c2  = a2c2;
+            double const k_diff  = diff;
+            double const k_CA    = CA;
+            double const k_CB_zz = CB_zz;
+            double const k_s2    = sin2_lat;
+            double const k_sin   = sin_lat;
+            double const k_cos   = cos_lat;
+            double const k_dx_ds = dx_ds;
+            double const k_dz_ds = dz_ds;
+            double const k_cr    = cos_rot;
+            double const k_sr    = sin_rot;
+            double const k_sc    = sample_center;
+            double const k_lon0  = sub_observ_lon;
+            double const k_sign  = lon_sign;
+            double const k_off   = lon_offset;
+
+            // Contribution of the map line to the image coordinates.
+            double const l  = line - line_center;
+            double const xl = dx_dl * l;
+            double const zl = dz_dl * l;
+
+            /*
+              Clip the run to the span of map pixels on the disk of
+              the body, where the run crosses the limb ellipse, so
+              that map pixels in the sky are skipped.  The limb is
+              found by solving for the roots of the discriminant
+              along the run, a quadratic in the map sample.  Widen
+              the span by a map pixel on either side to allow for
+              round-off, since the map pixels on the disk are still
+              determined by the per-pixel discriminant below.  That
+              keeps the map identical to an unclipped one.
+            */
+            std::size_t first = 0;
+            std::size_t last  = 0;
+            std::pair<double, double> limb;
+
+            if (MaRC::quadratic_roots(
+                    disc_zz2 * dz_ds * dz_ds + disc_x2 * dx_ds * dx_ds,
+                    2 * (disc_zz2 * dz_ds * zl + disc_x2 * dx_ds * xl),
+                    disc_zz2 * zl * zl + disc_x2 * xl * xl + disc_0,
+                    limb)) {
+                // Limb crossings relative to the start of the run.
+                double const start = sample_center - sample;
+                double const n     = static_cast<double>(count);
+                double const lo    =
+                    std::ceil(start + std::min(limb.first, limb.second))
+                    - 1;
+                double const hi    =
+                    std::floor(start + std::max(limb.first, limb.second))
+                    + 2;
+
+                if (std::isnan(lo) || std::isnan(hi)) {
+                    last = count;  // Unclipped.
+                } else {
+                    first =
+                        static_cast<std::size_t>(std::clamp(lo, 0.0, n));
+                    last  = std::max(
+                        first,
+                        static_cast<std::size_t>(std::clamp(hi, 0.0, n)));
                 }
             }
-        }
-    }
-}
 
-void
-MaRC::Orthographic::plot_lon_lines(std::size_t samples,
-                                   std::size_t lines,
-                                   ortho_grid_parameters const & p,
-                                   grid_type & grid) const
-{
-    auto const & mp = p.parameters();
-
-    for (double m = 0 + p.lon_interval();
-         m <= 360;
-         m += p.lon_interval()) {
-        constexpr double imax = 1000;
-
-        auto const mm = m * C::degree;
-
-        for (double n = 0; n < imax; ++n) {
-            auto mm2 = mm;
-            auto const nn = (n / imax * 180 - 90) * C::degree;
-
-            // tan (graphic lat) * tan (sub observ lat)
-            double const cosine =
-                this->body_->eq_rad() * this->body_->eq_rad()
-                / this->body_->pol_rad() / this->body_->pol_rad()
-                * std::tan(nn) * std::tan(this->sub_observ_lat_);
-
-            double low_bound;
-            double high_bound;
-
-            if (cosine >= -1 && cosine <= 1) {
-                low_bound =
-                    this->sub_observ_lon_ - std::abs(std::acos(-cosine));
-                high_bound =
-                    this->sub_observ_lon_ + std::abs(std::acos(-cosine));
-            } else if (cosine > 1) {
-                low_bound  = -C::pi;
-                high_bound =  C::pi;
+            // The rest of the run is not on the body.
+            constexpr double off_body =
+                std::numeric_limits<double>::quiet_NaN();
+
+            std::fill(lat, lat + first, off_body);
+            std::fill(lon, lon + first, off_body);
+            std::fill(lat + last, lat + count, off_body);
+            std::fill(lon + last, lon + count, off_body);
+
+            /*
+              Solve for the smaller root y along the line of sight,
+              and rotate the image coordinates to body coordinates.
+              Map pixels not on the body have no real roots, and end
+              up with NaN body coordinates.  The body y and z
+              coordinates are temporarily stored in the lon and lat
+              arrays, respectively.
+            */
+            for (std::size_t i = first; i < last; ++i) {
+                /*
+                  Compute the image coordinates of each map pixel
+                  from its own sample rather than incrementally from
+                  the start of the run so that the results match those
+                  for a single map pixel.
+                */
+                double const s  = (sample + k_offset[i]) - k_sc;
+                double const x  = k_dx_ds * s + xl;
+                double const zz = k_dz_ds * s + zl;
+
+                double const CB = k_CB_zz * zz;
+                double const CC =
+                    k_a2 * zz * zz + k_c2 * x * x - k_a2c2
+                    - k_diff * zz * zz * k_s2;
+
+                // See MaRC::quadratic_roots().
+                double const sd = std::sqrt(CB * CB - 4 * k_CA * CC);
+                double const q  = -(CB + (CB < 0 ? -sd : sd)) / 2;
+                double const r1 = q / k_CA;
+                double const r2 = CC / q;
+                double const y  = (r2 < r1 ? r2 : r1);
+
+                double const ry = k_cos * y + k_sin * zz;
+
+                bx[i]  = x * k_cr + ry * k_sr;
+                lon[i] = ry * k_cr - x * k_sr;
+                lat[i] = k_cos * zz - k_sin * y;
             }
-            else {
-                continue;
-            }
-
-            if (mm2 < low_bound)
-                mm2 += C::_2pi;
-            else if (mm2 > high_bound)
-                mm2 -= C::_2pi;
 
-            if (mm2 >= low_bound && mm2 <= high_bound) {
-                if (this->body_->prograde())
-                    mm2 = this->sub_observ_lon_ + C::pi - mm2;
-                else
-                    mm2 -= C::pi + this->sub_observ_lon_;
-
-                double const radius = this->body_->centric_radius(nn);
+            // Separate loops allow the fast math functions to be
+            // vectorized with the loop above.
+            if (fast_math) {
+                for (std::size_t i = first; i < last; ++i) {
+                    double const x = bx[i];
+                    double const y = lon[i];
+                    double const t = MaRC::fast::atan2(-x, y);
+
+                    lat[i] = MaRC::fast::atan2(lat[i],
+                                               MaRC::fast::hypot(x, y));
+                    lon[i] = k_lon0 + k_sign * t + k_off;
+                }
+            } else {
+                for (std::size_t i = first; i < last; ++i) {
+                    double const x = bx[i];
+                    double const y = lon[i];
+                    double const t = std::atan2(-x, y);
 
-                DVector const coord = p.body2obs() * DVector(
-                     radius * std::cos(nn) * std::sin(mm2),
-                    -radius * std::cos(nn) * std::cos(mm2),
-                     radius * std::sin(nn));
+                    lat[i] = std::atan2(lat[i], std::hypot(x, y));
+                    lon[i] = k_lon0 + k_sign * t + k_off;
+                }
+            }
+        };
 
-                auto const x = coord[0] / mp.km_per_pixel();
-                auto const z = coord[2] / mp.km_per_pixel();
+    // Inverse Orthographic projection at a map location.
+    auto const inverse =
+        [&row_inverse](double sample, double line, double & lat, double & lon)
+        {
+            row_inverse(sample, line, 1, &lat, &lon);
 
-                auto const i = static_cast<ssize_t>(
-                    std::round(mp.sample_center() - x));
-                auto const k = static_cast<ssize_t>(
-                    std::round(mp.line_center() + z));
+            return !std::isnan(lat);
+        };
 
-                if (i >= 0 && static_cast<std::size_t>(i) < samples
-                  && k >= 0 && static_cast<std::size_t>(k) < lines) {
-                    auto const index =
-                        static_cast<std::size_t>(k) * samples +
-                        static_cast<std::size_t>(i);
+    this->plot_coordinates(region,
+                           *this->body_,
+                           inverse,
+                           row_inverse,
+                           plot);
 
-                    grid[index] = p.white();
-                }
-            }
-        }
-    } // End draw longitude lines
+    /**
+     * @bug This is printed after each map plane plotting run, and
+     *      interferes with the map progress output.  Print only once
+     *      per orthographic map.
+     *
+     * @todo Inform the user of the kilometers per pixel, and sample and
+     *       line center or latitude/longitude at the center,  if the
+     *       user didn't provide those values.
+     */
+    MaRC::debug("Body center in ORTHOGRAPHIC projection "
+                "(line, sample): ({}, {})",
+                mp.line_center(),
+                mp.sample_center());
 }
 
 void
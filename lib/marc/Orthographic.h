@@ -2,7 +2,7 @@
 /**
  * @file Orthographic.h
  *
- * Copyright (C) 1996-1997, 1999, 2003-2004, 2017-2020  Ossama Othman
+ * Copyright (C) 1996-1997, 1999, 2003-2004, 2017-2020, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -23,7 +23,6 @@ namespace MaRC
     struct OrthographicCenter;
 
     class ortho_map_parameters;
-    class ortho_grid_parameters;
 
     /**
      * @enum GeometryType
@@ -100,6 +99,13 @@ namespace MaRC
          */
         ///@{
         char const * projection_name() const override;
+
+        bool map_coordinates(std::size_t samples,
+                             std::size_t lines,
+                             double lat,
+                             double lon,
+                             double & sample,
+                             double & line) const override;
         ///@}
 
     private:
@@ -124,33 +130,9 @@ namespace MaRC
          *
          * @see @c MaRC::MapFactory::plot_map().
          */
-        void plot_map(std::size_t samples,
-                      std::size_t lines,
+        void plot_map(plot_region const & region,
                       plot_type const & plot) const override;
 
-        /**
-         * Create the Orthographic map latitude/longitude grid.
-         *
-         * @see @c MaRC::MapFactory::plot_grid().
-         */
-        void plot_grid(std::size_t samples,
-                       std::size_t lines,
-                       double lat_interval,
-                       double lon_interval,
-                       grid_type & grid) const override;
-
-        /// Plot the Orthographic map latitude lines.
-        void plot_lat_lines(std::size_t samples,
-                            std::size_t lines,
-                            ortho_grid_parameters const & p,
-                            grid_type & grid) const;
-
-        /// Plot the Orthographic map longitude lines.
-        void plot_lon_lines(std::size_t samples,
-                            std::size_t lines,
-                            ortho_grid_parameters const & p,
-                            grid_type & grid) const;
-
     private:
 
         /// OblateSpheroid object representing the body being mapped.
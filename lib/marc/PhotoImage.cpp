@@ -1,7 +1,7 @@
 /**
  * @file PhotoImage.cpp
  *
- * Copyright (C) 1998-1999, 2003-2005, 2017, 2019, 2021  Ossama Othman
+ * Copyright (C) 1998-1999, 2003-2005, 2017, 2019, 2021, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -22,6 +22,11 @@
 #include <fmt/core.h>
 
 #include <stdexcept>
+#include <algorithm>
+#include <utility>
+#include <iterator>  // For std::size().
+#include <limits>
+#include <cmath>
 #include <cassert>
 
 
@@ -44,6 +49,16 @@ namespace
 
         return std::vector<bool>();
     }
+
+    /// Wrap a single image in a list of bands.
+    auto make_bands(std::vector<double> && image)
+    {
+        MaRC::PhotoImage::band_list_type bands;
+
+        bands.push_back(std::move(image));
+
+        return bands;
+    }
 }
 
 MaRC::PhotoImage::PhotoImage(std::vector<double> && image,
@@ -51,14 +66,30 @@ MaRC::PhotoImage::PhotoImage(std::vector<double> && image,
                              std::size_t lines,
                              std::unique_ptr<PhotoImageParameters> config,
                              std::unique_ptr<ViewingGeometry> geometry)
+    : PhotoImage(make_bands(std::move(image)),
+                 samples,
+                 lines,
+                 std::move(config),
+                 std::move(geometry))
+{
+}
+
+MaRC::PhotoImage::PhotoImage(band_list_type && bands,
+                             std::size_t samples,
+                             std::size_t lines,
+                             std::unique_ptr<PhotoImageParameters> config,
+                             std::unique_ptr<ViewingGeometry> geometry)
     : SourceImage()
-    , image_    (std::move(image))
+    , bands_    (std::move(bands))
     , samples_  (samples)
     , lines_    (lines)
     , left_     (config->nibble_left())
     , right_    (samples - config->nibble_right())
     , top_      (config->nibble_top())
     , bottom_   (lines - config->nibble_bottom())
+    , stride_   (samples)
+    , sample_origin_(0)
+    , line_origin_(0)
     , config_   (std::move(config))
     , geometry_ (std::move(geometry))
     , body_mask_(make_body_mask(samples,
@@ -75,11 +106,6 @@ MaRC::PhotoImage::PhotoImage(std::vector<double> && image,
                         lines));
     }
 
-    if (this->image_.size() != samples * lines) {
-        throw std::invalid_argument(
-            "Source image size does not match samples and lines");
-    }
-
     /**
      * @note Null config and geometry parameter checks are done in the
      *       call to body_mask() in the anonymous namespace above.
@@ -92,6 +118,34 @@ MaRC::PhotoImage::PhotoImage(std::vector<double> && image,
      *       brittle.  Revisit.
      */
     this->config_->validate_parameters(samples, lines);
+
+    if (this->bands_.empty())
+        throw std::invalid_argument("Source image has no bands.");
+
+    auto const window_samples = this->right_  - this->left_;
+    auto const window_lines   = this->bottom_ - this->top_;
+
+    // All bands share the same dimensions.
+    auto const size = this->bands_.front().size();
+
+    for (auto const & band : this->bands_) {
+        if (band.size() != size) {
+            throw std::invalid_argument(
+                "Source image bands differ in size.");
+        }
+    }
+
+    if (size != samples * lines) {
+        if (size != window_samples * window_lines) {
+            throw std::invalid_argument(
+                "Source image size does not match samples and lines");
+        }
+
+        // Only the non-nibbled window of the image was provided.
+        this->stride_        = window_samples;
+        this->sample_origin_ = this->left_;
+        this->line_origin_   = this->top_;
+    }
 }
 
 bool
@@ -111,11 +165,294 @@ MaRC::PhotoImage::read_data(double lat,
                             double & weight,
                             bool scan) const
 {
+    double x = 0, z = 0;
+    std::size_t i = 0, k = 0;
+
     /**
-     * @todo Validate @a lat and @a lon.
+     * Consider NaN data points invalid, i.e. "off the body".
+     * No need to continue beyond this point.
+     *
+     * @todo Check for a user-specified "blank" value as
+     *       well.
      */
+    if (!this->locate(lat, lon, x, z, i, k)
+        || std::isnan(data)
+        || !this->read_band(this->bands_.front(), x, z, i, k, data))
+        return false;
+
+    // Scan across image for "off-planet/image" pixels and compute
+    // data weight.
+    if (scan)
+        this->data_weight(i, k, weight);
+
+    return true;  // Success
+}
+
+bool
+MaRC::PhotoImage::read_bands(double lat,
+                             double lon,
+                             double * data) const
+{
+    constexpr auto nan = std::numeric_limits<double>::quiet_NaN();
+
+    double x = 0, z = 0;
+    std::size_t i = 0, k = 0;
+
+    if (!this->locate(lat, lon, x, z, i, k)) {
+        std::fill_n(data, this->bands_.size(), nan);
+
+        return false;
+    }
+
+    // The pixel is shared by all bands.  Only the data differs.
+    bool found = false;
 
+    for (auto const & band : this->bands_) {
+        if (this->read_band(band, x, z, i, k, *data))
+            found = true;
+        else
+            *data = nan;
+
+        ++data;
+    }
+
+    return found;
+}
+
+std::vector<std::uint64_t>
+MaRC::PhotoImage::resampling_sources() const
+{
+    // Photometric corrections are not recorded in resampling plans.
+    if (!this->config_->photometric_correction()->identity())
+        return {};
+
+    return { this->samples_ * this->lines_ };
+}
+
+bool
+MaRC::PhotoImage::read_taps(double lat,
+                            double lon,
+                            std::size_t first,
+                            ResamplingPlan::tap_list & taps,
+                            double & weight,
+                            bool scan) const
+{
     double x = 0, z = 0;
+    std::size_t i = 0, k = 0;
+
+    InterpolationStrategy::weights_type weights;
+
+    if (!this->locate(lat, lon, x, z, i, k)
+        || !this->config_->interpolation_strategy()->weights(x,
+                                                             z,
+                                                             weights))
+        return false;
+
+    // Pixel at the "bottom left" of the 2x2 interpolation block in
+    // the entire image.
+    auto const l = static_cast<std::size_t>(x) + this->sample_origin_;
+    auto const b = static_cast<std::size_t>(z) + this->line_origin_;
+
+    for (std::size_t n = 0; n < weights.size(); ++n) {
+        if (weights[n] == 0)
+            continue;
+
+        auto const sample = l + n % 2;
+        auto const line   = b + n / 2;
+
+        taps.push_back({ first,
+                         line * this->samples_ + sample,
+                         weights[n] });
+    }
+
+    if (scan)
+        this->data_weight(i, k, weight);
+
+    return true;
+}
+
+bool
+MaRC::PhotoImage::resampling_data(std::size_t band,
+                                  ResamplingPlan::source_list & data) const
+{
+    if (band >= this->bands_.size() || this->resampling_sources().empty())
+        return false;
+
+    auto const & b = this->bands_[band];
+
+    std::vector<double> image(this->samples_ * this->lines_,
+                              std::numeric_limits<double>::quiet_NaN());
+
+    // Copy the stored lines into place in the entire image.
+    auto const lines = b.size() / this->stride_;
+
+    for (std::size_t k = 0; k < lines; ++k)
+        std::copy_n(b.cbegin() + k * this->stride_,
+                    this->stride_,
+                    image.begin()
+                    + (k + this->line_origin_) * this->samples_
+                    + this->sample_origin_);
+
+    data.push_back(std::move(image));
+
+    return true;
+}
+
+bool
+MaRC::PhotoImage::footprint(footprint_visitor const & visit) const
+{
+    // Pixel corner in pixel coordinates.
+    struct corner
+    {
+        double x;
+        double z;
+        double lat;
+        double lon;
+        bool on_body;
+    };
+
+    auto const convert =
+        [this](corner & c)
+        {
+            c.on_body =
+                this->geometry_->pix2latlon(c.x, c.z, c.lat, c.lon);
+        };
+
+    /*
+      Find the point where the limb crosses the edge between a
+      corner on the body and one off the body through bisection.
+    */
+    auto const limb =
+        [&convert](corner on, corner off)
+        {
+            // Bisection iterations, i.e. to about 1/1000 of a pixel.
+            constexpr int iterations = 10;
+
+            for (int n = 0; n < iterations; ++n) {
+                corner mid;
+                mid.x = (on.x + off.x) / 2;
+                mid.z = (on.z + off.z) / 2;
+
+                convert(mid);
+
+                (mid.on_body ? on : off) = mid;
+            }
+
+            return on;
+        };
+
+    /*
+      Pixel (i, k) spans the half-open intervals [i, i + 1) and
+      [k, k + 1) in pixel coordinates.  Compute the corners of the
+      pixels in the non-nibbled window one line of corners at a
+      time, so that each corner is only converted once.
+    */
+    auto const width = this->right_ - this->left_ + 1;
+
+    std::vector<corner> above(width);
+    std::vector<corner> below(width);
+
+    // Corner coordinates on a line, converted as a batch.
+    std::vector<double> samples(width);
+    std::vector<double> lines(width);
+    std::vector<double> lats;
+    std::vector<double> lons;
+
+    for (std::size_t n = 0; n < width; ++n)
+        samples[n] = static_cast<double>(this->left_ + n);
+
+    auto const convert_line =
+        [&](std::size_t k, std::vector<corner> & corners)
+        {
+            std::fill(lines.begin(), lines.end(), static_cast<double>(k));
+
+            this->geometry_->pix2latlon(samples, lines, lats, lons);
+
+            for (std::size_t n = 0; n < corners.size(); ++n) {
+                auto & c = corners[n];
+
+                c.x = samples[n];
+                c.z = lines[n];
+                c.lat = lats[n];
+                c.lon = lons[n];
+                c.on_body = !std::isnan(c.lat);
+            }
+        };
+
+    convert_line(this->top_, above);
+
+    footprint_cell cell;
+
+    for (std::size_t k = this->top_; k < this->bottom_; ++k) {
+        convert_line(k + 1, below);
+
+        for (std::size_t n = 0; n + 1 < width; ++n) {
+            auto const i = this->left_ + n;
+
+            if (!this->body_mask_.empty()
+                && !this->body_mask_[k * this->samples_ + i])
+                continue;
+
+            // Corners in order around the pixel.
+            corner const * const corners[] = {
+                &above[n], &above[n + 1], &below[n + 1], &below[n]
+            };
+
+            cell.vertices = 0;
+
+            auto const add =
+                [&cell](corner const & c)
+                {
+                    cell.lat[cell.vertices] = c.lat;
+                    cell.lon[cell.vertices] = c.lon;
+                    ++cell.vertices;
+                };
+
+            for (std::size_t c = 0; c < std::size(corners); ++c) {
+                auto const & a = *corners[c];
+                auto const & b = *corners[(c + 1) % std::size(corners)];
+
+                if (a.on_body)
+                    add(a);
+
+                if (a.on_body != b.on_body
+                    && cell.vertices < footprint_cell::max_vertices)
+                    add(a.on_body ? limb(a, b) : limb(b, a));
+            }
+
+            if (cell.vertices > 0)
+                visit(cell);
+        }
+
+        std::swap(above, below);
+    }
+
+    return true;
+}
+
+bool
+MaRC::PhotoImage::visibility_bounds(std::vector<body_cap> & caps) const
+{
+    body_cap cap;
+
+    this->geometry_->visible_cap(cap.lat, cap.lon, cap.radius);
+
+    caps.push_back(cap);
+
+    return true;
+}
+
+bool
+MaRC::PhotoImage::locate(double lat,
+                         double lon,
+                         double & x,
+                         double & z,
+                         std::size_t & i,
+                         std::size_t & k) const
+{
+    /**
+     * @todo Validate @a lat and @a lon.
+     */
 
     if (!this->geometry_->latlon2pix(lat, lon, x, z) || x < 0 || z < 0)
         return false;
@@ -123,50 +460,50 @@ MaRC::PhotoImage::read_data(double lat,
     // x and z are 'pixel coordinates'.  In 'pixel coordinates', the
     // half-open interval [0,1) is inside pixel 0, [1,2) is inside
     // pixel 1, etc.
-    auto const i = static_cast<std::size_t>(std::floor(x));
-    auto const k = static_cast<std::size_t>(std::floor(z));
-    auto const index = k * this->samples_ + i;
-
-    auto const & config = this->config_;
+    i = static_cast<std::size_t>(std::floor(x));
+    k = static_cast<std::size_t>(std::floor(z));
 
     /**
      * The following assumes that line numbers increase downward.
      *
      * @todo Verify that this "nibbling" works as described.
-     *
-     * Consider NaN data points invalid, i.e. "off the body".
-     * No need to continue beyond this point.
-     *
-     * @todo Check for a user-specified "blank" value as
-     *       well.
      */
     if (   i <  this->left_
         || i >= this->right_
         || k <  this->top_
         || k >= this->bottom_
-        || (!this->body_mask_.empty() && !this->body_mask_[index])
-        || std::isnan(data))
+        || (!this->body_mask_.empty()
+            && !this->body_mask_[k * this->samples_ + i]))
         return false;
 
-    data = this->image_[index];
+    // Pixel coordinates relative to the image data array.
+    x -= this->sample_origin_;
+    z -= this->line_origin_;
 
-    if (!config->interpolation_strategy()->interpolate(
-            this->image_.data(),
-            x,
-            z,
-            data)
-        || !config->photometric_correction()->correct(*this->geometry_,
-                                                      data)
-        || std::isnan(data)) {
-        return false;
-    }
+    return true;
+}
 
-    // Scan across image for "off-planet/image" pixels and compute
-    // data weight.
-    if (scan)
-        this->data_weight(i, k, weight);
+bool
+MaRC::PhotoImage::read_band(std::vector<double> const & band,
+                            double x,
+                            double z,
+                            std::size_t i,
+                            std::size_t k,
+                            double & data) const
+{
+    auto const & config = this->config_;
 
-    return true;  // Success
+    data = band[(k - this->line_origin_) * this->stride_
+                + (i - this->sample_origin_)];
+
+    return
+        config->interpolation_strategy()->interpolate(band.data(),
+                                                      x,
+                                                      z,
+                                                      data)
+        && config->photometric_correction()->correct(*this->geometry_,
+                                                     data)
+        && !std::isnan(data);
 }
 
 void
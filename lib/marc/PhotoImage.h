@@ -2,7 +2,7 @@
 /**
  * @file PhotoImage.h
  *
- * Copyright (C) 1999, 2003-2005, 2017-2018, 2021  Ossama Othman
+ * Copyright (C) 1999, 2003-2005, 2017-2018, 2021, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -40,13 +40,28 @@ namespace MaRC
 
         using body_mask_type = std::vector<bool>;
 
+        /// Type of container holding the data for each image band.
+        using band_list_type = std::vector<std::vector<double>>;
+
         /// Constructor
         /**
+         * The @a image array may contain either the entire image,
+         * or only the non-nibbled window of the image, i.e. the
+         * half-open intervals [nibble_left, samples - nibble_right)
+         * and [nibble_top, lines - nibble_bottom).  Storing only the
+         * window reduces memory use when large borders are nibbled
+         * away.  Pixel coordinates always refer to the entire image
+         * regardless.  The interpolation strategy is passed pixel
+         * coordinates relative to the stored image data, e.g.
+         * relative to the window.
+         *
          * @param[in,out] image    Array containing the image data.
          *                         Ownership is transferred to the
          *                         @c PhotoImage.
-         * @param[in]     samples  Number of samples in the image.
-         * @param[in]     lines    Number of lines   in the image.
+         * @param[in]     samples  Number of samples in the entire
+         *                         image.
+         * @param[in]     lines    Number of lines   in the entire
+         *                         image.
          * @param[in,out] config   Configuration parameters specific
          *                         to a @c PhotoImage.  Ownership is
          *                         transferred to the @c PhotoImage.
@@ -61,6 +76,42 @@ namespace MaRC
                    std::unique_ptr<PhotoImageParameters> config,
                    std::unique_ptr<ViewingGeometry> geometry);
 
+        /// Constructor for multi-band images.
+        /**
+         * All bands, such as the planes of a multispectral image
+         * cube, share the same dimensions, viewing geometry, nibble
+         * values and body mask.  The image pixel corresponding to a
+         * given latitude and longitude is therefore only computed
+         * once, and then interpolated across all bands.
+         *
+         * @param[in,out] bands    Array containing the data for each
+         *                         band, each of which may contain
+         *                         either the entire image or only the
+         *                         non-nibbled window of the image.
+         *                         Ownership is transferred to the
+         *                         @c PhotoImage.
+         * @param[in]     samples  Number of samples in the entire
+         *                         image.
+         * @param[in]     lines    Number of lines   in the entire
+         *                         image.
+         * @param[in,out] config   Configuration parameters specific
+         *                         to a @c PhotoImage.  Ownership is
+         *                         transferred to the @c PhotoImage.
+         * @param[in,out] geometry Viewing geometry shared by all
+         *                         bands.  Ownership is transferred to
+         *                         the @c PhotoImage.
+         *
+         * @see PhotoImage(std::vector<double> &&, std::size_t,
+         *                 std::size_t,
+         *                 std::unique_ptr<PhotoImageParameters>,
+         *                 std::unique_ptr<ViewingGeometry>)
+         */
+        PhotoImage(band_list_type && bands, // moved, not copied!
+                   std::size_t samples,
+                   std::size_t lines,
+                   std::unique_ptr<PhotoImageParameters> config,
+                   std::unique_ptr<ViewingGeometry> geometry);
+
         // Disallow copying.
         PhotoImage(PhotoImage const &) = delete;
         PhotoImage & operator=(PhotoImage const &) = delete;
@@ -108,6 +159,84 @@ namespace MaRC
                        double & weight,
                        bool scan = true) const override;
 
+        /// Number of bands in the image.
+        std::size_t bands() const override
+        {
+            return this->bands_.size();
+        }
+
+        /// Retrieve physical data from all bands.
+        /**
+         * Retrieve physical data from all bands.  The viewing
+         * geometry and body mask are only consulted once.  The
+         * configured data interpolation and photometric correction
+         * strategies are then applied to each band.
+         *
+         * @see MaRC::SourceImage::read_bands().
+         */
+        bool read_bands(double lat,
+                        double lon,
+                        double * data) const override;
+
+        /// Get the size of the entire image.
+        /**
+         * Resampling plans are not supported if a photometric
+         * correction that changes the data is configured, since
+         * the correction is not recorded in the plan.
+         *
+         * @see MaRC::SourceImage::resampling_sources().
+         */
+        std::vector<std::uint64_t> resampling_sources() const override;
+
+        /// Retrieve the pixels contributing to the data at a given
+        /// latitude and longitude.
+        /**
+         * The pixels are those combined by the configured data
+         * interpolation strategy.  Resampling plans are not
+         * supported if the interpolation strategy doesn't provide
+         * interpolation weights.  Pixel offsets refer to the entire
+         * image rather than the stored non-nibbled window.
+         *
+         * @see MaRC::SourceImage::read_taps().
+         */
+        bool read_taps(double lat,
+                       double lon,
+                       std::size_t first,
+                       ResamplingPlan::tap_list & taps,
+                       double & weight,
+                       bool scan) const override;
+
+        /// Retrieve the data of a band in the entire image.
+        /**
+         * Pixels outside of the stored non-nibbled window are
+         * @c NaN.
+         *
+         * @see MaRC::SourceImage::resampling_data().
+         */
+        bool resampling_data(
+            std::size_t band,
+            ResamplingPlan::source_list & data) const override;
+
+        /// Visit the pixels of the non-nibbled window on the body.
+        /**
+         * The pixels are those of the non-nibbled window that are
+         * within the body mask, if sky removal is enabled, with at
+         * least one corner on the body.  The limb crossings on the
+         * edges of pixels only partially on the body are found
+         * through bisection.
+         *
+         * @see MaRC::SourceImage::footprint().
+         */
+        bool footprint(footprint_visitor const & visit) const override;
+
+        /// Bound the side of the body visible in the photo.
+        /**
+         * @see MaRC::SourceImage::visibility_bounds().
+         * @see MaRC::ViewingGeometry::visible_cap().
+         */
+        bool visibility_bounds(
+            std::vector<body_cap> & caps) const override;
+
         /// Left side of image.
         std::size_t left() const { return this->left_; }
 
@@ -128,6 +257,53 @@ namespace MaRC
 
     private:
 
+        /**
+         * @brief Find the image pixel at a given latitude and
+         *        longitude.
+         *
+         * @param[in]  lat Planetocentric latitude in radians.
+         * @param[in]  lon Longitude in radians.
+         * @param[out] x   Pixel coordinate sample relative to the
+         *                 image data array.
+         * @param[out] z   Pixel coordinate line relative to the
+         *                 image data array.
+         * @param[out] i   Image pixel sample.
+         * @param[out] k   Image pixel line.
+         *
+         * @retval true  The pixel is visible, within the non-nibbled
+         *               window, and on the body if sky removal is
+         *               enabled.
+         * @retval false No usable pixel at @a lat and @a lon.
+         */
+        bool locate(double lat,
+                    double lon,
+                    double & x,
+                    double & z,
+                    std::size_t & i,
+                    std::size_t & k) const;
+
+        /**
+         * @brief Interpolate and correct a datum from a given band.
+         *
+         * @param[in]  band Band from which the datum will be read.
+         * @param[in]  x    Pixel coordinate sample relative to the
+         *                  image data array.
+         * @param[in]  z    Pixel coordinate line relative to the
+         *                  image data array.
+         * @param[in]  i    Image pixel sample.
+         * @param[in]  k    Image pixel line.
+         * @param[out] data Physical data retrieved from @a band.
+         *
+         * @retval true  Physical data retrieved.
+         * @retval false No physical data retrieved.
+         */
+        bool read_band(std::vector<double> const & band,
+                       double x,
+                       double z,
+                       std::size_t i,
+                       std::size_t k,
+                       double & data) const;
+
         /**
          * @brief Scan across samples for the data weight.
          *
@@ -181,8 +357,8 @@ namespace MaRC
 
     private:
 
-        /// Pointer to the image array.
-        std::vector<double> const image_;
+        /// Image data for each band.
+        band_list_type const bands_;
 
         /// Number of samples in the image.
         std::size_t const samples_;
@@ -202,6 +378,15 @@ namespace MaRC
         /// Bottom side of image.
         std::size_t const bottom_;
 
+        /// Number of samples in each line of the image data array.
+        std::size_t stride_;
+
+        /// Sample of the first pixel in the image data array.
+        std::size_t sample_origin_;
+
+        /// Line of the first pixel in the image data array.
+        std::size_t line_origin_;
+
         /// @c PhotoImage configuration parameters.
         std::unique_ptr<PhotoImageParameters const> const config_;
 
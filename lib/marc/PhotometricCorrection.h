@@ -2,7 +2,7 @@
 /**
  * @file PhotometricCorrection.h
  *
- * Copyright (C) 1999, 2003-2004, 2017  Ossama Othman
+ * Copyright (C) 1999, 2003-2004, 2017, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -61,6 +61,18 @@ namespace MaRC
         virtual bool correct(ViewingGeometry const & geometry,
                              double & data) = 0;
 
+        /**
+         * @brief Does this strategy leave the data unchanged?
+         *
+         * Photometric corrections are arbitrary functions of the
+         * data, and cannot be recorded in a @c ResamplingPlan.
+         * Images may only be mapped through a plan if their
+         * correction leaves the data unchanged.
+         *
+         * @return @c true if @c correct() never changes the data.
+         */
+        virtual bool identity() const { return false; }
+
     };
 
 }
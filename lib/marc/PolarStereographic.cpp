@@ -1,7 +1,7 @@
 /**
  * @file PolarStereographic.cpp
  *
- * Copyright (C) 2004, 2017-2019  Ossama Othman
+ * Copyright (C) 2004, 2017-2019, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -9,9 +9,8 @@
  */
 
 #include "PolarStereographic.h"
-#include "OblateSpheroid.h"
+#include "Sphere.h"
 #include "Constants.h"
-#include "root_find.h"
 #include "config.h"  // For NDEBUG and FMT_HEADER_ONLY
 
 #ifndef NDEBUG
@@ -21,6 +20,7 @@
 #include <fmt/core.h>
 
 #include <limits>
+#include <type_traits>
 #include <cmath>
 
 
@@ -121,6 +121,7 @@ MaRC::PolarStereographic::PolarStereographic(
     , max_lat_(std::isnan(max_lat) ? 0 : max_lat * C::degree)
     , rho_coeff_(rho_coefficient(*body_))
     , distortion_coeff_(distortion_coefficient(*body_))
+    , conformal_(body_->first_eccentricity())
     , north_pole_(north_pole)
 {
     if (!std::isnan(max_lat) && std::abs(max_lat) >= 90) {
@@ -137,12 +138,53 @@ MaRC::PolarStereographic::projection_name() const
     return "Polar Stereographic";
 }
 
+bool
+MaRC::PolarStereographic::map_coordinates(std::size_t samples,
+                                          std::size_t lines,
+                                          double lat,
+                                          double lon,
+                                          double & sample,
+                                          double & line) const
+{
+    // See plot_map() for the meaning of these values.
+    double const rho_max =
+        this->stereo_rho(this->body_->graphic_latitude(this->max_lat_));
+    auto const min_dim = std::min(samples, lines);
+    double const pix_conv_val = 2 * rho_max / min_dim;
+
+    bool const ccw =
+        ((this->north_pole_ && this->body_->prograde())
+         || (!this->north_pole_ && !this->body_->prograde()));
+
+    // PlanetoGRAPHIC latitude relative to the pole at the center of
+    // the map.
+    double const latg =
+        this->body_->graphic_latitude(this->north_pole_ ? lat : -lat);
+
+    // Distance from the center of the map in pixels.
+    double const r =
+        stereo_rho_impl(*this->body_, this->rho_coeff_, latg)
+        / pix_conv_val;
+
+    // Invert lon = atan2((ccw ? Y : -Y), X).
+    double const X = r * std::cos(lon);
+    double const Y = (ccw ? 1 : -1) * r * std::sin(lon);
+
+    sample = Y + samples / 2.0;
+    line   = X + lines / 2.0;
+
+    return
+        std::isfinite(r)
+        && sample >= 0 && sample <= samples
+        && line   >= 0 && line   <= lines;
+}
+
 void
-MaRC::PolarStereographic::plot_map(std::size_t samples,
-                                   std::size_t lines,
+MaRC::PolarStereographic::plot_map(plot_region const & region,
                                    plot_type const & plot) const
 {
-    std::size_t offset = 0;
+    auto const samples = region.samples();
+    auto const lines   = region.lines();
 
     /*
       The maximum "rho" at the smaller of the map dimensions.  For
@@ -165,163 +207,82 @@ MaRC::PolarStereographic::plot_map(std::size_t samples,
         ((this->north_pole_ && this->body_->prograde())
          || (!this->north_pole_ && !this->body_->prograde()));
 
-    auto const map_equation =
-        [&](double latg){
-            return stereo_rho_impl(*this->body_, this->rho_coeff_, latg);
-        };
-
-    for (std::size_t k = 0; k < lines; ++k) {
-        double const X = k + 0.5 - lines / 2.0;
-
-        for (std::size_t i = 0; i < samples; ++i, ++offset) {
-            double const Y   = i + 0.5 - samples / 2.0;
-
-            /**
-             * @note Rho may actually be larger than rho_max when
-             *       mapping pixels along the larger of the map
-             *       dimensions.  That should be okay since rho will
-             *       never correspond to the pole that isn't at the
-             *       center of the map.
-             */
-            double const rho = pix_conv_val * std::hypot(Y, X);
-
-            /**
-             * @todo We shouldn't have to search from pole-to-pole for
-             *       the latitude that gives us the above value for
-             *       @c rho.  Try to get the root finding code to work
-             *       with the initial guess instead, or at the very
-             *       least reduce the size of the search bracket.
-             */
-            /*
-              Obtain an initial guess by solving the polar
-              stereographic projection equation for the latitude for a
-              spherical body (first eccentricity is zero).
-            */
-            // double const latg_guess =
-            //     C::pi_2 - 2 * std::atan(rho / 2 / this->body_->eq_rad());
-
-            // l + (l * 0.1) = l * (1 + 0.1) = 1.1 * l
-            //     l - (l * 0.1) = l * (1 - 0.1) = 0.9 * l
-            // double const ll = std::max(latg_guess * 1.1, -89.9 * C::degree);
-            // double const ul = std::min(latg_guess * 0.9,  89.9 * C::degree);
-            double const ll = -C::pi_2;
-            double const ul =  C::pi_2;
-
-            /**
-             * @todo Pass in a function that directly computes the
-             *       first derivative of the Polar Stereographic
-             *       equation, without relying on numerical
-             *       differentation techniques, to speed up root
-             *       finding and improve accuracy.
-             */
-
-            // PlanetoGRAPHIC latitude.
-            double const latg =
-                MaRC::root_find(rho, ll, ul, map_equation);
-
-            // MaRC::debug("(latg_guess, latg) = ({}, {})",
-            //             latg_guess,
-            //             latg);
-
-            // Convert to planetoCENTRIC latitude.
-            double const lat =
-                this->body_->centric_latitude(this->north_pole_
-                                              ? latg
-                                              : -latg);
-
-            double const lon =
-                std::atan2((ccw ? Y : -Y), X);
-
-            plot(lat, lon, offset);
-        }
-    }
-}
-
-void
-MaRC::PolarStereographic::plot_grid(std::size_t samples,
-                                    std::size_t lines,
-                                    double lat_interval,
-                                    double lon_interval,
-                                    grid_type & grid) const
-{
-    static constexpr std::size_t imax = 2000;
+    bool const fast_math = this->math() == math_mode::fast;
 
-    double const rho_max =
-        this->stereo_rho(this->body_->graphic_latitude(this->max_lat_));
-    double const min_dim = std::min(samples - 1, lines - 1);
-    double const pix_conv_val = 2 * rho_max / min_dim;
-
-    static constexpr auto white =
-        std::numeric_limits<typename grid_type::value_type>::max();
-
-    // Draw latitude lines
-    for (double n = -90 + lat_interval; n < 90; n += lat_interval) {
-        /**
-         * @bug Shouldn't we take into account the maximum latitude of
-         *      the projection here?
-         */
-
-        // Convert to planetographic latitude.
-        double const nn = this->body_->graphic_latitude(n * C::degree);
-
-        double const rho = this->stereo_rho(nn);
-
-        for (std::size_t m = 0; m < imax; ++m) {
-            double const mm =
-                static_cast<double>(m) / imax * C::degree * 360;
-
-            double const z = rho * std::cos(mm);
-            double const x = rho * std::sin(mm);
-
-            // if (z > rho_max || x > rho_max)
-            //     continue;
-
-            double const k = std::round(z / pix_conv_val + lines / 2.0);
-            double const i = std::round(x / pix_conv_val + samples / 2.0);
-
-            if (i >= 0 && i < static_cast<double>(samples)
-                && k >= 0 && k < static_cast<double>(lines)) {
-                std::size_t const offset =
-                    static_cast<std::size_t>(k) * samples;
-
-                grid[offset + static_cast<std::size_t>(i)] = white;
-            }
-        }
-    }
-
-    // Draw longitude lines.
-    for (double m = 360; m > 0; m -= lon_interval) {
-        double const mm = m * C::degree;  // Convert to radians
-
-        for (std::size_t n = 0; n < imax; ++n) {
-            double const nn =
-                static_cast<double>(n) / imax * C::degree * 360;
-
-            /**
-             * @bug Shouldn't we take into account the maximum
-             *      latitude of the projection here?
-             */
-
-            double const rho = this->stereo_rho(nn);
-
-            double const z = rho * std::cos(mm);
-            double const x = rho * std::sin(mm);
-
-            // if (z > rho_max || x > rho_max)
-            //     continue;
-
-            double const k = std::round(z / pix_conv_val + lines / 2.0);
-            double const i = std::round(x / pix_conv_val + samples / 2.0);
-
-            if (i >= 0 && i < static_cast<double>(samples)
-                && k >= 0 && k < static_cast<double>(lines)) {
-                std::size_t const offset =
-                    static_cast<std::size_t>(k) * samples;
-
-                grid[offset + static_cast<std::size_t>(i)] = white;
-            }
-        }
-    }
+    /*
+      Specialize the inverse projection for the type of the body.
+      The latitude conversions are identities on a sphere.
+    */
+    MaRC::visit_body(
+        *this->body_,
+        [&](auto const & body)
+        {
+            using body_type = std::decay_t<decltype(body)>;
+
+            // Inverse Polar Stereographic projection at a map
+            // location.
+            auto const inverse =
+                [&](double sample, double line, double & lat, double & lon)
+                {
+                    double const X = line   - lines   / 2.0;
+                    double const Y = sample - samples / 2.0;
+
+                    /**
+                     * @note Rho may actually be larger than rho_max
+                     *       when mapping pixels along the larger of
+                     *       the map dimensions.  That should be okay
+                     *       since rho will never correspond to the
+                     *       pole that isn't at the center of the
+                     *       map.
+                     */
+                    double const rho =
+                        pix_conv_val
+                        * (fast_math
+                           ? MaRC::fast::hypot(Y, X)
+                           : std::hypot(Y, X));
+
+                    /*
+                      The Polar Stereographic equation for an oblate
+                      spheroid is that of a sphere in terms of the
+                      conformal latitude chi, i.e.:
+
+                        rho = rho_coeff * tan(pi / 4 - chi / 2)
+
+                      Invert the spherical equation, and convert the
+                      resulting conformal latitude to a
+                      planetoGRAPHIC latitude.
+                    */
+                    double const t = rho / this->rho_coeff_;
+                    double const chi =
+                        C::pi_2
+                        - 2 * (fast_math
+                               ? MaRC::fast::atan(t)
+                               : std::atan(t));
+
+                    // PlanetoGRAPHIC latitude.
+                    double latg = chi;
+
+                    if constexpr (!std::is_same_v<body_type, Sphere>)
+                        latg = this->conformal_.graphic(chi);
+
+                    // Convert to planetoCENTRIC latitude.
+                    lat =
+                        body.body_type::centric_latitude(this->north_pole_
+                                                         ? latg
+                                                         : -latg);
+
+                    double const y = (ccw ? Y : -Y);
+
+                    lon =
+                        fast_math
+                        ? MaRC::fast::atan2(y, X)
+                        : std::atan2(y, X);
+
+                    return true;
+                };
+
+            this->plot_coordinates(region, body, inverse, plot);
+        });
 }
 
 double
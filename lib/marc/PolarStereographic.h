@@ -2,7 +2,7 @@
 /**
  * @file PolarStereographic.h
  *
- * Copyright (C) 2004, 2017-2018  Ossama Othman
+ * Copyright (C) 2004, 2017-2018, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -13,6 +13,7 @@
 #define MARC_POLAR_STEREOGRAPHIC_H
 
 #include <marc/MapFactory.h>
+#include <marc/conformal_latitude.h>
 
 #include <memory>
 
@@ -81,6 +82,13 @@ namespace MaRC
          */
         ///@{
         char const * projection_name() const override;
+
+        bool map_coordinates(std::size_t samples,
+                             std::size_t lines,
+                             double lat,
+                             double lon,
+                             double & sample,
+                             double & line) const override;
         ///@}
 
         ///
@@ -98,22 +106,9 @@ namespace MaRC
          *
          * @see @c MaRC::MapFactory::plot_map().
          */
-        void plot_map(std::size_t samples,
-                      std::size_t lines,
+        void plot_map(plot_region const & region,
                       plot_type const & plot) const override;
 
-        /**
-         * Create the Polar Stereographic map latitude/longitude
-         * grid.
-         *
-         * @see @c MaRC::MapFactory::plot_grid().
-         */
-        void plot_grid(std::size_t samples,
-                       std::size_t lines,
-                       double lat_interval,
-                       double lon_interval,
-                       grid_type & grid) const override;
-
     private:
 
         /// The underlying Polar Stereographic projection equation.
@@ -140,6 +135,9 @@ namespace MaRC
         /// Coefficient used in scale distortion equation.
         double const distortion_coeff_;
 
+        /// Conformal latitude conversion for the body.
+        conformal_latitude const conformal_;
+
         /// @c true if north pole is at center of map.  @c false if
         /// south pole is at center.
         bool const north_pole_;
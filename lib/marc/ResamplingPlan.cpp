@@ -0,0 +1,251 @@
+/**
+ * @file ResamplingPlan.cpp
+ *
+ * Copyright (C) 2026  Ossama Othman
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * @author Ossama Othman
+ */
+
+#include "ResamplingPlan.h"
+
+#include <algorithm>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <cmath>
+#include <cstring>
+
+
+namespace
+{
+    /// Identifies a stream containing a resampling plan.
+    constexpr char magic[] = "MaRCPLAN";
+
+    /// Resampling plan stream format version.
+    constexpr std::uint32_t version = 1;
+
+    /// Detects streams written with a different byte order.
+    constexpr std::uint32_t byte_order = 0x01020304;
+
+    template <typename T>
+    void write(std::ostream & s, T const * data, std::size_t count)
+    {
+        s.write(reinterpret_cast<char const *>(data),
+                static_cast<std::streamsize>(count * sizeof(T)));
+    }
+
+    template <typename T>
+    void write(std::ostream & s, T value)
+    {
+        write(s, &value, 1);
+    }
+
+    template <typename T>
+    void write(std::ostream & s, std::vector<T> const & v)
+    {
+        write(s, static_cast<std::uint64_t>(v.size()));
+        write(s, v.data(), v.size());
+    }
+
+    template <typename T>
+    void read(std::istream & s, T * data, std::size_t count)
+    {
+        s.read(reinterpret_cast<char *>(data),
+               static_cast<std::streamsize>(count * sizeof(T)));
+
+        if (!s)
+            throw std::runtime_error("Unable to read resampling plan.");
+    }
+
+    template <typename T>
+    T read(std::istream & s)
+    {
+        T value;
+
+        read(s, &value, 1);
+
+        return value;
+    }
+
+    template <typename T>
+    std::vector<T> read_vector(std::istream & s)
+    {
+        auto const size = read<std::uint64_t>(s);
+
+        /*
+          Read in bounded chunks so that a corrupt size doesn't
+          trigger a huge allocation before the stream runs out.
+        */
+        constexpr std::uint64_t chunk = 1 << 20;
+
+        std::vector<T> v;
+
+        for (std::uint64_t n = 0; n < size; ) {
+            auto const count = std::min(chunk, size - n);
+
+            v.resize(static_cast<std::size_t>(n + count));
+            read(s, v.data() + n, static_cast<std::size_t>(count));
+
+            n += count;
+        }
+
+        return v;
+    }
+}
+
+// ----------------------------------------------------------------
+
+MaRC::ResamplingPlan::ResamplingPlan()
+    : samples_(0)
+    , lines_(0)
+    , sources_()
+    , offsets_(1, 0)
+    , images_()
+    , pixels_()
+    , weights_()
+{
+}
+
+MaRC::ResamplingPlan::ResamplingPlan(std::size_t samples,
+                                     std::size_t lines,
+                                     std::vector<std::uint64_t> sources,
+                                     std::vector<std::uint64_t> offsets,
+                                     std::vector<std::uint32_t> images,
+                                     std::vector<std::uint64_t> pixels,
+                                     std::vector<double> weights)
+    : samples_(samples)
+    , lines_(lines)
+    , sources_(std::move(sources))
+    , offsets_(std::move(offsets))
+    , images_(std::move(images))
+    , pixels_(std::move(pixels))
+    , weights_(std::move(weights))
+{
+    auto const taps = this->weights_.size();
+
+    if (this->offsets_.size() != samples * lines + 1
+        || this->offsets_.front() != 0
+        || this->offsets_.back() != taps
+        || this->images_.size() != taps
+        || this->pixels_.size() != taps)
+        throw std::invalid_argument("Inconsistent resampling plan.");
+
+    for (std::size_t n = 1; n < this->offsets_.size(); ++n)
+        if (this->offsets_[n] < this->offsets_[n - 1])
+            throw std::invalid_argument("Inconsistent resampling plan.");
+
+    for (std::size_t n = 0; n < taps; ++n) {
+        auto const image = this->images_[n];
+
+        if (image >= this->sources_.size()
+            || this->pixels_[n] >= this->sources_[image])
+            throw std::invalid_argument(
+                "Resampling plan tap is not within source images.");
+    }
+}
+
+void
+MaRC::ResamplingPlan::save(std::ostream & s) const
+{
+    write(s, magic, sizeof(magic));
+    write(s, version);
+    write(s, byte_order);
+    write(s, static_cast<std::uint64_t>(this->samples_));
+    write(s, static_cast<std::uint64_t>(this->lines_));
+    write(s, this->sources_);
+    write(s, this->offsets_);
+    write(s, this->images_);
+    write(s, this->pixels_);
+    write(s, this->weights_);
+
+    if (!s)
+        throw std::runtime_error("Unable to write resampling plan.");
+}
+
+MaRC::ResamplingPlan
+MaRC::ResamplingPlan::load(std::istream & s)
+{
+    char m[sizeof(magic)];
+
+    read(s, m, sizeof(m));
+
+    if (std::memcmp(m, magic, sizeof(magic)) != 0)
+        throw std::runtime_error("Stream does not contain a "
+                                 "resampling plan.");
+
+    if (read<std::uint32_t>(s) != version)
+        throw std::runtime_error("Unsupported resampling plan version.");
+
+    if (read<std::uint32_t>(s) != byte_order)
+        throw std::runtime_error("Resampling plan byte order does not "
+                                 "match this platform.");
+
+    auto const samples = read<std::uint64_t>(s);
+    auto const lines   = read<std::uint64_t>(s);
+
+    auto sources = read_vector<std::uint64_t>(s);
+    auto offsets = read_vector<std::uint64_t>(s);
+    auto images  = read_vector<std::uint32_t>(s);
+    auto pixels  = read_vector<std::uint64_t>(s);
+    auto weights = read_vector<double>(s);
+
+    try {
+        return ResamplingPlan(static_cast<std::size_t>(samples),
+                              static_cast<std::size_t>(lines),
+                              std::move(sources),
+                              std::move(offsets),
+                              std::move(images),
+                              std::move(pixels),
+                              std::move(weights));
+    } catch (std::invalid_argument const & e) {
+        throw std::runtime_error(e.what());
+    }
+}
+
+bool
+MaRC::ResamplingPlan::gather(source_list const & sources,
+                             std::size_t offset,
+                             double & datum) const
+{
+    auto const first = this->offsets_[offset];
+    auto const last  = this->offsets_[offset + 1];
+
+    double sum = 0;
+    double weight_sum = 0;
+
+    for (auto n = first; n < last; ++n) {
+        double const d = sources[this->images_[n]][this->pixels_[n]];
+
+        // Exclude invalid data from the weighted average.
+        if (!std::isnan(d)) {
+            double const w = this->weights_[n];
+
+            sum += w * d;
+            weight_sum += w;
+        }
+    }
+
+    if (weight_sum <= 0)
+        return false;
+
+    datum = sum / weight_sum;
+
+    return true;
+}
+
+void
+MaRC::ResamplingPlan::check_sources(source_list const & sources) const
+{
+    auto const count = this->sources_.size();
+
+    if (sources.size() != count)
+        throw std::invalid_argument("Number of source images does not "
+                                    "match resampling plan.");
+
+    for (std::size_t i = 0; i < count; ++i)
+        if (sources[i].size() != this->sources_[i])
+            throw std::invalid_argument("Source image size does not "
+                                        "match resampling plan.");
+}
@@ -0,0 +1,239 @@
+// -*- C++ -*-
+/**
+ * @file ResamplingPlan.h
+ *
+ * Copyright (C) 2026  Ossama Othman
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * @author Ossama Othman
+ */
+
+#ifndef MARC_RESAMPLING_PLAN_H
+#define MARC_RESAMPLING_PLAN_H
+
+#include <marc/extrema.h>
+#include <marc/plot_info.h>
+#include <marc/Export.h>
+
+#include <vector>
+#include <iosfwd>
+#include <cstdint>
+#include <cstddef>
+
+
+namespace MaRC
+{
+
+    /**
+     * @class ResamplingPlan ResamplingPlan.h <marc/ResamplingPlan.h>
+     *
+     * @brief Recorded mapping from source image pixels to map
+     *        pixels.
+     *
+     * Mapping a source image requires computing the source image
+     * pixel corresponding to every map pixel, checking its
+     * visibility, and interpolating the data around it.  None of that
+     * depends on the source image data itself.  A resampling plan
+     * records the outcome of that work once, i.e. the source image
+     * pixels and weights contributing to each map pixel.  The plan
+     * may then be applied to new data, such as images in a time
+     * series or bands in a multispectral set with the same viewing
+     * geometry and map projection, as a sparse gather.
+     *
+     * Each map pixel is the weighted average of its contributing
+     * source pixels.  Source pixels containing invalid data
+     * (e.g. @c NaN) are excluded from that average.
+     *
+     * @note Photometric corrections are not recorded.  Photos
+     *       with a photometric correction that changes the data do
+     *       not support resampling plans.
+     *
+     * @see MapFactory::make_plan()
+     */
+    class MARC_API ResamplingPlan
+    {
+    public:
+
+        /**
+         * @struct tap
+         *
+         * @brief Source image pixel contributing to a map pixel.
+         */
+        struct tap
+        {
+            /// Index of the source image containing the pixel.
+            std::size_t image;
+
+            /**
+             * @brief Offset of the pixel in the source image.
+             *
+             * The offset is @c line @c * @c samples @c + @c sample
+             * in the entire source image.
+             */
+            std::size_t pixel;
+
+            /// Weight of the pixel.
+            double weight;
+        };
+
+        /// Type of list containing the taps for a map pixel.
+        using tap_list = std::vector<tap>;
+
+        /**
+         * @brief Type of list containing the data of each source
+         *        image.
+         *
+         * The data of each source image must have the same layout
+         * as the data from which the plan was made, including any
+         * inversion, but must contain the entire image rather than
+         * only its non-nibbled region.
+         */
+        using source_list = std::vector<std::vector<double>>;
+
+        /// Constructor for an empty plan.
+        ResamplingPlan();
+
+        /**
+         * @brief Constructor.
+         *
+         * The plan is stored in compressed sparse row form, where
+         * the taps of map pixel @c n are in the half-open interval
+         * [@a offsets[n], @a offsets[n + 1]) of the @a images,
+         * @a pixels and @a weights arrays.
+         *
+         * @param[in] samples Number of samples in the map.
+         * @param[in] lines   Number of lines   in the map.
+         * @param[in] sources Number of pixels in each source image.
+         * @param[in] offsets First tap of each map pixel, followed
+         *                    by the total number of taps.
+         * @param[in] images  Source image of each tap.
+         * @param[in] pixels  Source image pixel of each tap.
+         * @param[in] weights Weight of each tap.
+         *
+         * @throw std::invalid_argument Inconsistent plan.
+         */
+        ResamplingPlan(std::size_t samples,
+                       std::size_t lines,
+                       std::vector<std::uint64_t> sources,
+                       std::vector<std::uint64_t> offsets,
+                       std::vector<std::uint32_t> images,
+                       std::vector<std::uint64_t> pixels,
+                       std::vector<double> weights);
+
+        /// Number of samples in the map.
+        std::size_t samples() const { return this->samples_; }
+
+        /// Number of lines in the map.
+        std::size_t lines() const { return this->lines_; }
+
+        /// Number of source images.
+        std::size_t sources() const { return this->sources_.size(); }
+
+        /// Total number of taps in the plan.
+        std::size_t size() const { return this->weights_.size(); }
+
+        /// Does the plan contain any taps?
+        bool empty() const { return this->weights_.empty(); }
+
+        /**
+         * @brief Map the given source image data.
+         *
+         * @tparam        T       Map element data type.
+         * @param[in]     sources Data of each source image.
+         * @param[in]     minmax  User-specified minimum and maximum
+         *                        allowed physical data values on the
+         *                        map.
+         * @param[in,out] info    Map plotting information.  The
+         *                        number of samples and lines must
+         *                        match the plan.
+         * @param[in,out] map     Map container.  It will be resized
+         *                        to fit the map, and all of its
+         *                        previous contents will be
+         *                        overwritten.
+         *
+         * @throw std::invalid_argument @a sources or @a info do not
+         *                              match the plan.
+         */
+        template <typename T>
+        void apply(source_list const & sources,
+                   extrema<T> const & minmax,
+                   plot_info<T> & info,
+                   std::vector<T> & map) const;
+
+        /**
+         * @brief Write the plan to a stream.
+         *
+         * The plan is written in a binary format with the native
+         * byte order and word size.
+         *
+         * @param[in,out] s Binary output stream.
+         *
+         * @throw std::runtime_error Unable to write the plan.
+         */
+        void save(std::ostream & s) const;
+
+        /**
+         * @brief Read a plan from a stream.
+         *
+         * @param[in,out] s Binary input stream.
+         *
+         * @return Plan written by @c save().
+         *
+         * @throw std::runtime_error Unable to read the plan, or it
+         *                           was not written on a platform
+         *                           with the same byte order.
+         */
+        static ResamplingPlan load(std::istream & s);
+
+    private:
+
+        /**
+         * @brief Gather the datum for a given map pixel.
+         *
+         * @param[in]  sources Data of each source image.
+         * @param[in]  offset  Map pixel offset.
+         * @param[out] datum   Weighted average of the valid data at
+         *                     the map pixel taps.
+         *
+         * @retval true  Valid data found.
+         * @retval false No valid data at the map pixel.
+         */
+        bool gather(source_list const & sources,
+                    std::size_t offset,
+                    double & datum) const;
+
+        /// Throw if @a sources do not match the plan.
+        void check_sources(source_list const & sources) const;
+
+    private:
+
+        /// Number of samples in the map.
+        std::size_t samples_;
+
+        /// Number of lines in the map.
+        std::size_t lines_;
+
+        /// Number of pixels in each source image.
+        std::vector<std::uint64_t> sources_;
+
+        /// First tap of each map pixel, followed by the tap count.
+        std::vector<std::uint64_t> offsets_;
+
+        /// Source image of each tap.
+        std::vector<std::uint32_t> images_;
+
+        /// Source image pixel of each tap.
+        std::vector<std::uint64_t> pixels_;
+
+        /// Weight of each tap.
+        std::vector<double> weights_;
+
+    };
+
+}
+
+
+#include "marc/ResamplingPlan_t.cpp"
+
+#endif  /* MARC_RESAMPLING_PLAN_H */
@@ -0,0 +1,59 @@
+/**
+ * @file ResamplingPlan_t.cpp
+ *
+ * Copyright (C) 2026  Ossama Othman
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * @author Ossama Othman
+ */
+
+#ifndef MARC_RESAMPLING_PLAN_T_CPP
+#define MARC_RESAMPLING_PLAN_T_CPP
+
+#include "marc/ResamplingPlan.h"
+
+#include <limits>
+#include <stdexcept>
+
+
+template <typename T>
+void
+MaRC::ResamplingPlan::apply(source_list const & sources,
+                            extrema<T> const & minmax,
+                            plot_info<T> & info,
+                            std::vector<T> & map) const
+{
+    if (info.samples() != this->samples_ || info.lines() != this->lines_)
+        throw std::invalid_argument("Map dimensions do not match "
+                                    "resampling plan.");
+
+    this->check_sources(sources);
+
+    // Allowed range of physical data values on the map.
+    auto const & minimum = minmax.minimum();
+    auto const & maximum = minmax.maximum();
+
+    extrema<T> const e(minimum ? *minimum : std::numeric_limits<T>::lowest(),
+                       maximum ? *maximum : std::numeric_limits<T>::max());
+
+    // Initialize the map, reusing existing storage if available.
+    auto const size = this->samples_ * this->lines_;
+
+    map.assign(size, info.blank_value());
+
+    for (std::size_t offset = 0; offset < size; ++offset) {
+        double datum = 0;
+
+        if (this->gather(sources, offset, datum) && e.in_range(datum)) {
+            map[offset] = static_cast<T>(datum);
+            info.update_extrema(map[offset]);
+        }
+    }
+
+    // Inform "observers" of map completion.
+    info.notifier().notify_done(map.size());
+}
+
+
+#endif  /* MARC_RESAMPLING_PLAN_T_CPP */
@@ -1,7 +1,7 @@
 /**
  * @file SimpleCylindrical.cpp
  *
- * Copyright (C) 1996-1997, 1999, 2003-2004, 2017-2018  Ossama Othman
+ * Copyright (C) 1996-1997, 1999, 2003-2004, 2017-2018, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -102,20 +102,71 @@ MaRC::SimpleCylindrical::projection_name() const
     return "Simple Cylindrical";
 }
 
+bool
+MaRC::SimpleCylindrical::map_coordinates(std::size_t samples,
+                                         std::size_t lines,
+                                         double lat,
+                                         double lon,
+                                         double & sample,
+                                         double & line) const
+{
+    // Map latitudes are planetoGRAPHIC if so configured.
+    if (this->graphic_lat_)
+        lat = this->body_->graphic_latitude(lat);
+
+    auto const lat_range = this->hi_lat_ - this->lo_lat_;
+    auto const lon_range = this->hi_lon_ - this->lo_lon_;
+
+    // Invert the longitude computation in get_longitude().
+    // PROGRADE:   West longitudes (increasing to the left)
+    // RETROGRADE: East longitudes (increasing to the right)
+    auto lon_shift =
+        std::fmod(this->body_->prograde()
+                  ? this->hi_lon_ - lon
+                  : lon - this->lo_lon_,
+                  C::_2pi);
+
+    if (lon_shift < 0)
+        lon_shift += C::_2pi;
+
+    if (lon_shift > lon_range)
+        return false;
+
+    sample = lon_shift / lon_range * samples;
+    line   = (lat - this->lo_lat_) / lat_range * lines;
+
+    return line >= 0 && line <= lines;
+}
+
+bool
+MaRC::SimpleCylindrical::wraps_longitude() const
+{
+    constexpr int ulps = 2;
+
+    return MaRC::almost_equal(this->hi_lon_ - this->lo_lon_,
+                              C::_2pi,
+                              ulps);
+}
+
 void
-MaRC::SimpleCylindrical::plot_map(std::size_t samples,
-                                  std::size_t lines,
+MaRC::SimpleCylindrical::plot_map(plot_region const & region,
                                   plot_type const & plot) const
 {
+    auto const samples = region.samples();
+    auto const lines   = region.lines();
+
     // Latitudes (radians) per line.
     auto const cf = (this->hi_lat_ - this->lo_lat_) / lines;
 
     // Longitudes (radians) per sample.
     auto const lon_cf = (this->hi_lon_ - this->lo_lon_) / samples;
 
-    std::size_t offset = 0;
-
     for (std::size_t k = 0; k < lines; ++k) {
+        auto const spans = region.spans(k);
+
+        if (spans.empty())
+            continue;
+
         // Compute latitude at center of pixel.
         auto lat = (k + 0.5) * cf + this->lo_lat_;
 
@@ -123,10 +174,12 @@ MaRC::SimpleCylindrical::plot_map(std::size_t samples,
         if (this->graphic_lat_)
             lat = this->body_->centric_latitude(lat);
 
-        for (std::size_t i = 0; i < samples; ++i, ++offset) {
-            auto const lon = this->get_longitude(i, lon_cf);
+        for (auto const & s : spans) {
+            for (auto i = s.first; i < s.last; ++i) {
+                auto const lon = this->get_longitude(i, lon_cf);
 
-            plot(lat, lon, offset);
+                plot(lat, lon, k * samples + i);
+            }
         }
     }
 }
@@ -2,7 +2,7 @@
 /**
  * @file SimpleCylindrical.h
  *
- * Copyright (C) 1996-1997, 1999, 2003-2004, 2017-2018  Ossama Othman
+ * Copyright (C) 1996-1997, 1999, 2003-2004, 2017-2018, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -86,6 +86,15 @@ namespace MaRC
          */
         ///@{
         char const * projection_name() const override;
+
+        bool map_coordinates(std::size_t samples,
+                             std::size_t lines,
+                             double lat,
+                             double lon,
+                             double & sample,
+                             double & line) const override;
+
+        bool wraps_longitude() const override;
         ///@}
 
     private:
@@ -95,8 +104,7 @@ namespace MaRC
          *
          * @see @c MaRC::MapFactory::plot_map().
          */
-        void plot_map(std::size_t samples,
-                      std::size_t lines,
+        void plot_map(plot_region const & region,
                       plot_type const & plot) const override;
 
         /**
@@ -1,7 +1,7 @@
 /**
  * @file SourceImage.cpp
  *
- * Copyright (C) 1999, 2003-2004, 2017, 2021  Ossama Othman
+ * Copyright (C) 1999, 2003-2004, 2017, 2021, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -10,6 +10,8 @@
 
 #include "SourceImage.h"
 
+#include <limits>
+
 
 bool
 MaRC::SourceImage::read_data(double lat,
@@ -20,3 +22,55 @@ MaRC::SourceImage::read_data(double lat,
 {
     return this->read_data(lat, lon, data);
 }
+
+bool
+MaRC::SourceImage::read_bands(double lat,
+                              double lon,
+                              double * data) const
+{
+    double datum = 0;
+
+    bool const found = this->read_data(lat, lon, datum);
+
+    data[0] = (found ? datum : std::numeric_limits<double>::quiet_NaN());
+
+    return found;
+}
+
+std::vector<std::uint64_t>
+MaRC::SourceImage::resampling_sources() const
+{
+    return {};  // Resampling plans are not supported by default.
+}
+
+bool
+MaRC::SourceImage::read_taps(double /* lat */,
+                             double /* lon */,
+                             std::size_t /* first */,
+                             ResamplingPlan::tap_list & /* taps */,
+                             double & /* weight */,
+                             bool /* scan */) const
+{
+    return false;
+}
+
+bool
+MaRC::SourceImage::resampling_data(
+    std::size_t /* band */,
+    ResamplingPlan::source_list & /* data */) const
+{
+    return false;
+}
+
+bool
+MaRC::SourceImage::footprint(footprint_visitor const & /* visit */) const
+{
+    return false;  // The footprint is not known by default.
+}
+
+bool
+MaRC::SourceImage::visibility_bounds(
+    std::vector<body_cap> & /* caps */) const
+{
+    return false;  // Data may be anywhere on the body by default.
+}
@@ -2,7 +2,7 @@
 /**
  * @file SourceImage.h
  *
- * Copyright (C) 1999, 2003-2004, 2017-2018, 2021  Ossama Othman
+ * Copyright (C) 1999, 2003-2004, 2017-2018, 2021, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -13,8 +13,12 @@
 #ifndef MARC_SOURCE_IMAGE_H
 #define MARC_SOURCE_IMAGE_H
 
+#include <marc/ResamplingPlan.h>
 #include <marc/Export.h>
 
+#include <vector>
+#include <functional>
+#include <cstdint>
 #include <cstddef>
 
 
@@ -33,6 +37,57 @@ namespace MaRC
     {
     public:
 
+        /**
+         * @struct footprint_cell
+         *
+         * @brief Outline of the part of a source image pixel on the
+         *        body.
+         *
+         * The vertices are the corners of the pixel on the body,
+         * and the points where the limb of the body crosses the
+         * edges of the pixel.
+         */
+        struct footprint_cell
+        {
+            /// Maximum number of vertices.
+            static constexpr std::size_t max_vertices = 6;
+
+            /// Number of vertices.
+            std::size_t vertices;
+
+            /// Planetocentric latitudes of the vertices in radians.
+            double lat[max_vertices];
+
+            /// Longitudes of the vertices in radians.
+            double lon[max_vertices];
+        };
+
+        /// Function called for each pixel in an image footprint.
+        using footprint_visitor =
+            std::function<void(footprint_cell const &)>;
+
+        /**
+         * @struct body_cap
+         *
+         * @brief Spherical cap on the body.
+         *
+         * The cap contains the points on the body whose
+         * planetocentric radius is within the angle @c radius of
+         * that of the cap center, measured at the center of the
+         * body.
+         */
+        struct body_cap
+        {
+            /// Planetocentric latitude of the cap center in radians.
+            double lat;
+
+            /// Longitude of the cap center in radians.
+            double lon;
+
+            /// Angular radius of the cap in radians.
+            double radius;
+        };
+
         SourceImage() = default;
 
         // Disallow copying.
@@ -86,6 +141,157 @@ namespace MaRC
                                double & weight,
                                bool scan) const;
 
+        /**
+         * @brief Number of data bands in the source image.
+         *
+         * Source images ordinarily provide a single band of data.
+         * Multi-band images, such as planes of a multispectral image
+         * cube that share the same viewing geometry, provide one band
+         * per plane.
+         */
+        virtual std::size_t bands() const { return 1; }
+
+        /**
+         * @brief Retrieve physical data for all bands.
+         *
+         * Retrieve physical data for all bands at the given
+         * latitude and longitude.  Subclasses providing more than one
+         * band should override this method so that the work common
+         * to all bands, such as computing the image pixel
+         * corresponding to @a lat and @a lon, is only done once.
+         * The default implementation forwards the call to the
+         * concrete implementation of @c read_data().
+         *
+         * @param[in]  lat  Planetocentric latitude in radians.
+         * @param[in]  lon  Longitude in radians.
+         * @param[out] data Array of @c bands() elements that will
+         *                  contain the physical data retrieved from
+         *                  each band.  Elements corresponding to bands
+         *                  with no data will be set to @c NaN.
+         *
+         * @retval true  Physical data retrieved from at least one
+         *               band.
+         * @retval false No physical data retrieved.
+         */
+        virtual bool read_bands(double lat,
+                                double lon,
+                                double * data) const;
+
+        /**
+         * @brief Get the sizes of the images underlying this image.
+         *
+         * Source images that are backed by arrays of pixels, such as
+         * photos, may be mapped through a @c ResamplingPlan.  The
+         * default implementation returns an empty list, meaning
+         * resampling plans are not supported, as is the case for
+         * images computed from the viewing geometry alone.
+         *
+         * @return Number of pixels in each underlying image, or an
+         *         empty list if resampling plans are not supported.
+         */
+        virtual std::vector<std::uint64_t> resampling_sources() const;
+
+        /**
+         * @brief Retrieve the pixels contributing to the data at a
+         *        given latitude and longitude.
+         *
+         * Retrieve the underlying image pixels and weights that
+         * would be combined to obtain the data at the given
+         * latitude and longitude, without reading the data itself.
+         *
+         * @param[in]     lat    Planetocentric latitude in radians.
+         * @param[in]     lon    Longitude in radians.
+         * @param[in]     first  Index of the first image returned by
+         *                       @c resampling_sources() in the
+         *                       resampling plan.
+         * @param[in,out] taps   List to which the contributing
+         *                       pixels will be appended if
+         *                       successful.  Their weights sum to
+         *                       one.
+         * @param[in,out] weight Physical data weight.
+         * @param[in]     scan   Flag that determines if a data weight
+         *                       scan is performed.
+         *
+         * @retval true  Contributing pixels retrieved.
+         * @retval false No pixels contribute, or resampling plans
+         *               are not supported.
+         *
+         * @see @c read_data(double, double, double &, double &, bool)
+         */
+        virtual bool read_taps(double lat,
+                               double lon,
+                               std::size_t first,
+                               ResamplingPlan::tap_list & taps,
+                               double & weight,
+                               bool scan) const;
+
+        /**
+         * @brief Retrieve the data of the images underlying this
+         *        image.
+         *
+         * Retrieve the given band of each image returned by
+         * @c resampling_sources(), in the layout expected by
+         * @c ResamplingPlan::apply().
+         *
+         * @param[in]     band Band to be retrieved.
+         * @param[in,out] data List to which the data of each
+         *                     underlying image will be appended if
+         *                     successful.  Pixels with no data are
+         *                     @c NaN.
+         *
+         * @retval true  Data retrieved.
+         * @retval false No such band, or resampling plans are not
+         *               supported.
+         */
+        virtual bool resampling_data(
+            std::size_t band,
+            ResamplingPlan::source_list & data) const;
+
+        /**
+         * @brief Visit the region of the body covered by the image.
+         *
+         * Source images that only cover part of the body, such as
+         * photos, call @a visit with the body coordinates outlining
+         * each of their pixels on the body.  This allows
+         * the portion of a map covered by the image to be found
+         * through the forward map projection equations, without
+         * traversing the entire map.  The default implementation
+         * doesn't visit anything, meaning the image may cover the
+         * entire body, as is the case for images computed from the
+         * viewing geometry alone.
+         *
+         * @param[in] visit Function called for each pixel in the
+         *                  footprint of the image.
+         *
+         * @retval true  The image footprint was visited.
+         * @retval false The footprint of the image is not known.
+         */
+        virtual bool footprint(footprint_visitor const & visit) const;
+
+        /**
+         * @brief Bound the region of the body in which the image has
+         *        data.
+         *
+         * Source images that can only have data on part of the body,
+         * such as the side of the body visible in a photo, append
+         * spherical caps whose union contains all points on the body
+         * at which data may be read from the image.  This allows
+         * the portion of a map in which no data can be found to be
+         * culled before it is traversed.  Unlike @c footprint(), the
+         * bounds are cheap to compute, but they are coarse.  The
+         * default implementation doesn't bound anything, meaning the
+         * image may have data anywhere on the body.
+         *
+         * @param[in,out] caps Spherical caps bounding the region of
+         *                     the body in which the image has data
+         *                     are appended to this list.
+         *
+         * @retval true  The image only has data within @a caps.
+         * @retval false The image may have data anywhere on the
+         *               body.
+         */
+        virtual bool visibility_bounds(std::vector<body_cap> & caps) const;
+
     };
 
 } // End MaRC namespace
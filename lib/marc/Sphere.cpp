@@ -0,0 +1,142 @@
+/**
+ * @file Sphere.cpp
+ *
+ * Copyright (C) 2026  Ossama Othman
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * @author Ossama Othman
+ */
+
+#include "Sphere.h"
+
+#include <cmath>
+
+
+MaRC::Sphere::Sphere(bool prograde, double radius)
+    : OblateSpheroid(prograde, radius, radius, true)
+{
+}
+
+double
+MaRC::Sphere::mu(double sub_observ_lat,
+                 double sub_observ_lon,
+                 double lat,
+                 double lon,
+                 double range) const
+{
+    /*
+      Compute mu, the cosine of local normal-observer (emission)
+      angle.  The surface normal is the unit vector toward the point
+      from the center of the body, so its dot product with the unit
+      vector toward the observer is the cosine of the angle between
+      them at the center of the body.
+    */
+    double const r = this->radius();
+
+    double const cos_angle =
+        std::sin(sub_observ_lat) * std::sin(lat)
+        + std::cos(sub_observ_lat) * std::cos(lat)
+          * std::cos(sub_observ_lon - lon);
+
+    // Dot product of the normal and the vector from the point to the
+    // observer, divided by the magnitude of the latter.
+    return
+        (range * cos_angle - r)
+        / std::sqrt(range * range + r * r - 2 * range * r * cos_angle);
+}
+
+double
+MaRC::Sphere::mu0(double sub_solar_lat,
+                  double sub_solar_lon,
+                  double lat,
+                  double lon) const
+{
+    // Compute mu0, the cosine of sun-local normal (incidence) angle.
+    // The sun is assumed to be an infinite distance away.
+    return
+        std::sin(sub_solar_lat) * std::sin(lat)
+        + std::cos(sub_solar_lat) * std::cos(lat)
+          * std::cos(sub_solar_lon - lon);
+}
+
+double
+MaRC::Sphere::cos_phase(double sub_observ_lat,
+                        double sub_observ_lon,
+                        double sub_solar_lat,
+                        double sub_solar_lon,
+                        double lat,
+                        double lon,
+                        double range) const
+{
+    // Compute the cosine of the Sun-point on surface of body-Observer
+    // angle, i.e cosine of the phase angle Phi.
+    double const r = this->radius();
+
+    double const sin_lat = std::sin(lat);
+    double const cos_lat = std::cos(lat);
+    double const sin_so  = std::sin(sub_observ_lat);
+    double const cos_so  = std::cos(sub_observ_lat);
+    double const sin_ss  = std::sin(sub_solar_lat);
+    double const cos_ss  = std::cos(sub_solar_lat);
+
+    // See photometric_cosines() below.
+    double const o_n =
+        sin_so * sin_lat + cos_so * cos_lat * std::cos(sub_observ_lon - lon);
+    double const s_n =
+        sin_ss * sin_lat + cos_ss * cos_lat * std::cos(sub_solar_lon - lon);
+    double const o_s =
+        sin_so * sin_ss
+        + cos_so * cos_ss * std::cos(sub_observ_lon - sub_solar_lon);
+
+    return
+        (range * o_s - r * s_n)
+        / std::sqrt(range * range + r * r - 2 * range * r * o_n);
+}
+
+void
+MaRC::Sphere::photometric_cosines(double sub_observ_lat,
+                                  double sub_observ_lon,
+                                  double sub_solar_lat,
+                                  double sub_solar_lon,
+                                  double lat,
+                                  double lon,
+                                  double range,
+                                  double & mu,
+                                  double & mu0,
+                                  double & cos_phase) const
+{
+    /*
+      With n, o and s the unit vectors from the center of the body
+      toward the point on the surface, the observer and the sun,
+      respectively, and r the radius of the body:
+
+        mu        = (range * o.n - r) / |range * o - r * n|
+        mu0       = s.n
+        cos_phase = (range * o.s - r * s.n) / |range * o - r * n|
+    */
+    double const r = this->radius();
+
+    double const sin_lat = std::sin(lat);
+    double const cos_lat = std::cos(lat);
+    double const sin_so  = std::sin(sub_observ_lat);
+    double const cos_so  = std::cos(sub_observ_lat);
+    double const sin_ss  = std::sin(sub_solar_lat);
+    double const cos_ss  = std::cos(sub_solar_lat);
+
+    double const o_n =
+        sin_so * sin_lat + cos_so * cos_lat * std::cos(sub_observ_lon - lon);
+    double const s_n =
+        sin_ss * sin_lat + cos_ss * cos_lat * std::cos(sub_solar_lon - lon);
+    double const o_s =
+        sin_so * sin_ss
+        + cos_so * cos_ss * std::cos(sub_observ_lon - sub_solar_lon);
+
+    // Magnitude of vector from observer to point on body.
+    double const distance =
+        std::sqrt(range * range + r * r - 2 * range * r * o_n);
+
+    mu        = (range * o_n - r) / distance;
+    mu0       = s_n;
+    cos_phase = (range * o_s - r * s_n) / distance;
+}
@@ -0,0 +1,162 @@
+//   -*- C++ -*-
+/**
+ * @file Sphere.h
+ *
+ * Copyright (C) 2026  Ossama Othman
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * @author Ossama Othman
+ */
+
+#ifndef MARC_SPHERE_H
+#define MARC_SPHERE_H
+
+#include <marc/OblateSpheroid.h>
+#include <marc/Export.h>
+
+
+namespace MaRC
+{
+    /**
+     * @class Sphere Sphere.h <marc/Sphere.h>
+     *
+     * @brief Representation of a body modeled as a sphere.
+     *
+     * A sphere is an oblate spheroid with equal equatorial and polar
+     * radii.  Planetocentric and planetographic latitudes are the
+     * same on a sphere, and the surface normal at a point is the
+     * direction of the point from the center of the body.  The
+     * conversions between the two latitudes are therefore identities,
+     * and the cosines of the emission and incidence angles reduce to
+     * dot products.
+     */
+    class MARC_API Sphere final : public OblateSpheroid
+    {
+    public:
+
+        /// Constructor
+        /**
+         * @param[in] prograde Flag that states whether body rotation
+         *                     is prograde or retrograde.
+         * @param[in] radius   Radius in kilometers.
+         */
+        Sphere(bool prograde, double radius);
+
+        // Disallow copying.
+        Sphere(Sphere const &) = delete;
+        Sphere & operator=(Sphere const &) = delete;
+
+        // Disallow moving.
+        Sphere(Sphere &&) noexcept = delete;
+        Sphere & operator=(Sphere &&) = delete;
+
+        /// Destructor
+        ~Sphere() override = default;
+
+        /// Get the radius of the body.
+        double radius() const
+        {
+            return this->eq_rad();
+        }
+
+        /**
+         * @name MaRC::BodyData Virtual Methods
+         *
+         * Methods required by the MaRC::BodyData abstract base
+         * class.
+         */
+        ///@{
+        double centric_radius(double /* lat */) const override
+        {
+            return this->eq_rad();
+        }
+
+        double centric_latitude(double latg) const override
+        {
+            return latg;
+        }
+
+        double graphic_latitude(double lat) const override
+        {
+            return lat;
+        }
+
+        double mu(double sub_observ_lat,
+                  double sub_observ_lon,
+                  double lat,
+                  double lon,
+                  double range) const override;
+
+        double mu0(double sub_solar_lat,
+                   double sub_solar_lon,
+                   double lat,
+                   double lon) const override;
+
+        double cos_phase(double sub_observ_lat,
+                         double sub_observ_lon,
+                         double sub_solar_lat,
+                         double sub_solar_lon,
+                         double lat,
+                         double lon,
+                         double range) const override;
+
+        void photometric_cosines(double sub_observ_lat,
+                                 double sub_observ_lon,
+                                 double sub_solar_lat,
+                                 double sub_solar_lon,
+                                 double lat,
+                                 double lon,
+                                 double range,
+                                 double & mu,
+                                 double & mu0,
+                                 double & cos_phase) const override;
+        ///@}
+
+        using OblateSpheroid::centric_radius;
+
+    };
+
+    /**
+     * @brief Call a function with a body as its most derived type.
+     *
+     * Kernels that query the body at every map or image pixel may be
+     * written as a function template, or a generic lambda, that is
+     * instantiated once for each body type.  The @c BodyData
+     * methods called by the @c MaRC::Sphere instantiation are then
+     * resolved at compile time, allowing the latitude conversion
+     * identities to be inlined, rather than called through the
+     * virtual function table.  Calls in the @c MaRC::OblateSpheroid
+     * instantiation may be resolved at compile time as well by
+     * qualifying them with the body type, e.g.:
+     *
+     * @code
+     * MaRC::visit_body(body,
+     *                  [&](auto const & b)
+     *                  {
+     *                      using body_type =
+     *                          std::decay_t<decltype(b)>;
+     *
+     *                      lat = b.body_type::centric_latitude(latg);
+     *                  });
+     * @endcode
+     *
+     * @param[in] body Body under observation.
+     * @param[in] f    Function called with @a body as either a
+     *                 @c MaRC::Sphere or a @c MaRC::OblateSpheroid.
+     *
+     * @return The value returned from @a f.
+     */
+    template <typename F>
+    decltype(auto) visit_body(OblateSpheroid const & body, F && f)
+    {
+        if (body.is_sphere())
+            return f(static_cast<Sphere const &>(body));
+
+        return f(body);
+    }
+
+}
+
+
+#endif  /* MARC_SPHERE_H */
@@ -4,7 +4,7 @@
  *
  * %MaRC mathematical vector class and operations.
  *
- * Copyright (C) 2004, 2017-2018, 2021-2022  Ossama Othman
+ * Copyright (C) 2004, 2017-2018, 2021-2022, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -19,13 +19,73 @@
 #include <type_traits>
 #include <initializer_list>
 #include <algorithm>
-#include <numeric>
 #include <iterator>
+#include <utility>
 #include <stdexcept>
 
 
 namespace MaRC
 {
+    template <typename T, std::size_t M> class Vector;
+
+    namespace details
+    {
+        /**
+         * @brief Unrolled element-wise vector operation.
+         *
+         * Apply @a op to the corresponding elements of @a a and
+         * @a b, constructing the resulting vector directly rather
+         * than by copying and updating one element at a time in a
+         * loop.
+         *
+         * @note This function is not part of the public %MaRC
+         *       library API.
+         */
+        template <typename T,
+                  std::size_t M,
+                  typename Op,
+                  std::size_t ... I>
+        constexpr Vector<T, M> elementwise(Vector<T, M> const & a,
+                                           Vector<T, M> const & b,
+                                           Op op,
+                                           std::index_sequence<I ...>)
+        {
+            return Vector<T, M>(op(a[I], b[I]) ...);
+        }
+
+        /**
+         * @brief Unrolled vector scaling.
+         *
+         * @note This function is not part of the public %MaRC
+         *       library API.
+         */
+        template <typename T, std::size_t M, std::size_t ... I>
+        constexpr Vector<T, M> scale(Vector<T, M> const & v,
+                                     T x,
+                                     std::index_sequence<I ...>)
+        {
+            return Vector<T, M>((v[I] * x) ...);
+        }
+
+        /**
+         * @brief Unrolled dot product.
+         *
+         * The products are summed from left to right, in the same
+         * order as @c std::inner_product(), so results are unchanged
+         * to the last bit.
+         *
+         * @note This function is not part of the public %MaRC
+         *       library API.
+         */
+        template <typename T, std::size_t M, std::size_t ... I>
+        constexpr T dot_product(Vector<T, M> const & a,
+                                Vector<T, M> const & b,
+                                std::index_sequence<I ...>)
+        {
+            return (T(0) + ... + (a[I] * b[I]));
+        }
+    }
+
     /**
      * @class Vector Vector.h <marc/Vector.h>
      *
@@ -63,7 +123,7 @@ namespace MaRC
          * Initialize the elements of the vector to the default value,
          * i.e. @c T(), which is 0 for arithmetic types.
          */
-        Vector()
+        constexpr Vector()
             : vector_{}
         {
             static_assert(std::is_arithmetic<T>(),
@@ -247,14 +307,13 @@ namespace MaRC
          * @return This @c Vector after adding the @a rhs @c Vector to
          *         this one.
          */
-        Vector<T, M> & operator+=(Vector<T, M> const & rhs)
+        constexpr Vector<T, M> & operator+=(Vector<T, M> const & rhs)
         {
-            auto dest = this->begin();
-
-            for (auto const & src : rhs)
-                *(dest++) += src;
-
-            return *this;
+            return *this = details::elementwise(
+                *this,
+                rhs,
+                [](T a, T b) { return a + b; },
+                std::make_index_sequence<M>());
         }
 
         /**
@@ -265,14 +324,13 @@ namespace MaRC
          * @return This @c Vector after substracting the @a rhs
          *         @c Vector from this one.
          */
-        Vector<T, M> & operator-=(Vector<T, M> const & rhs)
+        constexpr Vector<T, M> & operator-=(Vector<T, M> const & rhs)
         {
-            auto dest = this->begin();
-
-            for (auto const & src : rhs)
-                *(dest++) -= src;
-
-            return *this;
+            return *this = details::elementwise(
+                *this,
+                rhs,
+                [](T a, T b) { return a - b; },
+                std::make_index_sequence<M>());
         }
 
         /**
@@ -284,12 +342,10 @@ namespace MaRC
          * @return This @c Vector after multiplying it by the scalar
          *         the @a rhs.
          */
-        Vector<T, M> & operator*=(T rhs)
+        constexpr Vector<T, M> & operator*=(T rhs)
         {
-            for (auto & elem : this->vector_)
-                elem *= rhs;
-
-            return *this;
+            return *this =
+                details::scale(*this, rhs, std::make_index_sequence<M>());
         }
 
         /**
@@ -347,10 +403,7 @@ namespace MaRC
     constexpr auto dot_product(Vector<T, M> const & a,
                                Vector<T, M> const & b)
     {
-        return std::inner_product(std::cbegin(a),
-                                  std::cend(a),
-                                  std::cbegin(b),
-                                  T(0));
+        return details::dot_product(a, b, std::make_index_sequence<M>());
     }
 
 }
@@ -363,13 +416,13 @@ namespace MaRC
  * @relates MaRC::Vector
  */
 template <typename T, std::size_t M>
-MaRC::Vector<T, M> const operator+(MaRC::Vector<T, M> const & lhs,
-                                   MaRC::Vector<T, M> const & rhs)
+constexpr MaRC::Vector<T, M> const
+operator+(MaRC::Vector<T, M> const & lhs, MaRC::Vector<T, M> const & rhs)
 {
-    MaRC::Vector<T, M> vector(lhs);
-    vector += rhs;
-
-    return vector;
+    return MaRC::details::elementwise(lhs,
+                                      rhs,
+                                      [](T a, T b) { return a + b; },
+                                      std::make_index_sequence<M>());
 }
 
 /**
@@ -378,13 +431,13 @@ MaRC::Vector<T, M> const operator+(MaRC::Vector<T, M> const & lhs,
  * @relates MaRC::Vector
  */
 template <typename T, std::size_t M>
-MaRC::Vector<T, M> const operator-(MaRC::Vector<T, M> const & lhs,
-                                   MaRC::Vector<T, M> const & rhs)
+constexpr MaRC::Vector<T, M> const
+operator-(MaRC::Vector<T, M> const & lhs, MaRC::Vector<T, M> const & rhs)
 {
-    MaRC::Vector<T, M> vector(lhs);
-    vector -= rhs;
-
-    return vector;
+    return MaRC::details::elementwise(lhs,
+                                      rhs,
+                                      [](T a, T b) { return a - b; },
+                                      std::make_index_sequence<M>());
 }
 
 /**
@@ -393,13 +446,10 @@ MaRC::Vector<T, M> const operator-(MaRC::Vector<T, M> const & lhs,
  * @relates MaRC::Vector
  */
 template <typename T, std::size_t M>
-MaRC::Vector<T, M> const operator*(MaRC::Vector<T, M> const & V,
-                                   T x)
+constexpr MaRC::Vector<T, M> const operator*(MaRC::Vector<T, M> const & V,
+                                             T x)
 {
-    MaRC::Vector<T, M> vector(V);
-    vector *= x;
-
-    return vector;
+    return MaRC::details::scale(V, x, std::make_index_sequence<M>());
 }
 
 /**
@@ -408,8 +458,8 @@ MaRC::Vector<T, M> const operator*(MaRC::Vector<T, M> const & V,
  * @relates MaRC::Vector
  */
 template <typename T, std::size_t M>
-MaRC::Vector<T, M> const operator*(T x,
-                                   MaRC::Vector<T, M> const & V)
+constexpr MaRC::Vector<T, M> const operator*(T x,
+                                             MaRC::Vector<T, M> const & V)
 {
     return V * x;
 }
@@ -1,7 +1,7 @@
 /**
  * @file ViewingGeometry.cpp
  *
- * Copyright (C) 1998-1999, 2003-2005, 2017, 2020  Ossama Othman
+ * Copyright (C) 1998-1999, 2003-2005, 2017, 2020, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -10,7 +10,8 @@
 
 #include "ViewingGeometry.h"
 #include "Constants.h"
-#include "OblateSpheroid.h"
+#include "Sphere.h"
+#include "vector_batch.h"
 #include "Mathematics.h"
 #include "Validate.h"
 #include "NullGeometricCorrection.h"
@@ -22,6 +23,7 @@
 # include "vector_formatter.h"
 #endif  // NDEBUG
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <stdexcept>
@@ -133,8 +135,11 @@ MaRC::ViewingGeometry::geometric_correction(
     this->geometric_correction_ = std::move(strategy);
 }
 
+template <typename Body>
 bool
-MaRC::ViewingGeometry::is_visible(double lat, double lon) const
+MaRC::ViewingGeometry::is_visible(Body const & body,
+                                  double lat,
+                                  double lon) const
 {
     /*
       mu is the cosine of the angle between:
@@ -148,13 +153,16 @@ MaRC::ViewingGeometry::is_visible(double lat, double lon) const
 
       Take into account an emission angle limit potentially set by the
       user as well.
+
+      The calls are qualified with the body type so that they are
+      resolved at compile time.
     */
     return
-        this->body_->mu(this->sub_observ_lat_,
-                        this->sub_observ_lon_,
-                        lat,
-                        lon,
-                        this->range_) > this->mu_limit_
+        body.Body::mu(this->sub_observ_lat_,
+                      this->sub_observ_lon_,
+                      lat,
+                      lon,
+                      this->range_) > this->mu_limit_
 
         /*
           mu0 is the angle between:
@@ -168,15 +176,49 @@ MaRC::ViewingGeometry::is_visible(double lat, double lon) const
           the dark side of the planet.
         */
         && (!this->use_terminator_
-            || this->body_->mu0(this->sub_solar_lat_,
-                                this->sub_solar_lon_,
-                                lat,
-                                lon) > 0);
+            || body.Body::mu0(this->sub_solar_lat_,
+                              this->sub_solar_lon_,
+                              lat,
+                              lon) > 0);
 
      // Visible if both the far-side and (if requested) the dark-side
      // checks passed.
 }
 
+bool
+MaRC::ViewingGeometry::is_visible(double lat, double lon) const
+{
+    return MaRC::visit_body(*this->body_,
+                            [&](auto const & body)
+                            {
+                                return this->is_visible(body, lat, lon);
+                            });
+}
+
+void
+MaRC::ViewingGeometry::visible_cap(double & lat,
+                                   double & lon,
+                                   double & radius) const
+{
+    /*
+      A point on the body is only visible if mu is positive, i.e. the
+      observer is above the plane tangent to the body at that point.
+      The center of a convex body is below all of its tangent planes,
+      so the surface normal is then within 90 degrees of the
+      sub-observer direction.  The surface normal is itself within
+      the largest planetographic and planetocentric latitude
+      difference of the planetocentric radius of the point.  That
+      difference is reached where the tangent of the planetocentric
+      latitude is the polar to equatorial radius ratio.
+    */
+    double const a = this->body_->eq_rad();
+    double const c = this->body_->pol_rad();
+
+    lat    = this->sub_observ_lat_;
+    lon    = this->sub_observ_lon_;
+    radius = C::pi_2 + std::abs(std::atan(a / c) - std::atan(c / a));
+}
+
 void
 MaRC::ViewingGeometry::sub_observ(double lat, double lon)
 {
@@ -842,16 +884,18 @@ MaRC::ViewingGeometry::use_terminator(bool u)
     this->use_terminator_ = u;
 }
 
+template <typename Body>
 bool
-MaRC::ViewingGeometry::latlon2pix(double lat,
+MaRC::ViewingGeometry::latlon2pix(Body const & body,
+                                  double lat,
                                   double lon,
                                   double & x,
                                   double & z) const
 {
-    if (!this->is_visible(lat, lon))
+    if (!this->is_visible(body, lat, lon))
         return false;  // Failure
 
-    double const radius = this->body_->centric_radius(lat);
+    double const radius = body.Body::centric_radius(lat);
 
     if (this->body_->prograde())
         lon  = this->sub_observ_lon_ - lon;
@@ -901,6 +945,23 @@ MaRC::ViewingGeometry::latlon2pix(double lat,
     return true;
 }
 
+bool
+MaRC::ViewingGeometry::latlon2pix(double lat,
+                                  double lon,
+                                  double & x,
+                                  double & z) const
+{
+    return MaRC::visit_body(*this->body_,
+                            [&](auto const & body)
+                            {
+                                return this->latlon2pix(body,
+                                                        lat,
+                                                        lon,
+                                                        x,
+                                                        z);
+                            });
+}
+
 bool
 MaRC::ViewingGeometry::pix2latlon(double sample,
                                   double line,
@@ -950,6 +1011,57 @@ MaRC::ViewingGeometry::pix2latlon(double sample,
     return success == 0;
 }
 
+void
+MaRC::ViewingGeometry::pix2latlon(std::vector<double> const & sample,
+                                  std::vector<double> const & line,
+                                  std::vector<double> & lat,
+                                  std::vector<double> & lon) const
+{
+    if (sample.size() != line.size())
+        throw std::invalid_argument("Sample and line counts differ.");
+
+    auto const n = sample.size();
+
+    // Image space points in observer coordinates, in kilometers.
+    vector_batch coords(n);
+
+    double * const x = coords.x();
+    double * const z = coords.z();
+
+    for (std::size_t i = 0; i < n; ++i) {
+        double s = sample[i] - this->sample_center_;
+        double l = this->line_center_ - line[i];
+
+        // Convert from image space to object space.
+        this->geometric_correction_->image_to_object(s, l);
+
+        x[i] = s * this->km_per_pixel_;
+        z[i] = l * this->km_per_pixel_;
+    }
+
+    // Convert from observer coordinates to body coordinates.
+    MaRC::multiply(this->observ2body_, coords, coords);
+
+    // Vectors from observer to points on image.
+    double * const y = coords.y();
+
+    for (std::size_t i = 0; i < n; ++i) {
+        x[i] -= this->range_b_[0];
+        y[i] -= this->range_b_[1];
+        z[i] -= this->range_b_[2];
+    }
+
+    this->body_->ellipse_intersection(this->range_b_, coords, lat, lon);
+
+    // NaN longitudes, i.e. points off the body, remain NaN.
+    if (this->body_->prograde())
+        for (auto & l : lon)
+            l = this->sub_observ_lon_ - l;
+    else
+        for (auto & l : lon)
+            l -= this->sub_observ_lon_;
+}
+
 std::vector<bool>
 MaRC::ViewingGeometry::body_mask(std::size_t samples,
                                  std::size_t lines) const
@@ -963,19 +1075,25 @@ MaRC::ViewingGeometry::body_mask(std::size_t samples,
 
     std::vector<bool> mask(samples * lines, false);
 
+    // Convert one image line at a time.
+    std::vector<double> sample(samples);
+    std::vector<double> line(samples);
+    std::vector<double> lat;
+    std::vector<double> lon;
+
+    for (std::size_t i = 0; i < samples; ++i)
+        sample[i] = static_cast<double>(i);
+
     for (std::size_t k = 0; k < lines; ++k) {
         std::size_t const offset = k * samples;
 
-        for (std::size_t i = 0; i < samples; ++i) {
-            auto lat = not_a_number;
-            auto lon = not_a_number;
+        std::fill(line.begin(), line.end(), static_cast<double>(k));
+
+        this->pix2latlon(sample, line, lat, lon);
 
-            if (this->pix2latlon(i, k, lat, lon)) {
-                // On body
-                std::size_t const index = offset + i;
-                mask[index] = true;
-            }
-        }
+        for (std::size_t i = 0; i < samples; ++i)
+            if (!std::isnan(lat[i]))
+                mask[offset + i] = true;  // On body
     }
 
     return mask;
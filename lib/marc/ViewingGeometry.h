@@ -2,7 +2,7 @@
 /**
  * @file ViewingGeometry.h
  *
- * Copyright (C) 1999, 2003-2005, 2017-2018  Ossama Othman
+ * Copyright (C) 1999, 2003-2005, 2017-2018, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -278,6 +278,29 @@ namespace MaRC
 	 */
         bool is_visible(double lat, double lon) const;
 
+        /// Bound the region of the body visible to the observer.
+        /**
+         * All points on the body considered visible by
+         * @c is_visible() lie within a spherical cap centered on the
+         * sub-observer point.  The cap radius is the angle between
+         * the sub-observer point and the point on the body, measured
+         * at the center of the body.
+         *
+         * @param[out] lat    Planetocentric sub-observer latitude in
+         *                    radians.
+         * @param[out] lon    Sub-observer longitude in radians.
+         * @param[out] radius Angular radius of the cap in radians.
+         *
+         * @note The cap is slightly larger than a hemisphere for
+         *       oblate bodies since the surface normal and the
+         *       planetocentric radius of a point on the body differ
+         *       by up to the largest difference between its
+         *       planetographic and planetocentric latitudes.
+         */
+        void visible_cap(double & lat,
+                         double & lon,
+                         double & radius) const;
+
         /// Convert (latitude, longitude) to (sample, line).
         /**
          * @param[in]  lat Planetocentric latitude in radians.
@@ -318,6 +341,29 @@ namespace MaRC
                         double & lat,
                         double & lon) const;
 
+        /**
+         * @brief Convert a batch of (sample, line) points to
+         *        (latitude, longitude).
+         *
+         * Batch variant of @c pix2latlon() that transforms all
+         * points at once, such as all pixels on an image line.
+         *
+         * @param[in]  sample Samples of the points.
+         * @param[in]  line   Lines   of the points.
+         * @param[out] lat    Planetocentric latitudes in radians, or
+         *                    @c NaN where the point is not on the
+         *                    body.
+         * @param[out] lon    Longitudes in radians, or @c NaN where
+         *                    the point is not on the body.
+         *
+         * @throw std::invalid_argument @a sample and @a line sizes
+         *                              differ.
+         */
+        void pix2latlon(std::vector<double> const & sample,
+                        std::vector<double> const & line,
+                        std::vector<double> & lat,
+                        std::vector<double> & lon) const;
+
         /**
          * @brief Mask that marks where the observed body is in the
          *        image.
@@ -374,6 +420,40 @@ namespace MaRC
                           DMatrix & observ2body,
                           DMatrix & body2observ);
 
+        /**
+         * @brief Visibility check specialized for the type of the
+         *        body.
+         *
+         * @param[in] body @c body_ as its most derived type.
+         * @param[in] lat  Planetocentric latitude in radians.
+         * @param[in] lon  Longitude in radians.
+         *
+         * @see is_visible(double, double) const
+         * @see MaRC::visit_body()
+         */
+        template <typename Body>
+        bool is_visible(Body const & body, double lat, double lon) const;
+
+        /**
+         * @brief (latitude, longitude) to (sample, line) conversion
+         *        specialized for the type of the body.
+         *
+         * @param[in]  body @c body_ as its most derived type.
+         * @param[in]  lat  Planetocentric latitude in radians.
+         * @param[in]  lon  Longitude in radians.
+         * @param[out] x    Sample at given latitude and longitude.
+         * @param[out] z    Line at given latitude and longitude.
+         *
+         * @see latlon2pix(double, double, double &, double &) const
+         * @see MaRC::visit_body()
+         */
+        template <typename Body>
+        bool latlon2pix(Body const & body,
+                        double lat,
+                        double lon,
+                        double & x,
+                        double & z) const;
+
     private:
 
         /// Object representing the body being mapped.
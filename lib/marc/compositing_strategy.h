@@ -2,7 +2,7 @@
 /**
  * @file compositing_strategy.h
  *
- * Copyright (C) 2021  Ossama Othman
+ * Copyright (C) 2021, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -17,6 +17,7 @@
 
 #include <memory>
 #include <vector>
+#include <stdexcept>
 
 namespace MaRC
 {
@@ -68,6 +69,44 @@ namespace MaRC
                               double lon,
                               double & data) const = 0;
 
+        /**
+         * @brief Obtain the composited image pixels at given
+         *        latitude and longitude.
+         *
+         * Obtain the image pixels and weights that would be
+         * composited at the given latitude and longitude, rather
+         * than the composited datum itself.
+         *
+         * The default implementation throws an exception since
+         * compositing strategies don't necessarily combine data
+         * linearly.
+         *
+         * @param[in]     images Set of images to composite.
+         * @param[in]     firsts Index of the first underlying image
+         *                       of each of the @a images in the
+         *                       resampling plan.
+         * @param[in]     lat    Planetocentric latitude in radians.
+         * @param[in]     lon    Longitude in radians.
+         * @param[in,out] taps   List to which the composited pixels
+         *                       will be appended.  Their weights
+         *                       sum to one.
+         *
+         * @return The number of images that were composited.
+         *
+         * @throw std::runtime_error Resampling plans not supported.
+         *
+         * @see @c SourceImage::read_taps()
+         */
+        virtual int composite(list_type const & /* images */,
+                              std::vector<std::size_t> const & /* firsts */,
+                              double /* lat */,
+                              double /* lon */,
+                              ResamplingPlan::tap_list & /* taps */) const
+        {
+            throw std::runtime_error("Compositing strategy does not "
+                                     "support resampling plans.");
+        }
+
     };
 
 }
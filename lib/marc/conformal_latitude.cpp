@@ -0,0 +1,215 @@
+/**
+ * @file conformal_latitude.cpp
+ *
+ * Copyright (C) 2026  Ossama Othman
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * @author Ossama Othman
+ */
+
+#include "conformal_latitude.h"
+#include "Constants.h"
+#include "root_find.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <cmath>
+
+
+namespace
+{
+    /// Maximum error in radians of the planetographic latitude
+    /// computed through the fast path.
+    constexpr double max_error = 1e-12;
+
+    /// Largest number of Newton-Raphson steps in the fast path.
+    constexpr int max_fast_steps = 3;
+
+    /**
+     * @brief Coefficients of the inverse conformal latitude series.
+     *
+     * @param[in] e First eccentricity of the body.
+     *
+     * @return Coefficients of the @c sin(2*chi), @c sin(4*chi),
+     *         @c sin(6*chi) and @c sin(8*chi) terms.
+     *
+     * @see Snyder, "Map Projections - A Working Manual", equation
+     *      (3-5).
+     */
+    std::array<double, 4>
+    series_coefficients(double e)
+    {
+        if (!(e >= 0 && e < 1))
+            throw std::invalid_argument("Eccentricity must be in [0, 1).");
+
+        double const e2 = e * e;
+        double const e4 = e2 * e2;
+        double const e6 = e4 * e2;
+        double const e8 = e4 * e4;
+
+        return {
+            e2 / 2 + 5 * e4 / 24 + e6 / 12 + 13 * e8 / 360,
+            7 * e4 / 48 + 29 * e6 / 240 + 811 * e8 / 11520,
+            7 * e6 / 120 + 81 * e8 / 1120,
+            4279 * e8 / 161280
+        };
+    }
+}
+
+MaRC::conformal_latitude::conformal_latitude(double e)
+    : e_(e)
+    , c_(series_coefficients(e))
+    , steps_(-1)
+{
+    /*
+      Verify the error of the fast path over a dense grid of
+      latitudes, and use the fewest Newton-Raphson steps that keep it
+      within the maximum error.  The error is smooth in latitude, and
+      symmetric about the equator.
+    */
+    constexpr int grid_size = 2048;
+
+    for (int steps = 0; steps <= max_fast_steps; ++steps) {
+        double error = 0;
+
+        for (int i = 0; i < grid_size && error <= max_error; ++i) {
+            double const latg =
+                static_cast<double>(i) / grid_size * C::pi_2;
+            double const chi = this->conformal(latg);
+
+            error = std::max(error,
+                             std::abs(this->refine(chi,
+                                                   this->series(chi),
+                                                   steps)
+                                      - latg));
+        }
+
+        if (error <= max_error) {
+            this->steps_ = steps;
+            break;
+        }
+    }
+}
+
+double
+MaRC::conformal_latitude::conformal(double latg) const
+{
+    /*
+      The conformal latitude chi is the latitude on a sphere with the
+      same isometric latitude psi as the planetographic latitude on
+      the oblate spheroid:
+
+        psi = asinh(tan(latg)) - e * atanh(e * sin(latg))
+        chi = atan(sinh(psi))
+    */
+    double const psi =
+        std::asinh(std::tan(latg))
+        - this->e_ * std::atanh(this->e_ * std::sin(latg));
+
+    return std::atan(std::sinh(psi));
+}
+
+double
+MaRC::conformal_latitude::graphic(double chi) const
+{
+    // The poles map to themselves.
+    if (!(std::abs(chi) < C::pi_2))
+        return chi;
+
+    return
+        this->steps_ < 0
+        ? this->solve(chi)
+        : this->refine(chi, this->series(chi), this->steps_);
+}
+
+double
+MaRC::conformal_latitude::series(double chi) const
+{
+    // Sum the series with Clenshaw's recurrence.
+    double const x = 2 * std::cos(2 * chi);
+
+    double b1 = 0;
+    double b2 = 0;
+
+    for (auto c = this->c_.crbegin(); c != this->c_.crend(); ++c) {
+        double const b = *c + x * b1 - b2;
+        b2 = b1;
+        b1 = b;
+    }
+
+    return chi + b1 * std::sin(2 * chi);
+}
+
+double
+MaRC::conformal_latitude::refine(double chi, double latg, int steps) const
+{
+    /*
+      Newton-Raphson steps in terms of the tangents of the latitudes,
+      which avoid most of the transcendental functions in the forward
+      equation (Karney, "Transverse Mercator with an accuracy of a few
+      nanometers", J. Geodesy 85, 2011):
+
+        sigma = sinh(e * atanh(e * tau / sqrt(1 + tau^2)))
+        tau'  = tau * sqrt(1 + sigma^2) - sigma * sqrt(1 + tau^2)
+
+        d(tau')   (1 - e^2) * sqrt(1 + tau'^2) * sqrt(1 + tau^2)
+        ------- = ----------------------------------------------
+        d(tau)                1 + (1 - e^2) * tau^2
+
+      where tau = tan(latg) and tau' = tan(chi).
+    */
+    if (steps == 0)
+        return latg;
+
+    double const e2 = this->e_ * this->e_;
+    double const target = std::tan(chi);
+
+    double tau = std::tan(latg);
+
+    for (int i = 0; i < steps; ++i) {
+        double const tau1  = std::sqrt(1 + tau * tau);
+        double const sigma =
+            std::sinh(this->e_ * std::atanh(this->e_ * tau / tau1));
+        double const taup  =
+            tau * std::sqrt(1 + sigma * sigma) - sigma * tau1;
+        double const dtaup =
+            (1 - e2) * std::sqrt(1 + taup * taup) * tau1
+            / (1 + (1 - e2) * tau * tau);
+
+        tau += (target - taup) / dtaup;
+    }
+
+    return std::atan(tau);
+}
+
+double
+MaRC::conformal_latitude::solve(double chi) const
+{
+    /*
+      The forward equation increases monotonically between the poles,
+      so bracketed root finding with its analytic derivative:
+
+        d(chi)     (1 - e^2) * cos(chi)
+        ------ = -------------------------------------
+        d(latg)  (1 - e^2 * sin^2(latg)) * cos(latg)
+
+      always converges, albeit more slowly than the fixed number of
+      refinement steps.
+    */
+    double const e2 = this->e_ * this->e_;
+
+    auto const f = [this](double latg) { return this->conformal(latg); };
+
+    auto const df =
+        [this, e2](double latg)
+        {
+            double const s = std::sin(latg);
+
+            return
+                (1 - e2) * std::cos(this->conformal(latg))
+                / ((1 - e2 * s * s) * std::cos(latg));
+        };
+
+    return MaRC::root_find(chi, -C::pi_2, C::pi_2, f, df);
+}
@@ -0,0 +1,137 @@
+// -*- C++ -*-
+/**
+ * @file conformal_latitude.h
+ *
+ * Copyright (C) 2026  Ossama Othman
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * @author Ossama Othman
+ */
+
+#ifndef MARC_CONFORMAL_LATITUDE_H
+#define MARC_CONFORMAL_LATITUDE_H
+
+#include <marc/Export.h>
+
+#include <array>
+
+
+namespace MaRC
+{
+    /**
+     * @class conformal_latitude conformal_latitude.h <marc/conformal_latitude.h>
+     *
+     * @brief Conversion between planetographic and conformal
+     *        latitudes on an oblate spheroid.
+     *
+     * Conformal map projections of an oblate spheroid, such as the
+     * Mercator and Polar Stereographic projections, are those of a
+     * sphere on which the planetographic latitude has been replaced
+     * by the conformal latitude.  Their inverse equations therefore
+     * reduce to the inverse spherical equations followed by a
+     * conversion from the conformal latitude back to the
+     * planetographic latitude, avoiding a general purpose root
+     * finding search at each map location.
+     *
+     * The conversion to the planetographic latitude starts from the
+     * series in the conformal latitude given by Snyder, "Map
+     * Projections - A Working Manual", equation (3-5), with
+     * coefficients computed once for the body eccentricity.  The
+     * series is then refined with as many Newton-Raphson steps on
+     * the exact forward equation, using its analytic derivative, as
+     * needed to keep the error within 1e-12 radians.  That number of
+     * steps is verified over all latitudes at construction, and is
+     * zero for a sphere and one for most planetary bodies.  Highly
+     * oblate bodies, where the truncation error of the series grows
+     * large, are solved for until convergence instead.
+     */
+    class MARC_API conformal_latitude
+    {
+    public:
+
+        /**
+         * @brief Constructor.
+         *
+         * @param[in] e First eccentricity of the body.
+         *
+         * @throw std::invalid_argument @a e is not in [0, 1).
+         */
+        explicit conformal_latitude(double e);
+
+        /**
+         * @brief Compute the conformal latitude.
+         *
+         * @param[in] latg Planetographic latitude in radians.
+         *
+         * @return Conformal latitude in radians.
+         */
+        double conformal(double latg) const;
+
+        /**
+         * @brief Compute the planetographic latitude.
+         *
+         * @param[in] chi Conformal latitude in radians.
+         *
+         * @return Planetographic latitude in radians.
+         */
+        double graphic(double chi) const;
+
+    private:
+
+        /**
+         * @brief Approximate the planetographic latitude with the
+         *        inverse conformal latitude series.
+         *
+         * @param[in] chi Conformal latitude in radians.
+         */
+        double series(double chi) const;
+
+        /**
+         * @brief Refine the planetographic latitude with a fixed
+         *        number of Newton-Raphson steps.
+         *
+         * @param[in] chi   Conformal latitude in radians.
+         * @param[in] latg  Initial planetographic latitude in
+         *                  radians.
+         * @param[in] steps Number of Newton-Raphson steps.
+         */
+        double refine(double chi, double latg, int steps) const;
+
+        /**
+         * @brief Solve for the planetographic latitude until
+         *        convergence.
+         *
+         * Bracketed root finding is used, making this suitable for
+         * eccentricities close to one.
+         *
+         * @param[in] chi Conformal latitude in radians.
+         */
+        double solve(double chi) const;
+
+    private:
+
+        /// First eccentricity of the body.
+        double const e_;
+
+        /// Coefficients of the @c sin(2*k*chi) terms of the series,
+        /// k = 1, 2, 3, 4.
+        std::array<double, 4> const c_;
+
+        /**
+         * @brief Number of Newton-Raphson steps needed after the
+         *        series to stay within the maximum error.
+         *
+         * The number is verified over all latitudes at construction.
+         * A negative number means the series is too inaccurate for a
+         * fixed number of steps, and the latitude is solved for
+         * until convergence instead.
+         */
+        int steps_;
+
+    };
+
+} // End MaRC namespace
+
+
+#endif  /* MARC_CONFORMAL_LATITUDE_H */
@@ -0,0 +1,480 @@
+//  -*- C++ -*-
+/**
+ * @file fast_math.h
+ *
+ * Copyright (C) 2026  Ossama Othman
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * @author Ossama Othman
+ */
+
+#ifndef MARC_FAST_MATH_H
+#define MARC_FAST_MATH_H
+
+#include <limits>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+
+
+namespace MaRC
+{
+    /**
+     * @brief Implementation of transcendental functions in map
+     *        computations.
+     *
+     * @see @c MaRC::fast
+     */
+    enum class math_mode
+    {
+        /// Standard C++ library functions.
+        exact,
+
+        /// Inline @c MaRC::fast functions.
+        fast
+    };
+
+    /**
+     * @namespace MaRC::fast
+     *
+     * @brief Inline transcendental functions with a bounded error.
+     *
+     * These functions trade the last bit or two of accuracy for
+     * speed.  They consist of straight-line branch-free arithmetic
+     * so that they may be inlined into, and auto-vectorized with,
+     * the map computation loops that call them, unlike the opaque
+     * standard C++ library calls.  Unlike the @c -ffast-math
+     * compiler option, IEEE 754 semantics are preserved: a @c NaN
+     * argument yields a @c NaN result, which %MaRC relies on to mark
+     * blank map pixels.
+     *
+     * The polynomial approximations are those of the FreeBSD libm
+     * (fdlibm) kernels.  The maximum errors listed for each function
+     * are in units in the last place (ULP) relative to the exact
+     * result, where a correctly rounded result would be within 0.5
+     * ULP.  They are verified by the @c fast_math_test.
+     */
+    namespace fast
+    {
+        /// @cond INTERNAL
+        namespace details
+        {
+            /**
+             * @brief Round to the nearest integer.
+             *
+             * Branch-free alternative to @c std::nearbyint() for
+             * @a x with a magnitude less than 2<sup>51</sup>.
+             */
+            inline double nearest(double x)
+            {
+                constexpr double shift = 0x1.8p52;
+
+                return (x + shift) - shift;
+            }
+
+            /**
+             * @brief Sine and cosine kernels on [-pi/4, pi/4].
+             *
+             * @param[in]  r Reduced argument.
+             * @param[out] s Sine   of @a r.
+             * @param[out] c Cosine of @a r.
+             */
+            inline void sincos_kernel(double r, double & s, double & c)
+            {
+                constexpr double S1 = -1.66666666666666324348e-01;
+                constexpr double S2 =  8.33333333332248946124e-03;
+                constexpr double S3 = -1.98412698298579493134e-04;
+                constexpr double S4 =  2.75573137070700676789e-06;
+                constexpr double S5 = -2.50507602534068634195e-08;
+                constexpr double S6 =  1.58969099521155010221e-10;
+
+                constexpr double C1 =  4.16666666666666019037e-02;
+                constexpr double C2 = -1.38888888888741095749e-03;
+                constexpr double C3 =  2.48015872894767294178e-05;
+                constexpr double C4 = -2.75573143513906633035e-07;
+                constexpr double C5 =  2.08757232129817482790e-09;
+                constexpr double C6 = -1.13596475577881948265e-11;
+
+                double const z = r * r;
+
+                double const sp =
+                    r + r * z * (S1 + z * (S2 + z * (S3 + z * (S4 + z
+                                 * (S5 + z * S6)))));
+
+                // The polynomial turns a negative zero r into a
+                // positive zero.
+                s = (r == 0 ? r : sp);
+
+                // 1 - z/2 with the rounding error of the subtraction
+                // recovered.
+                double const hz = 0.5 * z;
+                double const w  = 1 - hz;
+
+                c = w + (((1 - w) - hz)
+                         + z * z * (C1 + z * (C2 + z * (C3 + z * (C4 + z
+                                    * (C5 + z * C6))))));
+            }
+
+            /**
+             * @brief Reduce an angle to [-pi/4, pi/4].
+             *
+             * Cody-Waite reduction by multiples of pi/2 split into
+             * three parts of 33 significant bits each, so that each
+             * product with the quadrant is exact for quadrants below
+             * 2<sup>20</sup>.
+             *
+             * @param[in]  x Angle in radians.
+             * @param[out] q Quadrant of @a x, i.e. the nearest
+             *               multiple of pi/2.
+             *
+             * @return Angle in [-pi/4, pi/4] with the same sine and
+             *         cosine, up to sign and exchange, as @a x.
+             */
+            inline double reduce(double x, double & q)
+            {
+                constexpr double two_over_pi = 6.36619772367581382433e-01;
+                constexpr double pio2_1 = 1.57079632673412561417e+00;
+                constexpr double pio2_2 = 6.07710050630396597660e-11;
+                constexpr double pio2_3 = 2.02226624871116645580e-21;
+
+                q = nearest(x * two_over_pi);
+
+                // x - q * pio2_1 and both products are exact.  Recover
+                // the rounding error of the second subtraction.  The
+                // tail is subtracted rather than added to preserve
+                // the sign of a zero x.
+                double const r1 = x - q * pio2_1;
+                double const t  = q * pio2_2;
+                double const r2 = r1 - t;
+
+                return r2 - (q * pio2_3 - ((r1 - r2) - t));
+            }
+
+            /**
+             * @brief Arc tangent kernel on [0, 1].
+             *
+             * @param[in] t Argument in [0, 1], or @c NaN.
+             */
+            inline double atan_kernel(double t)
+            {
+                constexpr double aT0  =  3.33333333333329318027e-01;
+                constexpr double aT1  = -1.99999999998764832476e-01;
+                constexpr double aT2  =  1.42857142725034663711e-01;
+                constexpr double aT3  = -1.11111104054623557880e-01;
+                constexpr double aT4  =  9.09088713343650656196e-02;
+                constexpr double aT5  = -7.69187620504482999495e-02;
+                constexpr double aT6  =  6.66107313738753120669e-02;
+                constexpr double aT7  = -5.83357013379057348645e-02;
+                constexpr double aT8  =  4.97687799461593236017e-02;
+                constexpr double aT9  = -3.65315727442169155270e-02;
+                constexpr double aT10 =  1.62858201153657823623e-02;
+
+                // atan(1/2) and atan(1), each split into high and low
+                // parts.
+                constexpr double atan_half_hi = 4.63647609000806093515e-01;
+                constexpr double atan_half_lo = 2.26987774529616870924e-17;
+                constexpr double atan_one_hi  = 7.85398163397448278999e-01;
+                constexpr double atan_one_lo  = 3.06161699786838301793e-17;
+
+                /*
+                  Reduce t to [-7/16, 7/16] through the identity
+
+                    atan(t) = atan(k) + atan((t - k) / (1 + k * t))
+
+                  where k is 0, 1/2 or 1.
+                */
+                bool const half = t >= 7.0 / 16;
+                bool const one  = t >= 11.0 / 16;
+
+                double const k  = one ? 1 : (half ? 0.5 : 0);
+                double const hi =
+                    one ? atan_one_hi : (half ? atan_half_hi : 0);
+                double const lo =
+                    one ? atan_one_lo : (half ? atan_half_lo : 0);
+
+                double const u = (t - k) / (1 + k * t);
+                double const z = u * u;
+                double const w = z * z;
+
+                // Odd and even powers of w evaluated separately.
+                double const s1 =
+                    z * (aT0 + w * (aT2 + w * (aT4 + w * (aT6 + w
+                         * (aT8 + w * aT10)))));
+                double const s2 =
+                    w * (aT1 + w * (aT3 + w * (aT5 + w * (aT7 + w
+                         * aT9))));
+
+                return hi - ((u * (s1 + s2) - lo) - u);
+            }
+
+            /// pi/2 split into high and low parts.
+            constexpr double pio2_hi = 1.57079632679489655800e+00;
+            constexpr double pio2_lo = 6.12323399573676603587e-17;
+
+            /// pi split into high and low parts.
+            constexpr double pi_hi = 3.14159265358979311600e+00;
+            constexpr double pi_lo = 1.22464679914735317720e-16;
+        }
+        /// @endcond
+
+        /**
+         * @brief Compute the sine and cosine of an angle.
+         *
+         * Maximum error: 1.5 ULP for @a x with a magnitude up to
+         * 10<sup>5</sup>.  The error grows beyond 2<sup>19</sup>
+         * pi, where the argument reduction is no longer exact.
+         *
+         * @param[in]  x Angle in radians.
+         * @param[out] s Sine   of @a x.
+         * @param[out] c Cosine of @a x.
+         */
+        inline void sincos(double x, double & s, double & c)
+        {
+            double q;
+            double const r = details::reduce(x, q);
+
+            double sr;
+            double cr;
+            details::sincos_kernel(r, sr, cr);
+
+            // Quadrant in {-2, -1, 0, 1, 2}, i.e. q modulo 4.
+            double const n = q - 4 * details::nearest(q * 0.25);
+
+            bool const odd = (n == 1 || n == -1);
+
+            double const sn = odd ? cr : sr;
+            double const cn = odd ? sr : cr;
+
+            s = (n == 0 || n ==  1) ? sn : -sn;
+            c = (n == 0 || n == -1) ? cn : -cn;
+        }
+
+        /**
+         * @brief Compute the sine of an angle.
+         *
+         * @see @c sincos() for the error bound.
+         */
+        inline double sin(double x)
+        {
+            double s;
+            double c;
+            sincos(x, s, c);
+
+            return s;
+        }
+
+        /**
+         * @brief Compute the cosine of an angle.
+         *
+         * @see @c sincos() for the error bound.
+         */
+        inline double cos(double x)
+        {
+            double s;
+            double c;
+            sincos(x, s, c);
+
+            return c;
+        }
+
+        /**
+         * @brief Compute the tangent of an angle.
+         *
+         * Maximum error: 3 ULP for @a x with a magnitude up to
+         * 10<sup>5</sup>.
+         *
+         * @param[in] x Angle in radians.
+         */
+        inline double tan(double x)
+        {
+            double q;
+            double const r = details::reduce(x, q);
+
+            double sr;
+            double cr;
+            details::sincos_kernel(r, sr, cr);
+
+            // tan(r + pi/2) = -cos(r) / sin(r)
+            bool const odd = details::nearest(q * 0.5) != q * 0.5;
+
+            double const num = odd ? -cr : sr;
+            double const den = odd ?  sr : cr;
+
+            return num / den;
+        }
+
+        /**
+         * @brief Compute the arc tangent of @a y / @a x.
+         *
+         * Maximum error: 2 ULP.  Signed zeros and infinities are
+         * handled like @c std::atan2().
+         *
+         * @param[in] y Ordinate.
+         * @param[in] x Abscissa.
+         *
+         * @return Angle in [-pi, pi] radians.
+         */
+        inline double atan2(double y, double x)
+        {
+            double const ax = std::abs(x);
+            double const ay = std::abs(y);
+
+            // Reduce to the arc tangent of a ratio in [0, 1].
+            bool const swap = ay > ax;
+            double const num = swap ? ax : ay;
+            double const den = swap ? ay : ax;
+
+            double t = num / den;
+            t = (num == den) ? 1 : t;  // Both infinite.
+            t = (den == 0)   ? 0 : t;  // Both zero.
+
+            double const a = details::atan_kernel(t);
+
+            double const b = (details::pio2_hi - a) + details::pio2_lo;
+            double const r = swap ? b : a;
+
+            double const c = (details::pi_hi - r) + details::pi_lo;
+
+            // Same as std::signbit(x), but in the floating point domain.
+            bool const negative = std::copysign(1.0, x) < 0;
+
+            return std::copysign(negative ? c : r, y);
+        }
+
+        /**
+         * @brief Compute the arc tangent.
+         *
+         * Maximum error: 2 ULP.
+         *
+         * @param[in] x Argument.
+         *
+         * @return Angle in [-pi/2, pi/2] radians.
+         */
+        inline double atan(double x)
+        {
+            double const ax = std::abs(x);
+
+            // atan(x) = pi/2 - atan(1/x) for x > 1.
+            bool const large = ax > 1;
+
+            double const inverse = 1 / ax;
+            double const a = details::atan_kernel(large ? inverse : ax);
+
+            double const b = (details::pio2_hi - a) + details::pio2_lo;
+
+            return std::copysign(large ? b : a, x);
+        }
+
+        /**
+         * @brief Compute the square root of the sum of the squares of
+         *        @a x and @a y.
+         *
+         * Maximum error: 1.5 ULP.  Unlike @c std::hypot(), there is no
+         * protection against intermediate overflow or underflow, so
+         * @a x and @a y should be well within the square root of the
+         * range of @c double, as they are for distances in
+         * kilometers or pixels.
+         */
+        inline double hypot(double x, double y)
+        {
+            return std::sqrt(x * x + y * y);
+        }
+
+        /**
+         * @brief Compute the natural logarithm.
+         *
+         * Maximum error: 1 ULP.  Special values, including zero,
+         * negative, infinite and subnormal arguments, are handled
+         * like @c std::log().
+         *
+         * @param[in] x Argument.
+         */
+        inline double log(double x)
+        {
+            constexpr double Lg1 = 6.666666666666735130e-01;
+            constexpr double Lg2 = 3.999999999940941908e-01;
+            constexpr double Lg3 = 2.857142874366239149e-01;
+            constexpr double Lg4 = 2.222219843214978396e-01;
+            constexpr double Lg5 = 1.818357216161805012e-01;
+            constexpr double Lg6 = 1.531383769920937332e-01;
+            constexpr double Lg7 = 1.479819860511658591e-01;
+
+            // ln(2) split so that its product with the exponent is
+            // exact.
+            constexpr double ln2_hi = 6.93147180369123816490e-01;
+            constexpr double ln2_lo = 1.90821492927058770002e-10;
+
+            constexpr double sqrt2 = 1.41421356237309514547e+00;
+
+            constexpr double two54 = 0x1p54;
+
+            // Scale subnormal arguments into the normal range.
+            bool const subnormal =
+                std::abs(x) < std::numeric_limits<double>::min();
+
+            double const scaled = x * two54;
+            double const xs = subnormal ? scaled : x;
+
+            std::uint64_t bits;
+            std::memcpy(&bits, &xs, sizeof(bits));
+
+            /*
+              Split x into 2^e * m, m in [1, 2), through its IEEE 754
+              representation.  The biased exponent is converted to a
+              double by placing it in the low bits of the significand
+              of 2^52.
+            */
+            std::uint64_t const ebits =
+                ((bits >> 52) & 0x7ff) | 0x4330000000000000;
+            std::uint64_t const mbits =
+                (bits & 0x000fffffffffffff) | 0x3ff0000000000000;
+
+            double e;
+            double m;
+            std::memcpy(&e, &ebits, sizeof(e));
+            std::memcpy(&m, &mbits, sizeof(m));
+
+            e -= 0x1p52 + 1023;
+            e -= subnormal ? 54 : 0;
+
+            // Center m about one, in [sqrt(2)/2, sqrt(2)).
+            bool const large = m > sqrt2;
+            double const half_m = m * 0.5;
+            m  = large ? half_m : m;
+            e += large ? 1 : 0;
+
+            /*
+              log(1 + f) = 2 * atanh(s), s = f / (2 + f), through a
+              minimax polynomial in s^2, with the leading f term and
+              f^2/2 kept separately to preserve accuracy.
+            */
+            double const f = m - 1;
+            double const s = f / (2 + f);
+            double const z = s * s;
+            double const w = z * z;
+
+            double const t1 = w * (Lg2 + w * (Lg4 + w * Lg6));
+            double const t2 = z * (Lg1 + w * (Lg3 + w * (Lg5 + w * Lg7)));
+            double const R  = t2 + t1;
+
+            double const hfsq = 0.5 * f * f;
+
+            double const r =
+                e * ln2_hi - ((hfsq - (s * (hfsq + R) + e * ln2_lo)) - f);
+
+            constexpr auto infinity = std::numeric_limits<double>::infinity();
+            constexpr auto not_a_number =
+                std::numeric_limits<double>::quiet_NaN();
+
+            // Zero, negative, infinite and NaN arguments.
+            double const special =
+                (x == 0) ? -infinity : (x < 0 ? not_a_number : x);
+
+            return (x > 0 && x < infinity) ? r : special;
+        }
+    }
+}
+
+
+#endif  /* MARC_FAST_MATH_H */
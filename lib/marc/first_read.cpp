@@ -1,7 +1,7 @@
 /**
  * @file first_read.cpp
  *
- * Copyright (C) 2003-2004, 2017, 2020-2021  Ossama Othman
+ * Copyright (C) 2003-2004, 2017, 2020-2021, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -24,3 +24,22 @@ MaRC::first_read::composite(list_type const & images,
 
     return 0;
 }
+
+int
+MaRC::first_read::composite(list_type const & images,
+                            std::vector<std::size_t> const & firsts,
+                            double lat,
+                            double lon,
+                            ResamplingPlan::tap_list & taps) const
+{
+    double weight = 1;  // Unused.
+
+    static constexpr bool scan = false;  // Do not scan for data weight.
+
+    // Return the pixels from the first image with data.
+    for (std::size_t i = 0; i < images.size(); ++i)
+        if (images[i]->read_taps(lat, lon, firsts[i], taps, weight, scan))
+            return 1;
+
+    return 0;
+}
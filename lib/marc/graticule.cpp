@@ -0,0 +1,427 @@
+/**
+ * @file graticule.cpp
+ *
+ * Copyright (C) 2026  Ossama Othman
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * @author Ossama Othman
+ */
+
+#include "graticule.h"
+#include "Constants.h"
+
+#include <algorithm>
+#include <future>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <cmath>
+
+
+namespace
+{
+    /// Projected point on a grid line.
+    struct point
+    {
+        /// Continuous map sample coordinate.
+        double sample;
+
+        /// Continuous map line coordinate.
+        double line;
+
+        /// Is the point visible in the projection?
+        bool visible;
+    };
+
+    /// Portion of a grid line between two parameter values.
+    struct segment
+    {
+        /// Grid line parameter at the start of the segment.
+        double t0;
+
+        /// Grid line parameter at the end of the segment.
+        double t1;
+
+        /// Projected point at the start of the segment.
+        point p0;
+
+        /// Projected point at the end of the segment.
+        point p1;
+
+        /// Number of times the grid line has been subdivided.
+        int depth;
+    };
+
+    /**
+     * @brief Number of segments each grid line is initially divided
+     *        into.
+     *
+     * This bounds the size of visible portions of a grid line that
+     * may be missed when both ends of a segment are not visible.
+     */
+    constexpr int initial_segments = 256;
+
+    /**
+     * @brief Maximum number of times a segment is subdivided.
+     *
+     * Limb crossings and discontinuities are located to within
+     * 2<sup>-max_depth</sup> of the initial segment length.
+     */
+    constexpr int max_depth = 32;
+
+    /**
+     * @brief Maximum length of a segment, in map pixels, drawn as a
+     *        straight line.
+     *
+     * Bounds the error of the curvature check at the midpoint of a
+     * segment, which is blind to curves that are symmetric about it.
+     */
+    constexpr double max_length = 16;
+
+    /**
+     * @brief Maximum deviation, in map pixels, of the projected grid
+     *        line from the straight line drawn in its place.
+     */
+    constexpr double max_deviation = 0.25;
+
+    /**
+     * @class tracer
+     *
+     * @brief Trace grid lines, and collect the map pixels they cover.
+     */
+    class tracer
+    {
+    public:
+
+        /// Grid line parameterization type.
+        using line_type = std::function<point(double t)>;
+
+        /// Constructor.
+        tracer(std::size_t samples,
+               std::size_t lines,
+               std::vector<std::size_t> & pixels)
+            : samples_(samples)
+            , lines_(lines)
+            , pixels_(pixels)
+        {
+        }
+
+        /**
+         * @brief Trace a grid line.
+         *
+         * @param[in] f  Projected point on the grid line at a given
+         *               parameter value.
+         * @param[in] t0 First parameter value on the grid line.
+         * @param[in] t1 Last  parameter value on the grid line.
+         */
+        void trace(line_type const & f, double t0, double t1)
+        {
+            std::vector<segment> stack;
+
+            double const dt = (t1 - t0) / initial_segments;
+
+            double ta = t0;
+            point  pa = f(t0);
+
+            for (int n = 1; n <= initial_segments; ++n) {
+                double const tb = (n == initial_segments ? t1 : t0 + n * dt);
+                point const  pb = f(tb);
+
+                stack.push_back({ ta, tb, pa, pb, 0 });
+
+                while (!stack.empty()) {
+                    segment const s = stack.back();
+                    stack.pop_back();
+
+                    this->subdivide(f, s, stack);
+                }
+
+                ta = tb;
+                pa = pb;
+            }
+        }
+
+    private:
+
+        /**
+         * @brief Draw a segment, or split it in two.
+         *
+         * @param[in]     f     Grid line parameterization.
+         * @param[in]     s     Segment to be drawn.
+         * @param[in,out] stack Segments remaining to be drawn.
+         */
+        void subdivide(line_type const & f,
+                       segment const & s,
+                       std::vector<segment> & stack)
+        {
+            point const & a = s.p0;
+            point const & b = s.p1;
+
+            double const length =
+                (a.visible && b.visible
+                 ? std::hypot(b.sample - a.sample, b.line - a.line)
+                 : std::numeric_limits<double>::infinity());
+
+            if (length <= 1) {
+                this->draw(a, b);
+                return;
+            }
+
+            if (s.depth >= max_depth) {
+                // Connect only across a small gap; anything larger is
+                // a discontinuity in the projection.
+                if (length <= 2)
+                    this->draw(a, b);
+
+                return;
+            }
+
+            double const tm = (s.t0 + s.t1) / 2;
+            point const m   = f(tm);
+
+            if (!a.visible && !b.visible && !m.visible)
+                return;
+
+            if (a.visible && b.visible && m.visible) {
+                if (this->outside(a, b, m))
+                    return;
+
+                double const deviation =
+                    std::hypot(m.sample - (a.sample + b.sample) / 2,
+                               m.line   - (a.line   + b.line)   / 2);
+
+                if (length <= max_length && deviation <= max_deviation) {
+                    this->draw(a, b);
+                    return;
+                }
+            }
+
+            int const depth = s.depth + 1;
+
+            stack.push_back({ tm, s.t1, m, b, depth });
+            stack.push_back({ s.t0, tm, a, m, depth });
+        }
+
+        /**
+         * @brief Are the given points all beyond the same edge of
+         *        the map?
+         *
+         * Segments of grid lines far outside of the map are culled
+         * rather than subdivided.
+         */
+        bool outside(point const & a,
+                     point const & b,
+                     point const & c) const
+        {
+            double const w = static_cast<double>(this->samples_);
+            double const h = static_cast<double>(this->lines_);
+
+            return
+                (a.sample < 0 && b.sample < 0 && c.sample < 0)
+                || (a.sample > w && b.sample > w && c.sample > w)
+                || (a.line < 0 && b.line < 0 && c.line < 0)
+                || (a.line > h && b.line > h && c.line > h);
+        }
+
+        /**
+         * @brief Draw a straight line between two points.
+         *
+         * The line is clipped to the map (Liang-Barsky), and then
+         * rasterized with Bresenham's algorithm.
+         */
+        void draw(point const & a, point const & b)
+        {
+            double const w = static_cast<double>(this->samples_);
+            double const h = static_cast<double>(this->lines_);
+
+            double const dx = b.sample - a.sample;
+            double const dy = b.line   - a.line;
+
+            double u0 = 0;
+            double u1 = 1;
+
+            // Clip against each edge of the map.
+            auto const clip =
+                [&u0, &u1](double p, double q)
+                {
+                    if (p == 0)
+                        return q >= 0;  // Parallel to the edge.
+
+                    double const u = q / p;
+
+                    if (p < 0)
+                        u0 = std::max(u0, u);
+                    else
+                        u1 = std::min(u1, u);
+
+                    return u0 <= u1;
+                };
+
+            if (!clip(-dx, a.sample)
+                || !clip(dx, w - a.sample)
+                || !clip(-dy, a.line)
+                || !clip(dy, h - a.line))
+                return;
+
+            // Map pixel containing a continuous map coordinate.
+            auto const pixel =
+                [](double x, std::size_t n)
+                {
+                    return static_cast<long>(
+                        std::min(std::floor(x), static_cast<double>(n - 1)));
+                };
+
+            long i0 = pixel(a.sample + u0 * dx, this->samples_);
+            long k0 = pixel(a.line   + u0 * dy, this->lines_);
+            long const i1 = pixel(a.sample + u1 * dx, this->samples_);
+            long const k1 = pixel(a.line   + u1 * dy, this->lines_);
+
+            long const di =  std::abs(i1 - i0);
+            long const dk = -std::abs(k1 - k0);
+            long const si = (i0 < i1 ? 1 : -1);
+            long const sk = (k0 < k1 ? 1 : -1);
+
+            long error = di + dk;
+
+            for (;;) {
+                this->pixels_.push_back(
+                    static_cast<std::size_t>(k0) * this->samples_
+                    + static_cast<std::size_t>(i0));
+
+                if (i0 == i1 && k0 == k1)
+                    break;
+
+                long const e2 = 2 * error;
+
+                if (e2 >= dk) {
+                    error += dk;
+                    i0 += si;
+                }
+
+                if (e2 <= di) {
+                    error += di;
+                    k0 += sk;
+                }
+            }
+        }
+
+    private:
+
+        /// Number of samples in the grid.
+        std::size_t const samples_;
+
+        /// Number of lines in the grid.
+        std::size_t const lines_;
+
+        /// Offsets of the grid pixels covered by the traced lines.
+        std::vector<std::size_t> & pixels_;
+
+    };
+}
+
+void
+MaRC::plot_graticule(std::size_t samples,
+                     std::size_t lines,
+                     double lat_interval,
+                     double lon_interval,
+                     forward_projection const & forward,
+                     std::vector<std::uint8_t> & grid)
+{
+    if (grid.size() != samples * lines)
+        throw std::invalid_argument("Grid size does not match its "
+                                    "dimensions.");
+
+    if (grid.empty())
+        return;
+
+    // Latitude lines, excluding the poles, followed by longitude
+    // lines, in degrees.
+    std::vector<double> latitudes;
+    std::vector<double> longitudes;
+
+    if (lat_interval > 0)
+        for (int n = 1; -90 + n * lat_interval < 90; ++n)
+            latitudes.push_back(-90 + n * lat_interval);
+
+    if (lon_interval > 0)
+        for (int n = 0; n * lon_interval < 360; ++n)
+            longitudes.push_back(n * lon_interval);
+
+    auto const count = latitudes.size() + longitudes.size();
+
+    if (count == 0)
+        return;
+
+    // Projected point on the grid line at the given coordinates.
+    auto const project =
+        [&forward](double lat, double lon)
+        {
+            point p { 0, 0, false };
+
+            p.visible =
+                forward(lat, lon, p.sample, p.line)
+                && std::isfinite(p.sample)
+                && std::isfinite(p.line);
+
+            return p;
+        };
+
+    /*
+      Trace the grid lines concurrently.  Each task collects the
+      pixels covered by every workers-th grid line, so the grid
+      itself is only written by this thread.
+    */
+    std::size_t const workers =
+        std::clamp<std::size_t>(std::thread::hardware_concurrency(),
+                                1,
+                                count);
+
+    std::vector<std::vector<std::size_t>> pixels(workers);
+
+    auto const task =
+        [&](std::size_t w)
+        {
+            tracer t(samples, lines, pixels[w]);
+
+            for (std::size_t n = w; n < count; n += workers) {
+                if (n < latitudes.size()) {
+                    double const lat = latitudes[n] * C::degree;
+
+                    t.trace([&project, lat](double lon)
+                            {
+                                return project(lat, lon);
+                            },
+                            0,
+                            C::_2pi);
+                } else {
+                    double const lon =
+                        longitudes[n - latitudes.size()] * C::degree;
+
+                    t.trace([&project, lon](double lat)
+                            {
+                                return project(lat, lon);
+                            },
+                            -C::pi_2,
+                            C::pi_2);
+                }
+            }
+        };
+
+    std::vector<std::future<void>> jobs;
+
+    for (std::size_t w = 1; w < workers; ++w)
+        jobs.push_back(std::async(std::launch::async, task, w));
+
+    task(0);
+
+    for (auto & job : jobs)
+        job.get();
+
+    static constexpr auto white =
+        std::numeric_limits<std::uint8_t>::max();
+
+    for (auto const & p : pixels)
+        for (auto const offset : p)
+            grid[offset] = white;
+}
@@ -0,0 +1,93 @@
+// -*- C++ -*-
+/**
+ * @file graticule.h
+ *
+ * %MaRC map latitude/longitude grid rasterization.
+ *
+ * Copyright (C) 2026  Ossama Othman
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * @author Ossama Othman
+ */
+
+#ifndef MARC_GRATICULE_H
+#define MARC_GRATICULE_H
+
+#include <marc/Export.h>
+
+#include <functional>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace MaRC
+{
+    /**
+     * @brief Forward map projection functor type.
+     *
+     * @param[in]  lat    Planetocentric latitude in radians.
+     * @param[in]  lon    Longitude in radians.
+     * @param[out] sample Continuous map sample coordinate, where the
+     *                    center of the map pixel at sample @c i is
+     *                    at @c i + 0.5.
+     * @param[out] line   Continuous map line coordinate.
+     *
+     * @return @c true if the point projects onto the plane of the
+     *         map, even if outside of the map itself, and @c false
+     *         if it is not visible in the projection at all, such as
+     *         on the far side of the body.
+     */
+    using forward_projection =
+        std::function<bool(double lat,
+                           double lon,
+                           double & sample,
+                           double & line)>;
+
+    /**
+     * @brief Rasterize a latitude/longitude grid.
+     *
+     * Trace each latitude and longitude line through the forward map
+     * projection equations, and draw it as a connected polyline of
+     * 8-connected map pixels.  Each line is first sampled coarsely,
+     * and then adaptively subdivided until consecutive points are
+     * within a map pixel of each other, or the line between them
+     * deviates by less than a quarter of a map pixel from the
+     * projected curve.  The number of points evaluated therefore
+     * scales with the size of the line on the map, rather than being
+     * fixed, and lines are unbroken regardless of map size.  Points
+     * that are not visible, as well as discontinuities in the
+     * projection, break the polyline.
+     *
+     * The grid lines are traced concurrently.
+     *
+     * @param[in]     samples      Number of samples in the grid.
+     * @param[in]     lines        Number of lines   in the grid.
+     * @param[in]     lat_interval Number of degrees between each
+     *                             latitude grid line.  No latitude
+     *                             lines are drawn if not positive.
+     * @param[in]     lon_interval Number of degrees between each
+     *                             longitude grid line.  No longitude
+     *                             lines are drawn if not positive.
+     * @param[in]     forward      Forward map projection equations.
+     *                             It must be safe to call
+     *                             concurrently with itself.
+     * @param[in,out] grid         Grid of @a samples times @a lines
+     *                             elements.  Grid line pixels are set
+     *                             to the maximum element value.
+     *
+     * @throw std::invalid_argument @a grid size does not match the
+     *                              grid dimensions.
+     */
+    MARC_API void plot_graticule(std::size_t samples,
+                                 std::size_t lines,
+                                 double lat_interval,
+                                 double lon_interval,
+                                 forward_projection const & forward,
+                                 std::vector<std::uint8_t> & grid);
+
+} // End MaRC namespace
+
+
+#endif  /* MARC_GRATICULE_H */
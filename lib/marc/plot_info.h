@@ -2,7 +2,7 @@
 /**
  * @file plot_info.h
  *
- * Copyright (C) 2018-2019  Ossama Othman
+ * Copyright (C) 2018-2019, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -14,10 +14,13 @@
 
 #include <marc/extrema.h>
 #include <marc/Notifier.h>
+#include <marc/Map_traits.h>
 
 #include <optional>
 #include <limits>
 #include <utility>
+#include <type_traits>
+#include <stdexcept>
 #include <cstdint>
 #include <cstddef>
 
@@ -59,6 +62,8 @@ namespace MaRC
             , lines_(lines)
             , extrema_()
             , blank_()
+            , source_driven_(false)
+            , tile_culling_(true)
             , notifier_()
         {
         }
@@ -83,6 +88,8 @@ namespace MaRC
             , lines_(lines)
             , extrema_()
             , blank_(std::move(blank))
+            , source_driven_(false)
+            , tile_culling_(true)
             , notifier_()
         {
         }
@@ -138,6 +145,71 @@ namespace MaRC
         /// Get blank map array value.
         auto const & blank() const { return this->blank_; }
 
+        /**
+         * @brief Get the value of map array elements with no data.
+         *
+         * @return The blank map array value for integer typed maps
+         *         if one was provided, and
+         *         @c Map_traits<T>::empty_value() otherwise.
+         *
+         * @throw std::invalid_argument Blank map value does not fit
+         *                              within map data type.
+         */
+        T blank_value() const
+        {
+            auto blank = Map_traits<T>::empty_value();
+
+            if (std::is_integral<T>::value && this->blank_) {
+                if (this->blank_ < std::numeric_limits<T>::lowest()
+                    || this->blank_ > std::numeric_limits<T>::max()) {
+                    throw std::invalid_argument(
+                        "Blank map value does not fit within map "
+                        "data type.");
+                }
+
+                blank = static_cast<T>(*this->blank_);
+            }
+
+            return blank;
+        }
+
+        /**
+         * @brief Enable or disable source-driven mapping.
+         *
+         * In source-driven mode, the footprints of the source images
+         * are first projected onto the map through the forward map
+         * projection equations.  Data is then only read from the
+         * source images in the covered region of the map, rather
+         * than at every map pixel.  This is useful when small source
+         * images only cover a small part of a large map.  Maps are
+         * fully traversed if the footprint of a source image, or the
+         * forward equations of the map projection, are not
+         * available.
+         *
+         * @see MapFactory::map_coverage()
+         */
+        void source_driven(bool enable) { this->source_driven_ = enable; }
+
+        /// Is source-driven mapping enabled?
+        bool source_driven() const { return this->source_driven_; }
+
+        /**
+         * @brief Enable or disable map tile culling.
+         *
+         * Map tiles in which none of the source images can have
+         * data, such as those off the body or on the side of the body
+         * not visible in the source photos, are culled before the
+         * map is traversed.  Culled map pixels are left blank, just
+         * as they would be if they were traversed.  Tile culling is
+         * enabled by default.
+         *
+         * @see MapFactory::data_region()
+         */
+        void tile_culling(bool enable) { this->tile_culling_ = enable; }
+
+        /// Is map tile culling enabled?
+        bool tile_culling() const { return this->tile_culling_; }
+
         /**
          * @brief Get map progress notifier.
          *
@@ -166,6 +238,12 @@ namespace MaRC
          */
         blank_type const blank_;
 
+        /// Only read data in the region covered by the source images.
+        bool source_driven_;
+
+        /// Cull map tiles in which the source images have no data.
+        bool tile_culling_;
+
         /// Map progress notifier.
         mutable notifier_type notifier_;
 
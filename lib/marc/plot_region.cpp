@@ -0,0 +1,216 @@
+/**
+ * @file plot_region.cpp
+ *
+ * Copyright (C) 2026  Ossama Othman
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * @author Ossama Othman
+ */
+
+#include "plot_region.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+
+MaRC::plot_region::plot_region(std::size_t samples, std::size_t lines)
+    : samples_(samples)
+    , lines_(lines)
+    , spans_()
+    , line_spans_()
+    , size_(0)
+{
+    std::vector<std::vector<span>> rows(lines);
+
+    if (samples > 0)
+        for (auto & row : rows)
+            row.push_back({ 0, samples });
+
+    this->set_spans(rows);
+}
+
+MaRC::plot_region::plot_region(std::size_t samples,
+                               std::size_t lines,
+                               std::vector<std::vector<span>> rows)
+    : samples_(samples)
+    , lines_(lines)
+    , spans_()
+    , line_spans_()
+    , size_(0)
+{
+    if (rows.size() != lines)
+        throw std::invalid_argument("Plot region spans do not match "
+                                    "map size.");
+
+    for (auto const & row : rows)
+        for (auto const & s : row)
+            if (s.first > s.last || s.last > samples)
+                throw std::invalid_argument("Plot region span extends "
+                                            "beyond the map.");
+
+    this->set_spans(rows);
+}
+
+MaRC::plot_region::plot_region(std::size_t samples,
+                               std::size_t lines,
+                               std::size_t tile,
+                               std::vector<bool> const & tiles)
+    : samples_(samples)
+    , lines_(lines)
+    , spans_()
+    , line_spans_()
+    , size_(0)
+{
+    if (tile == 0)
+        throw std::invalid_argument("Zero plot region tile size.");
+
+    auto const tile_samples = (samples + tile - 1) / tile;
+    auto const tile_lines   = (lines   + tile - 1) / tile;
+
+    if (tiles.size() != tile_samples * tile_lines)
+        throw std::invalid_argument("Plot region tile mask does not "
+                                    "match map size.");
+
+    std::vector<std::vector<span>> rows(lines);
+
+    for (std::size_t tk = 0; tk < tile_lines; ++tk) {
+        auto const first_line = tk * tile;
+        auto const last_line  = std::min(first_line + tile, lines);
+
+        for (std::size_t ti = 0; ti < tile_samples; ++ti) {
+            if (!tiles[tk * tile_samples + ti])
+                continue;
+
+            // Tile clipped to the map.
+            auto const first_sample = ti * tile;
+            auto const last_sample  = std::min(first_sample + tile, samples);
+
+            for (auto k = first_line; k < last_line; ++k)
+                rows[k].push_back({ first_sample, last_sample });
+        }
+    }
+
+    this->set_spans(rows);
+}
+
+MaRC::plot_region::plot_region(std::size_t samples,
+                               std::size_t lines,
+                               std::size_t tile,
+                               tile_classifier const & classify)
+    : samples_(samples)
+    , lines_(lines)
+    , spans_()
+    , line_spans_()
+    , size_(0)
+{
+    if (tile == 0)
+        throw std::invalid_argument("Zero plot region tile size.");
+
+    std::vector<std::vector<span>> rows(lines);
+
+    auto const include =
+        [&rows](tile_extent const & t)
+        {
+            for (auto k = t.first_line; k < t.last_line; ++k)
+                rows[k].push_back({ t.first_sample, t.last_sample });
+        };
+
+    // Width of the blocks at the current depth.
+    std::size_t size = tile;
+
+    while (size < samples || size < lines)
+        size *= 2;
+
+    std::vector<tile_extent> blocks;
+
+    if (samples > 0 && lines > 0)
+        blocks.push_back({ 0, samples, 0, lines });
+
+    while (!blocks.empty()) {
+        auto const states = classify(blocks);
+
+        if (states.size() != blocks.size())
+            throw std::invalid_argument("Number of plot region tile "
+                                        "states does not match number "
+                                        "of tiles.");
+
+        auto const half = size / 2;
+
+        std::vector<tile_extent> children;
+
+        for (std::size_t n = 0; n < blocks.size(); ++n) {
+            auto const & b = blocks[n];
+
+            if (states[n] == tile_state::empty)
+                continue;
+
+            if (states[n] == tile_state::full || size <= tile) {
+                include(b);
+                continue;
+            }
+
+            // Split the mixed block into its quadrants.
+            for (auto k = b.first_line; k < b.last_line; k += half)
+                for (auto i = b.first_sample; i < b.last_sample; i += half)
+                    children.push_back(
+                        { i,
+                          std::min(i + half, b.last_sample),
+                          k,
+                          std::min(k + half, b.last_line) });
+        }
+
+        blocks = std::move(children);
+        size = half;
+    }
+
+    this->set_spans(rows);
+}
+
+bool
+MaRC::plot_region::contains(std::size_t sample, std::size_t line) const
+{
+    if (line >= this->lines_)
+        return false;
+
+    for (auto const & s : this->spans(line))
+        if (sample >= s.first && sample < s.last)
+            return true;
+
+    return false;
+}
+
+void
+MaRC::plot_region::set_spans(std::vector<std::vector<span>> & rows)
+{
+    this->spans_.clear();
+    this->line_spans_.assign(1, 0);
+    this->size_ = 0;
+
+    for (auto & row : rows) {
+        std::sort(row.begin(),
+                  row.end(),
+                  [](span const & lhs, span const & rhs)
+                  {
+                      return lhs.first < rhs.first;
+                  });
+
+        auto const line_begin = this->spans_.size();
+
+        for (auto const & s : row) {
+            if (this->spans_.size() > line_begin
+                && s.first <= this->spans_.back().last) {
+                // Merge overlapping or adjacent spans.
+                auto & last = this->spans_.back().last;
+                last = std::max(last, s.last);
+            } else {
+                this->spans_.push_back(s);
+            }
+        }
+
+        for (auto i = line_begin; i < this->spans_.size(); ++i)
+            this->size_ += this->spans_[i].last - this->spans_[i].first;
+
+        this->line_spans_.push_back(this->spans_.size());
+    }
+}
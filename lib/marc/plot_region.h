@@ -0,0 +1,280 @@
+// -*- C++ -*-
+/**
+ * @file plot_region.h
+ *
+ * Copyright (C) 2026  Ossama Othman
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * @author Ossama Othman
+ */
+
+#ifndef MARC_PLOT_REGION_H
+#define MARC_PLOT_REGION_H
+
+#include <marc/Export.h>
+
+#include <vector>
+#include <functional>
+#include <cstddef>
+
+
+namespace MaRC
+{
+    /**
+     * @class plot_region plot_region.h <marc/plot_region.h>
+     *
+     * @brief Region of a map to be plotted.
+     *
+     * The region is stored as spans of consecutive map samples on
+     * each map line, allowing map projections to skip the latitude
+     * and longitude computations for the rest of the map entirely.
+     * Map pixels outside of the region are left blank.
+     */
+    class MARC_API plot_region
+    {
+    public:
+
+        /// Half-open range [first, last) of samples on a map line.
+        struct span
+        {
+            /// First sample in the span.
+            std::size_t first;
+
+            /// One past the last sample in the span.
+            std::size_t last;
+        };
+
+        /// Spans of samples on a map line, in increasing order.
+        class span_range
+        {
+        public:
+
+            /// Constructor.
+            span_range(span const * first, span const * last)
+                : first_(first)
+                , last_(last)
+            {
+            }
+
+            /// Get the first span.
+            span const * begin() const { return this->first_; }
+
+            /// Get one past the last span.
+            span const * end() const { return this->last_; }
+
+            /// Is there no span on the map line?
+            bool empty() const { return this->first_ == this->last_; }
+
+        private:
+
+            /// First span.
+            span const * first_;
+
+            /// One past the last span.
+            span const * last_;
+
+        };
+
+        /// Half-open block of map pixels.
+        struct tile_extent
+        {
+            /// First sample in the block.
+            std::size_t first_sample;
+
+            /// One past the last sample in the block.
+            std::size_t last_sample;
+
+            /// First line in the block.
+            std::size_t first_line;
+
+            /// One past the last line in the block.
+            std::size_t last_line;
+        };
+
+        /// Classification of a block of map pixels.
+        enum class tile_state
+        {
+            /// No map pixel in the block is to be plotted.
+            empty,
+
+            /// All map pixels in the block are to be plotted.
+            full,
+
+            /// Only some map pixels in the block may be plotted.
+            mixed
+        };
+
+        /**
+         * @brief Block of map pixels classification functor type.
+         *
+         * @param[in] tiles Blocks of map pixels to be classified.
+         *
+         * @return Classification of each block in @a tiles, in the
+         *         same order.
+         */
+        using tile_classifier =
+            std::function<std::vector<tile_state>(
+                              std::vector<tile_extent> const & tiles)>;
+
+        /**
+         * @brief Constructor for a region spanning the entire map.
+         *
+         * @param[in] samples Number of samples in the map.
+         * @param[in] lines   Number of lines   in the map.
+         */
+        plot_region(std::size_t samples, std::size_t lines);
+
+        /**
+         * @brief Constructor for a region made of the given spans.
+         *
+         * @param[in] samples Number of samples in the map.
+         * @param[in] lines   Number of lines   in the map.
+         * @param[in] rows    Spans of samples on each map line, in
+         *                    any order.  Overlapping or adjacent
+         *                    spans are merged.
+         *
+         * @throw std::invalid_argument @a rows size doesn't match
+         *                              @a lines, or a span extends
+         *                              beyond the map.
+         */
+        plot_region(std::size_t samples,
+                    std::size_t lines,
+                    std::vector<std::vector<span>> rows);
+
+        /**
+         * @brief Constructor for a region made of square map tiles.
+         *
+         * Only the tiles set in the tile mask are included in the
+         * region.  Tiles along the right and bottom edges of the map
+         * are clipped to the map.
+         *
+         * @param[in] samples Number of samples in the map.
+         * @param[in] lines   Number of lines   in the map.
+         * @param[in] tile    Width and height of each tile in map
+         *                    pixels.
+         * @param[in] tiles   Row-major tile mask, where @c true
+         *                    refers to a tile in the region.  It
+         *                    contains the number of tiles needed to
+         *                    cover the map in each direction, rounded
+         *                    up.
+         *
+         * @throw std::invalid_argument Zero @a tile size, or
+         *                              @a tiles size doesn't match
+         *                              the map.
+         */
+        plot_region(std::size_t samples,
+                    std::size_t lines,
+                    std::size_t tile,
+                    std::vector<bool> const & tiles);
+
+        /**
+         * @brief Constructor for a region culled top-down, quadtree
+         *        style.
+         *
+         * The map is covered by a single square block whose width
+         * is @a tile times a power of two, clipped to the map.
+         * Blocks classified as empty are discarded as a whole, and
+         * full blocks are included as a whole, without looking at
+         * them any further.  Only mixed blocks are split into four
+         * quadrants, which are classified in turn, down to blocks of
+         * @a tile map pixels.  Mixed blocks of that size are
+         * included in the region.  All blocks at a given depth are
+         * classified through a single call to @a classify.
+         *
+         * @param[in] samples  Number of samples in the map.
+         * @param[in] lines    Number of lines   in the map.
+         * @param[in] tile     Width and height of the smallest
+         *                     blocks in map pixels.
+         * @param[in] classify Functor that classifies blocks of map
+         *                     pixels.  It must be conservative,
+         *                     i.e. only classify a block as empty if
+         *                     none of its map pixels are to be
+         *                     plotted.
+         *
+         * @throw std::invalid_argument Zero @a tile size, or
+         *                              @a classify returned the
+         *                              wrong number of states.
+         */
+        plot_region(std::size_t samples,
+                    std::size_t lines,
+                    std::size_t tile,
+                    tile_classifier const & classify);
+
+        /// Get the number of samples in the map.
+        std::size_t samples() const { return this->samples_; }
+
+        /// Get the number of lines in the map.
+        std::size_t lines() const { return this->lines_; }
+
+        /// Get the number of map pixels in the region.
+        std::size_t size() const { return this->size_; }
+
+        /// Does the region span the entire map?
+        bool full() const
+        {
+            return this->size_ == this->samples_ * this->lines_;
+        }
+
+        /**
+         * @brief Get the spans of samples on the given map line.
+         *
+         * @param[in] line Map line.
+         */
+        span_range spans(std::size_t line) const
+        {
+            auto const first = this->spans_.data();
+
+            return span_range(first + this->line_spans_[line],
+                              first + this->line_spans_[line + 1]);
+        }
+
+        /**
+         * @brief Is the given map pixel in the region?
+         *
+         * @param[in] sample Map sample.
+         * @param[in] line   Map line.
+         */
+        bool contains(std::size_t sample, std::size_t line) const;
+
+    private:
+
+        /**
+         * @brief Initialize the region from the spans on each map
+         *        line.
+         *
+         * Spans on each line are sorted, and overlapping or adjacent
+         * spans are merged.
+         *
+         * @param[in,out] rows Spans on each map line.
+         */
+        void set_spans(std::vector<std::vector<span>> & rows);
+
+    private:
+
+        /// Number of samples in the map.
+        std::size_t const samples_;
+
+        /// Number of lines in the map.
+        std::size_t const lines_;
+
+        /// Spans on all map lines, in line order.
+        std::vector<span> spans_;
+
+        /**
+         * @brief Index of the first span on each map line.
+         *
+         * The spans on line @c k are found in the half-open range
+         * [@c line_spans_[k], @c line_spans_[k + 1]) of @c spans_.
+         */
+        std::vector<std::size_t> line_spans_;
+
+        /// Number of map pixels in the region.
+        std::size_t size_;
+
+    };
+
+} // End MaRC namespace
+
+
+#endif  /* MARC_PLOT_REGION_H */
@@ -3,7 +3,7 @@
  *
  * %MaRC root finding related functions
  *
- * Copyright (C) 2004, 2017-2018  Ossama Othman
+ * Copyright (C) 2004, 2017-2018, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -11,7 +11,6 @@
  */
 
 #include "root_find.h"
-#include "Mathematics.h"
 
 #ifndef NDEBUG
 // # include "Log.h"
@@ -24,57 +23,6 @@
 
 namespace
 {
-    /**
-     * @brief Compute the first derivative @a f'(x).
-     *
-     * Compute the first derivative of the function @a f at @a x using
-     * the center divided difference numerical method.
-     *
-     * @param[in] x Value at which the first derivative @c f'(x) will
-     *              be computed.
-     * @param[in] f Function whose first derivative @c f'(x) will be
-     *              computed.
-     *
-     * @return First derivative @c f'(x).
-     */
-    inline double
-    first_derivative(double x, std::function<double(double)> const & f)
-    {
-        /*
-          Choose a delta "h" that is approximately within the scale of
-          "x", being careful not to choose a delta that is less than
-          the machine accuracy "epsilon".
-
-          This is inspired by the discussion for selecting a value of
-          "h" in Section 5.7 - Numerical Derivates of the book
-          "Numerical Recipes in C" by Press, Teukolsky, Vetterling and
-          Flannery.
-         */
-        constexpr int epsilons = 2;
-        constexpr auto e =
-            epsilons * std::numeric_limits<double>::epsilon();
-        auto const h = (x < 1 ? e : e * x);
-
-        // Center divided difference numerical method of computing
-        // the first derivative.
-        return (f(x - 2 * h)
-                - 8 * f(x - h) + 8 * f(x + h)
-                - f(x + 2 * h))
-            / (12 * h);
-    }
-
-    inline bool
-    is_almost_equal(double lhs, double rhs)
-    {
-        constexpr int ulps = 2;
-        constexpr int epsilons = 2;
-
-        return
-            MaRC::almost_equal(lhs, rhs, ulps)
-            || (MaRC::almost_zero(lhs, epsilons)
-                && MaRC::almost_zero(rhs, epsilons));
-    }
-
     double
     newton_raphson(double y,
                    double x0,
@@ -82,6 +30,8 @@ namespace
     {
         constexpr int max_iterations = 20;
 
+        auto const df = MaRC::numerical_derivative(f);
+
         /**
          * @bug Division by zero if first derivative is zero.
          */
@@ -109,9 +59,9 @@ namespace
                    n+1    n    f'(x )
                                    n
              */
-            double const x = x0 - (f(x0) - y) / first_derivative(x0, f);
+            double const x = x0 - (f(x0) - y) / df(x0);
 
-            if (is_almost_equal(x, x0))
+            if (MaRC::details::is_almost_equal(x, x0))
                 return x;
 
             x0 = x;
@@ -190,86 +140,5 @@ MaRC::root_find(double y,
                 double xh,
                 std::function<double(double)> const & f)
 {
-    /*
-      This implementation is based on the rtsafe() function found in
-      Section 9.4 - Newton-Raphson Method Using Derivative of the book
-      "Numerical Recipes in C" by Press, Teukolsky, Vetterling and
-      Flannery.
-    */
-    double const yl = f(xl);
-    double const yh = f(xh);
-
-    // MaRC::debug ("(xl, xh, yl, yh, y) = "
-    //              "({}, {}, {}, {}, {})",
-    //                xl, xh, yl, yh, y);
-
-    if ((yl > y && yh > y) || (yl < y && yh < y))
-        throw
-            std::invalid_argument("Root finding brackets "
-                                  "are not suitable.");
-
-    if (is_almost_equal(yl, y))
-        return xl;
-    else if (is_almost_equal(yh, y))
-        return xh;
-
-    // Orient the search so that f(xl) < y.
-    //
-    // We are looking for the "root" at the given ordinate rather than
-    // the x-axis, meaning "y" is not necessarily zero.
-    if (yl > y)
-        std::swap(xl, xh);
-
-    // The "step size before last".
-    double dxold = std::abs(xh - xl);
-
-    // The last step.
-    double dx = dxold;
-
-    double x0 = (xl + xh) / 2;
-    double y0 = f(x0);
-
-    constexpr int max_iterations = 100;
-
-    for (int i = 0; i < max_iterations; ++i) {
-        double const df = first_derivative(x0, f);
-
-        // Bisect if Newtown-Raphson is out of range or not
-        // decreasing fast enough.
-        if (((x0 - xh) * df - y0 + y) * ((x0 - xl) * df - y0 + y) > 0
-            || std::abs(2 * (y0 - y)) > std::abs(dxold * df)){
-            dxold = dx;
-            dx = (xh - xl) / 2;
-            x0 = xl + dx;
-
-            // MaRC::debug("{:>8}: (dx, xl, x0) = ({}, {}, {})",
-            //             i, dx, xl, x0);
-        } else {
-            // Perform the Newtown-Raphson iteration.
-            dxold = dx;
-            dx = (y0 - y) / df;
-            x0 -= dx;
-
-            // MaRC::debug("{:>8}: (dx, df, x0, y0, y) = "
-            //             "({}, {}, {}, {}, {})",
-            //             i, dx, df, x0, y0, y);
-        }
-
-        // Convergence criterion.
-        constexpr int epsilons = 2;
-        if (MaRC::almost_zero(dx, epsilons))
-            return x0;
-
-        y0 = f(x0);
-
-        if (y0 < y)
-            xl = x0;
-        else
-            xh = x0;
-    }
-
-    throw
-        std::runtime_error("Root finding process is diverging.");
-
-    return std::numeric_limits<double>::signaling_NaN();
+    return MaRC::root_find(y, xl, xh, f, numerical_derivative(f));
 }
@@ -4,7 +4,7 @@
  *
  * %MaRC root finding related functions
  *
- * Copyright (C) 2004, 2017-2018  Ossama Othman
+ * Copyright (C) 2004, 2017-2018, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -17,6 +17,7 @@
 #include <marc/Export.h>
 
 #include <functional>
+#include <vector>
 
 
 namespace MaRC
@@ -82,7 +83,97 @@ namespace MaRC
                               double xl,
                               double xh,
                               std::function<double(double)> const & f);
+
+    /**
+     * @brief Numerical first derivative of a function.
+     *
+     * Compute the first derivative of @a f using the center divided
+     * difference numerical method, for use as the derivative
+     * argument of the @c root_find() function templates when no
+     * analytic derivative is available.
+     *
+     * @param[in] f Function whose first derivative will be computed.
+     *              It must outlive the returned callable.
+     *
+     * @return Callable that computes @c f'(x) given @c x.
+     */
+    template <typename F>
+    auto numerical_derivative(F const & f);
+
+    /**
+     * @brief Find root of a given equation within a search bracket
+     *        using its analytic derivative.
+     *
+     * Given a function y=f(x), and its first derivative f'(x), find
+     * the value of "x" at "y" within a search bracket.  The
+     * functions may be any callable, allowing them to be inlined
+     * into the root finding iterations.
+     *
+     * @note The current implementation uses a hybrid approach where
+     *       bisection is used if Newton-Raphson based root finding is
+     *       not converging quickly enough.
+     *
+     * @param[in] y  Known result of @a f(x).
+     * @param[in] xl Lower bound of root finding bracket.
+     * @param[in] xh Upper bound of root finding bracket.
+     * @param[in] f  Function @a f(x) for which @c x will be
+     *               computed.
+     * @param[in] df First derivative @a f'(x) of @a f.
+     *
+     * @throw std::invalid_argument Root finding bracket is not
+     *                              suitable since @a f(xl) and
+     *                              @a f(xh) do not bracket @a y.
+     * @throw std::runtime_error    Root finding process is
+     *                              diverging.
+     *
+     * @return The value @c x where @a f(x) is equal to @a y.
+     *
+     * @see numerical_derivative()
+     */
+    template <typename F, typename DF>
+    double root_find(double y,
+                     double xl,
+                     double xh,
+                     F const & f,
+                     DF const & df);
+
+    /**
+     * @brief Find roots of a given equation for a batch of values
+     *        within a search bracket.
+     *
+     * Given a function y=f(x), and its first derivative f'(x), find
+     * the value of "x" at each of the given "y" values within a
+     * search bracket common to all of them.  The roots are found in
+     * lockstep, one hybrid Newton-Raphson / bisection iteration at a
+     * time across the entire batch, so that the function evaluations
+     * for independent roots are interleaved rather than serialized,
+     * and the bracket end points are only evaluated once.
+     *
+     * @param[in]  y  Known results of @a f(x).
+     * @param[in]  xl Lower bound of root finding bracket.
+     * @param[in]  xh Upper bound of root finding bracket.
+     * @param[in]  f  Function @a f(x) for which @c x will be
+     *                computed.
+     * @param[in]  df First derivative @a f'(x) of @a f.
+     * @param[out] x  Values @c x where @a f(x) is equal to the
+     *                corresponding value in @a y.
+     *
+     * @throw std::invalid_argument Root finding bracket is not
+     *                              suitable for at least one value in
+     *                              @a y.
+     * @throw std::runtime_error    Root finding process is
+     *                              diverging.
+     */
+    template <typename F, typename DF>
+    void root_find(std::vector<double> const & y,
+                   double xl,
+                   double xh,
+                   F const & f,
+                   DF const & df,
+                   std::vector<double> & x);
 }
 
+#include "marc/root_find_t.cpp"
+
 
 #endif  /* MARC_ROOT_FIND_H */
@@ -0,0 +1,303 @@
+/**
+ * @file root_find_t.cpp
+ *
+ * %MaRC root finding related function templates
+ *
+ * Copyright (C) 2004, 2017-2018, 2026  Ossama Othman
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * @author Ossama Othman
+ */
+
+#ifndef MARC_ROOT_FIND_T_CPP
+#define MARC_ROOT_FIND_T_CPP
+
+#include "marc/root_find.h"
+#include "marc/Mathematics.h"
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+
+namespace MaRC
+{
+    namespace details
+    {
+        /**
+         * @brief Check if two root finding values are essentially
+         *        equal.
+         *
+         * @note This function is not part of the public %MaRC
+         *       library API.
+         */
+        inline bool
+        is_almost_equal(double lhs, double rhs)
+        {
+            constexpr int ulps = 2;
+            constexpr int epsilons = 2;
+
+            return
+                MaRC::almost_equal(lhs, rhs, ulps)
+                || (MaRC::almost_zero(lhs, epsilons)
+                    && MaRC::almost_zero(rhs, epsilons));
+        }
+
+        /**
+         * @struct bracket details/root_find_t.cpp
+         *
+         * @brief State of a bracketed root finding process.
+         *
+         * @note This structure is not part of the public %MaRC
+         *       library API.
+         */
+        struct bracket
+        {
+            /// End of the bracket where f(x) < y.
+            double xl;
+
+            /// End of the bracket where f(x) > y.
+            double xh;
+
+            /// Current root estimate.
+            double x0;
+
+            /// Value of f(x0).
+            double y0;
+
+            /// The last step.
+            double dx;
+
+            /// The step size before last.
+            double dxold;
+        };
+
+        /**
+         * @brief Start a bracketed root finding process.
+         *
+         * @param[in]  y  Known result of @a f(x).
+         * @param[in]  xl Lower bound of root finding bracket.
+         * @param[in]  xh Upper bound of root finding bracket.
+         * @param[in]  yl Value of @a f(xl).
+         * @param[in]  yh Value of @a f(xh).
+         * @param[in]  y0 Value of @a f(x) at the center of the
+         *                bracket.
+         * @param[out] b  Root finding state.
+         * @param[out] x  Root, if found at an end of the bracket.
+         *
+         * @throw std::invalid_argument Root finding bracket is not
+         *                              suitable.
+         *
+         * @return @c true if the root is at an end of the bracket.
+         *
+         * @note This function is not part of the public %MaRC
+         *       library API.
+         */
+        inline bool
+        start(double y,
+              double xl,
+              double xh,
+              double yl,
+              double yh,
+              double y0,
+              bracket & b,
+              double & x)
+        {
+            if ((yl > y && yh > y) || (yl < y && yh < y))
+                throw
+                    std::invalid_argument("Root finding brackets "
+                                          "are not suitable.");
+
+            if (is_almost_equal(yl, y)) {
+                x = xl;
+                return true;
+            } else if (is_almost_equal(yh, y)) {
+                x = xh;
+                return true;
+            }
+
+            // Orient the search so that f(xl) < y.
+            //
+            // We are looking for the "root" at the given ordinate
+            // rather than the x-axis, meaning "y" is not necessarily
+            // zero.
+            if (yl > y)
+                std::swap(xl, xh);
+
+            b.xl    = xl;
+            b.xh    = xh;
+            b.x0    = (xl + xh) / 2;
+            b.y0    = y0;
+            b.dxold = std::abs(xh - xl);
+            b.dx    = b.dxold;
+
+            return false;
+        }
+
+        /**
+         * @brief Perform one bracketed root finding iteration.
+         *
+         * This implementation is based on the rtsafe() function
+         * found in Section 9.4 - Newton-Raphson Method Using
+         * Derivative of the book "Numerical Recipes in C" by Press,
+         * Teukolsky, Vetterling and Flannery.
+         *
+         * @param[in]     y  Known result of @a f(x).
+         * @param[in]     f  Function @a f(x).
+         * @param[in]     df First derivative @a f'(x) of @a f.
+         * @param[in,out] b  Root finding state.
+         *
+         * @return @c true if the root estimate @c b.x0 converged.
+         *
+         * @note This function is not part of the public %MaRC
+         *       library API.
+         */
+        template <typename F, typename DF>
+        bool
+        iterate(double y, F const & f, DF const & df, bracket & b)
+        {
+            double const d = df(b.x0);
+
+            // Bisect if Newtown-Raphson is out of range or not
+            // decreasing fast enough.
+            if (((b.x0 - b.xh) * d - b.y0 + y)
+                * ((b.x0 - b.xl) * d - b.y0 + y) > 0
+                || std::abs(2 * (b.y0 - y)) > std::abs(b.dxold * d)) {
+                b.dxold = b.dx;
+                b.dx = (b.xh - b.xl) / 2;
+                b.x0 = b.xl + b.dx;
+            } else {
+                // Perform the Newtown-Raphson iteration.
+                b.dxold = b.dx;
+                b.dx = (b.y0 - y) / d;
+                b.x0 -= b.dx;
+            }
+
+            // Convergence criterion.
+            constexpr int epsilons = 2;
+            if (MaRC::almost_zero(b.dx, epsilons))
+                return true;
+
+            b.y0 = f(b.x0);
+
+            if (b.y0 < y)
+                b.xl = b.x0;
+            else
+                b.xh = b.x0;
+
+            return false;
+        }
+
+        /// Maximum number of bracketed root finding iterations.
+        constexpr int max_bracket_iterations = 100;
+    }
+}
+
+template <typename F>
+auto
+MaRC::numerical_derivative(F const & f)
+{
+    return
+        [&f](double x)
+        {
+            /*
+              Choose a delta "h" that is approximately within the
+              scale of "x", being careful not to choose a delta that
+              is less than the machine accuracy "epsilon".
+
+              This is inspired by the discussion for selecting a value
+              of "h" in Section 5.7 - Numerical Derivates of the book
+              "Numerical Recipes in C" by Press, Teukolsky, Vetterling
+              and Flannery.
+            */
+            constexpr int epsilons = 2;
+            constexpr auto e =
+                epsilons * std::numeric_limits<double>::epsilon();
+            auto const h = (x < 1 ? e : e * x);
+
+            // Center divided difference numerical method of computing
+            // the first derivative.
+            return (f(x - 2 * h)
+                    - 8 * f(x - h) + 8 * f(x + h)
+                    - f(x + 2 * h))
+                / (12 * h);
+        };
+}
+
+template <typename F, typename DF>
+double
+MaRC::root_find(double y,
+                double xl,
+                double xh,
+                F const & f,
+                DF const & df)
+{
+    details::bracket b;
+    double x;
+
+    if (details::start(y, xl, xh, f(xl), f(xh), f((xl + xh) / 2), b, x))
+        return x;
+
+    for (int i = 0; i < details::max_bracket_iterations; ++i)
+        if (details::iterate(y, f, df, b))
+            return b.x0;
+
+    throw
+        std::runtime_error("Root finding process is diverging.");
+}
+
+template <typename F, typename DF>
+void
+MaRC::root_find(std::vector<double> const & y,
+                double xl,
+                double xh,
+                F const & f,
+                DF const & df,
+                std::vector<double> & x)
+{
+    auto const n = y.size();
+
+    x.resize(n);
+
+    // The bracket is common to all roots, so only evaluate the
+    // function at its ends and center once.
+    double const yl = f(xl);
+    double const yh = f(xh);
+    double const y0 = f((xl + xh) / 2);
+
+    std::vector<details::bracket> brackets(n);
+
+    // Indices of the roots still being searched for.
+    std::vector<std::size_t> active;
+    active.reserve(n);
+
+    for (std::size_t i = 0; i < n; ++i)
+        if (!details::start(y[i], xl, xh, yl, yh, y0, brackets[i], x[i]))
+            active.push_back(i);
+
+    for (int iteration = 0;
+         iteration < details::max_bracket_iterations && !active.empty();
+         ++iteration) {
+        std::size_t remaining = 0;
+
+        for (auto const i : active) {
+            auto & b = brackets[i];
+
+            if (details::iterate(y[i], f, df, b))
+                x[i] = b.x0;
+            else
+                active[remaining++] = i;
+        }
+
+        active.resize(remaining);
+    }
+
+    if (!active.empty())
+        throw
+            std::runtime_error("Root finding process is diverging.");
+}
+
+
+#endif  /* MARC_ROOT_FIND_T_CPP */
@@ -1,7 +1,7 @@
 /**
  * @file unweighted_average.cpp
  *
- * Copyright (C) 2003-2004, 2017, 2020-2021  Ossama Othman
+ * Copyright (C) 2003-2004, 2017, 2020-2021, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -64,3 +64,32 @@ MaRC::unweighted_average::composite(list_type const & images,
 
     return count;
 }
+
+int
+MaRC::unweighted_average::composite(list_type const & images,
+                                    std::vector<std::size_t> const & firsts,
+                                    double lat,
+                                    double lon,
+                                    ResamplingPlan::tap_list & taps) const
+{
+    auto const begin = taps.size();
+
+    double weight = 1;  // Unused.
+
+    static constexpr bool scan = false;  // Do not scan for data weight.
+
+    // Datum count.
+    int count = 0;
+
+    for (std::size_t i = 0; i < images.size(); ++i)
+        if (images[i]->read_taps(lat, lon, firsts[i], taps, weight, scan))
+            ++count;
+
+    // The pixels from each image sum to one.  Average them.
+    if (count > 1) {
+        for (auto t = begin; t < taps.size(); ++t)
+            taps[t].weight /= count;
+    }
+
+    return count;
+}
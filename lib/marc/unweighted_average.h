@@ -2,7 +2,7 @@
 /**
  * @file unweighted_average.h
  *
- * Copyright (C) 2021, 2022  Ossama Othman
+ * Copyright (C) 2021, 2022, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -55,6 +55,20 @@ namespace MaRC
                        double lon,
                        double & data) const override;
 
+        /**
+         * @brief Average pixel weights at given latitude and
+         *        longitude.
+         *
+         * The pixels from each image are weighted equally.
+         *
+         * @see @c compositing_strategy for parameter details.
+         */
+        int composite(list_type const & images,
+                      std::vector<std::size_t> const & firsts,
+                      double lat,
+                      double lon,
+                      ResamplingPlan::tap_list & taps) const override;
+
     };
 
 }
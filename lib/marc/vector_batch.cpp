@@ -0,0 +1,109 @@
+/**
+ * @file vector_batch.cpp
+ *
+ * Copyright (C) 2026  Ossama Othman
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * @author Ossama Othman
+ */
+
+#include "vector_batch.h"
+
+#include <stdexcept>
+#include <cmath>
+
+
+MaRC::vector_batch::vector_batch(std::size_t n)
+    : x_(n)
+    , y_(n)
+    , z_(n)
+{
+}
+
+void
+MaRC::vector_batch::resize(std::size_t n)
+{
+    this->x_.resize(n);
+    this->y_.resize(n);
+    this->z_.resize(n);
+}
+
+void
+MaRC::multiply(DMatrix const & A, vector_batch const & v, vector_batch & r)
+{
+    multiply(A, v, DVector(), r);
+}
+
+void
+MaRC::multiply(DMatrix const & A,
+               vector_batch const & v,
+               DVector const & origin,
+               vector_batch & r)
+{
+    auto const n = v.size();
+
+    r.resize(n);
+
+    /*
+      Copy the matrix elements and origin into locals so that the
+      compiler knows they are not modified through the output arrays,
+      and may keep them in registers across the loop.  Only the input
+      and output component arrays are accessed in the loop, each
+      consecutively, allowing it to be auto-vectorized.
+    */
+    double const a00 = A(0, 0), a01 = A(0, 1), a02 = A(0, 2);
+    double const a10 = A(1, 0), a11 = A(1, 1), a12 = A(1, 2);
+    double const a20 = A(2, 0), a21 = A(2, 1), a22 = A(2, 2);
+
+    double const ox = origin[0];
+    double const oy = origin[1];
+    double const oz = origin[2];
+
+    double const * const vx = v.x();
+    double const * const vy = v.y();
+    double const * const vz = v.z();
+
+    double * const rx = r.x();
+    double * const ry = r.y();
+    double * const rz = r.z();
+
+    for (std::size_t i = 0; i < n; ++i) {
+        // Read all components first in case r and v are the same
+        // batch.
+        double const x = vx[i] - ox;
+        double const y = vy[i] - oy;
+        double const z = vz[i] - oz;
+
+        rx[i] = a00 * x + a01 * y + a02 * z;
+        ry[i] = a10 * x + a11 * y + a12 * z;
+        rz[i] = a20 * x + a21 * y + a22 * z;
+    }
+}
+
+void
+MaRC::spherical_to_cartesian(std::vector<double> const & lat,
+                             std::vector<double> const & lon,
+                             std::vector<double> const & radius,
+                             vector_batch & r)
+{
+    auto const n = lat.size();
+
+    if (lon.size() != n || radius.size() != n)
+        throw std::invalid_argument("Spherical coordinate arrays "
+                                    "differ in size.");
+
+    r.resize(n);
+
+    double * const x = r.x();
+    double * const y = r.y();
+    double * const z = r.z();
+
+    for (std::size_t i = 0; i < n; ++i) {
+        double const rho = radius[i] * std::cos(lat[i]);
+
+        x[i] =  rho * std::sin(lon[i]);
+        y[i] = -rho * std::cos(lon[i]);
+        z[i] =  radius[i] * std::sin(lat[i]);
+    }
+}
@@ -0,0 +1,178 @@
+// -*- C++ -*-
+/**
+ * @file vector_batch.h
+ *
+ * %MaRC structure-of-arrays vector batch and kernels.
+ *
+ * Copyright (C) 2026  Ossama Othman
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * @author Ossama Othman
+ */
+
+#ifndef MARC_VECTOR_BATCH_H
+#define MARC_VECTOR_BATCH_H
+
+#include <marc/Geometry.h>
+#include <marc/Export.h>
+
+#include <vector>
+#include <cstddef>
+
+
+namespace MaRC
+{
+    /**
+     * @class vector_batch vector_batch.h <marc/vector_batch.h>
+     *
+     * @brief Batch of three-dimensional vectors stored as a
+     *        structure of arrays.
+     *
+     * The components of the vectors are stored in separate
+     * contiguous arrays rather than one @c DVector at a time, so
+     * that kernels operating on the entire batch, such as the ones
+     * below, process consecutive vectors with the same instructions
+     * and may be auto-vectorized by the compiler.
+     */
+    class MARC_API vector_batch
+    {
+    public:
+
+        /**
+         * @brief Constructor.
+         *
+         * @param[in] n Number of vectors in the batch, initialized
+         *              to zero.
+         */
+        explicit vector_batch(std::size_t n = 0);
+
+        /// Change the number of vectors in the batch.
+        void resize(std::size_t n);
+
+        /// Get the number of vectors in the batch.
+        std::size_t size() const { return this->x_.size(); }
+
+        /**
+         * @name Component Arrays
+         *
+         * Get the array of the x, y or z components of the vectors in
+         * the batch.
+         */
+        ///@{
+        double * x() { return this->x_.data(); }
+        double * y() { return this->y_.data(); }
+        double * z() { return this->z_.data(); }
+        double const * x() const { return this->x_.data(); }
+        double const * y() const { return this->y_.data(); }
+        double const * z() const { return this->z_.data(); }
+        ///@}
+
+        /**
+         * @brief Get a vector in the batch.
+         *
+         * @param[in] i Zero-based index of the vector.
+         *
+         * @note No bounds checking.
+         */
+        DVector operator[](std::size_t i) const
+        {
+            return DVector(this->x_[i], this->y_[i], this->z_[i]);
+        }
+
+        /**
+         * @brief Set a vector in the batch.
+         *
+         * @param[in] i Zero-based index of the vector.
+         * @param[in] v Vector to be stored.
+         *
+         * @note No bounds checking.
+         */
+        void set(std::size_t i, DVector const & v)
+        {
+            this->x_[i] = v[0];
+            this->y_[i] = v[1];
+            this->z_[i] = v[2];
+        }
+
+    private:
+
+        /// x components of the vectors.
+        std::vector<double> x_;
+
+        /// y components of the vectors.
+        std::vector<double> y_;
+
+        /// z components of the vectors.
+        std::vector<double> z_;
+
+    };
+
+    /**
+     * @brief Multiply a batch of vectors by a matrix.
+     *
+     * Compute @c A*v[i] for all vectors in the batch @a v.
+     *
+     * @param[in]  A Matrix by which each vector is multiplied.
+     * @param[in]  v Batch of vectors.
+     * @param[out] r Batch of products.  It may be the same batch as
+     *               @a v.
+     */
+    MARC_API void multiply(DMatrix const & A,
+                           vector_batch const & v,
+                           vector_batch & r);
+
+    /**
+     * @brief Multiply a batch of vectors relative to an origin by a
+     *        matrix.
+     *
+     * Compute @c A*(v[i]-origin) for all vectors in the batch @a v,
+     * e.g. to transform points on the surface of a body to observer
+     * coordinates, without creating the intermediate differences.
+     *
+     * @param[in]  A      Matrix by which each vector is multiplied.
+     * @param[in]  v      Batch of vectors.
+     * @param[in]  origin Vector subtracted from each vector in the
+     *                    batch before multiplication.
+     * @param[out] r      Batch of products.  It may be the same
+     *                    batch as @a v.
+     */
+    MARC_API void multiply(DMatrix const & A,
+                           vector_batch const & v,
+                           DVector const & origin,
+                           vector_batch & r);
+
+    /**
+     * @brief Convert a batch of spherical coordinates to Cartesian
+     *        coordinates.
+     *
+     * Compute the vectors from the center of a body to points at the
+     * given latitudes, longitudes and radii in the %MaRC body
+     * coordinate system, i.e.:
+     *
+     * @code
+     *     x =  radius * cos(lat) * sin(lon)
+     *     y = -radius * cos(lat) * cos(lon)
+     *     z =  radius * sin(lat)
+     * @endcode
+     *
+     * where zero longitude is on the negative y-axis.
+     *
+     * @param[in]  lat    Planetocentric latitudes in radians.
+     * @param[in]  lon    Longitudes in radians.
+     * @param[in]  radius Distances from the center of the body, such
+     *                    as the radii of the body at each latitude.
+     * @param[out] r      Batch of Cartesian vectors, resized to the
+     *                    number of latitudes.
+     *
+     * @throw std::invalid_argument Arrays of different sizes.
+     */
+    MARC_API void spherical_to_cartesian(std::vector<double> const & lat,
+                                         std::vector<double> const & lon,
+                                         std::vector<double> const & radius,
+                                         vector_batch & r);
+
+} // End MaRC namespace
+
+
+#endif  /* MARC_VECTOR_BATCH_H */
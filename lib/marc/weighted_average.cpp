@@ -1,7 +1,7 @@
 /**
  * @file weighted_average.cpp
  *
- * Copyright (C) 2003-2004, 2017, 2020-2021  Ossama Othman
+ * Copyright (C) 2003-2004, 2017, 2020-2021, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: LGPL-2.1-or-later
  *
@@ -10,6 +10,9 @@
 
 #include "weighted_average.h"
 
+#include <vector>
+#include <utility>
+
 
 int
 MaRC::weighted_average::composite(list_type const & images,
@@ -51,3 +54,60 @@ MaRC::weighted_average::composite(list_type const & images,
 
     return count;
 }
+
+int
+MaRC::weighted_average::composite(list_type const & images,
+                                  std::vector<std::size_t> const & firsts,
+                                  double lat,
+                                  double lon,
+                                  ResamplingPlan::tap_list & taps) const
+{
+    auto const begin = taps.size();
+
+    // Data weight of each image that contributed pixels, and the
+    // number of pixels it contributed.
+    std::vector<std::pair<double, std::size_t>> weights;
+
+    long double weight_sum = 0;
+
+    for (std::size_t i = 0; i < images.size(); ++i) {
+        // Physical data weight.
+        double weight = 1;
+
+        // Scan for data weight.
+        static constexpr bool scan = true;
+
+        auto const size = taps.size();
+
+        if (images[i]->read_taps(lat, lon, firsts[i], taps, weight, scan)) {
+            weights.emplace_back(weight, taps.size() - size);
+            weight_sum += weight;
+        }
+    }
+
+    /*
+      As is the case for the data itself, only weight the pixels if
+      more than one image contributed.  The pixels from each image
+      sum to one.
+    */
+    if (weights.size() > 1) {
+        if (weight_sum > 0) {
+            auto t = begin;
+
+            for (auto const & w : weights) {
+                auto const scale =
+                    static_cast<double>(w.first / weight_sum);
+
+                for (auto const end = t + w.second; t < end; ++t)
+                    taps[t].weight *= scale;
+            }
+        } else {
+            // The datum from the last image is used in this case.
+            auto const last = taps.size() - weights.back().second;
+
+            taps.erase(taps.begin() + begin, taps.begin() + last);
+        }
+    }
+
+    return static_cast<int>(weights.size());
+}
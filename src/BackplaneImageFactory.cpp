@@ -0,0 +1,217 @@
+/**
+ * @file BackplaneImageFactory.cpp
+ *
+ * Copyright (C) 2026  Ossama Othman
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * @author Ossama Othman
+ */
+
+#include "BackplaneImageFactory.h"
+#include "map_parameters.h"
+
+#include "marc/DefaultConfiguration.h"
+#include "marc/details/format.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+
+MaRC::BackplaneImageFactory::BackplaneImageFactory(
+    std::shared_ptr<BodyData> body,
+    backplane type)
+    : SourceImageFactory()
+    , body_(std::move(body))
+    , sub_observ_()
+    , sub_solar_()
+    , planes_{ { type, {} } }
+{
+}
+
+void
+MaRC::BackplaneImageFactory::sub_observ(double lat,
+                                        double lon,
+                                        double range)
+{
+    this->sub_observ_ = observer{ lat, lon, range };
+}
+
+void
+MaRC::BackplaneImageFactory::sub_solar(double lat, double lon)
+{
+    this->sub_solar_ = sun{ lat, lon };
+}
+
+void
+MaRC::BackplaneImageFactory::data_range(std::optional<double> minimum,
+                                        std::optional<double> maximum)
+{
+    auto & minmax = this->planes_.back().minmax;
+
+    if (minimum)
+        minmax.minimum(*minimum);
+
+    if (maximum)
+        minmax.maximum(*maximum);
+}
+
+bool
+MaRC::BackplaneImageFactory::merge(BackplaneImageFactory const & other)
+{
+    auto const & o = other.sub_observ_;
+    auto const & s = other.sub_solar_;
+
+    // All backplanes of a BackplaneImage share the same geometry.
+    if (this->body_ != other.body_
+        || (o && this->sub_observ_
+            && (o->lat      != this->sub_observ_->lat
+                || o->lon   != this->sub_observ_->lon
+                || o->range != this->sub_observ_->range))
+        || (s && this->sub_solar_
+            && (s->lat    != this->sub_solar_->lat
+                || s->lon != this->sub_solar_->lon)))
+        return false;
+
+    if (o)
+        this->sub_observ_ = o;
+
+    if (s)
+        this->sub_solar_ = s;
+
+    this->planes_.insert(this->planes_.end(),
+                         other.planes_.cbegin(),
+                         other.planes_.cend());
+
+    return true;
+}
+
+bool
+MaRC::BackplaneImageFactory::populate_parameters(
+    MaRC::map_parameters & p) const
+{
+    /**
+     * @note "deg" is used instead of "degree" per %FITS standard
+     *       recommendation for the BUNIT keyword.
+     *
+     * @note As was the case for separate latitude and longitude map
+     *       planes, the unit applies to the map as a whole, even if
+     *       it also contains cosines.
+     *
+     * @see https://heasarc.gsfc.nasa.gov/docs/fcg/standard_dict.html
+     */
+    if (std::any_of(this->planes_.cbegin(),
+                    this->planes_.cend(),
+                    [](auto const & plane)
+                    {
+                        return
+                            plane.type != backplane::mu
+                            && plane.type != backplane::mu0
+                            && plane.type != backplane::cos_phase;
+                    }))
+        p.bunit("deg");
+
+    /**
+     * @note The %FITS @c DATAMIN and @c DATAMAX values are not set in
+     *       the map parameters.  Instead they are set in each
+     *       backplane so that they may be used when plotting the
+     *       image to the map.  The %FITS @c DATAMIN and @c DATAMAX
+     *       values corresponding to data that was actually plotted
+     *       will be automatically written to map %FITS once mapping
+     *       is done.
+     *
+     * @see make()
+     */
+
+    return true;
+}
+
+std::unique_ptr<MaRC::SourceImage>
+MaRC::BackplaneImageFactory::make(scale_offset_functor calc_so,
+                                  thread_pool & /* pool */)
+{
+    using namespace MaRC::default_configuration;
+
+    BackplaneImage::plane_list planes;
+
+    for (auto const & p : this->planes_) {
+        double low  = 0;
+        double high = 0;
+        char const * name = nullptr;
+
+        switch (p.type) {
+        case backplane::latitude:
+        case backplane::graphic_latitude:
+            low  = latitude_low;
+            high = latitude_high;
+            name = "latitudes";
+            break;
+
+        case backplane::longitude:
+            low  = longitude_low;
+            high = longitude_high;
+            name = "longitudes";
+            break;
+
+        case backplane::mu:
+            low  = mu_low;
+            high = mu_high;
+            name = "mu (cosines)";
+            break;
+
+        case backplane::mu0:
+            low  = mu0_low;
+            high = mu0_high;
+            name = "mu0 (cosines)";
+            break;
+
+        case backplane::cos_phase:
+            low  = cos_phase_low;
+            high = cos_phase_high;
+            name = "cosine of phase angles";
+            break;
+        }
+
+        double scale  = 1;
+        double offset = 0;
+
+        if (!calc_so(low, high, scale, offset)) {
+            throw std::range_error(
+                fmt::format("Cannot store {} in map of chosen data "
+                            "type.",
+                            name));
+        }
+
+        BackplaneImage::plane plane{ p.type, scale, offset, p.minmax };
+
+        /*
+          Set physical data extrema if not previously set.
+
+          Scale the default minimum and maximum to match the physical
+          data scaling.
+        */
+        if (!plane.minmax.minimum())
+            plane.minmax.minimum(low * scale + offset);
+
+        if (!plane.minmax.maximum())
+            plane.minmax.maximum(high * scale + offset);
+
+        planes.push_back(std::move(plane));
+    }
+
+    /*
+      Geometry not required by any of the backplanes is left at zero.
+      The corresponding photometric quantities are computed but
+      discarded.
+    */
+    auto const o = this->sub_observ_.value_or(observer{ 0, 0, 0 });
+    auto const s = this->sub_solar_.value_or(sun{ 0, 0 });
+
+    return std::make_unique<MaRC::BackplaneImage>(this->body_,
+                                                  o.lat,
+                                                  o.lon,
+                                                  s.lat,
+                                                  s.lon,
+                                                  o.range,
+                                                  std::move(planes));
+}
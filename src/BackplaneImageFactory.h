@@ -0,0 +1,179 @@
+// -*- C++ -*-
+/**
+ * @file BackplaneImageFactory.h
+ *
+ * Copyright (C) 2026  Ossama Othman
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * @author Ossama Othman
+ */
+
+#ifndef MARC_BACKPLANE_IMAGE_FACTORY_H
+#define MARC_BACKPLANE_IMAGE_FACTORY_H
+
+#include "SourceImageFactory.h"
+
+#include <marc/BackplaneImage.h>
+
+#include <optional>
+#include <vector>
+
+
+namespace MaRC
+{
+    class BodyData;
+
+    /**
+     * @class BackplaneImageFactory
+     *
+     * @brief Factory class that creates @c BackplaneImage objects.
+     *
+     * This class creates @c BackplaneImage objects with one band per
+     * latitude, longitude, &mu;, &mu;<SUB>0</SUB> or cos(&phi;) map
+     * plane.  Consecutive backplane map planes are merged into a
+     * single factory so that they are all computed in one map
+     * traversal.
+     *
+     * @note The physical data extrema of each backplane are kept
+     *       with that backplane rather than in the
+     *       @c SourceImageFactory extrema, which would otherwise
+     *       apply to all of the merged backplanes.
+     */
+    class BackplaneImageFactory final : public SourceImageFactory
+    {
+    public:
+
+        /// Geometric quantity computed in a backplane.
+        using backplane = BackplaneImage::backplane;
+
+        /**
+         * @brief Constructor.
+         *
+         * @param[in] body Body being mapped.
+         * @param[in] type Quantity computed in the first backplane.
+         */
+        BackplaneImageFactory(std::shared_ptr<BodyData> body,
+                              backplane type);
+
+        /// Destructor.
+        ~BackplaneImageFactory() override = default;
+
+        /**
+         * @brief Set the observer geometry.
+         *
+         * The observer geometry is required by &mu; and cos(&phi;)
+         * backplanes.
+         *
+         * @param[in] lat   Planetocentric sub-observer latitude in
+         *                  degrees.
+         * @param[in] lon   Sub-observer longitude in degrees.
+         * @param[in] range Observer to target center distance.
+         */
+        void sub_observ(double lat, double lon, double range);
+
+        /**
+         * @brief Set the sub-solar point.
+         *
+         * The sub-solar point is required by &mu;<SUB>0</SUB> and
+         * cos(&phi;) backplanes.
+         *
+         * @param[in] lat Planetocentric sub-solar latitude in degrees.
+         * @param[in] lon Sub-solar longitude in degrees.
+         */
+        void sub_solar(double lat, double lon);
+
+        /**
+         * @brief Set the physical data extrema of the last backplane.
+         *
+         * @param[in] minimum User-specified minimum physical data
+         *                    value, if any.
+         * @param[in] maximum User-specified maximum physical data
+         *                    value, if any.
+         */
+        void data_range(std::optional<double> minimum,
+                        std::optional<double> maximum);
+
+        /**
+         * @brief Append the backplanes of another factory.
+         *
+         * @param[in] other Factory whose backplanes will be computed
+         *                  after those of this factory.
+         *
+         * @retval true  Backplanes merged.
+         * @retval false The bodies or the observer or solar geometry
+         *               of the factories differ.  Nothing was
+         *               merged.
+         */
+        bool merge(BackplaneImageFactory const & other);
+
+        /// Populate map parameters.
+        bool populate_parameters(
+            map_parameters & parameters) const override;
+
+        /// Create a @c BackplaneImage.
+        std::unique_ptr<SourceImage> make(
+            scale_offset_functor calc_so,
+            thread_pool & pool) override;
+
+        /// Number of backplanes.
+        std::size_t bands() const override
+        {
+            return this->planes_.size();
+        }
+
+    private:
+
+        /// Observer geometry.
+        struct observer
+        {
+            /// Planetocentric sub-observer latitude (degrees).
+            double lat;
+
+            /// Sub-observer longitude (degrees).
+            double lon;
+
+            /// Center of body distance to observer (kilometers).
+            double range;
+        };
+
+        /// Sub-solar point.
+        struct sun
+        {
+            /// Planetocentric sub-solar latitude (degrees).
+            double lat;
+
+            /// Sub-solar longitude (degrees).
+            double lon;
+        };
+
+        /// Backplane configuration.
+        struct plane
+        {
+            /// Quantity computed in the backplane.
+            backplane type;
+
+            /// User-specified physical data extrema.
+            extrema_type minmax;
+        };
+
+    private:
+
+        /// Object representing the body being mapped.
+        std::shared_ptr<BodyData> const body_;
+
+        /// Observer geometry, if required by a backplane.
+        std::optional<observer> sub_observ_;
+
+        /// Sub-solar point, if required by a backplane.
+        std::optional<sun> sub_solar_;
+
+        /// Backplanes in band order.
+        std::vector<plane> planes_;
+
+    };
+
+}
+
+
+#endif  /* MARC_BACKPLANE_IMAGE_FACTORY_H */
@@ -12,7 +12,10 @@
 #include "FITS_image.h"
 
 #include <marc/Log.h>
+#include <marc/config.h>  // For MARC_CFITSIO_REENTRANT.
+#include <marc/details/format.h>
 
+#include <algorithm>
 #include <limits>
 #include <type_traits>
 #include <stdexcept>
@@ -147,6 +150,17 @@ void MaRC::FITS::throw_on_error(int status)
     }
 }
 
+bool MaRC::FITS::is_reentrant()
+{
+#ifdef MARC_CFITSIO_REENTRANT
+    // Also check at run-time in case a different CFITSIO library
+    // than the one detected at configure-time is loaded.
+    return fits_is_reentrant() != 0;
+#else
+    return false;
+#endif  // MARC_CFITSIO_REENTRANT
+}
+
 // ----------------------------------------------------------------
 
 MaRC::FITS::file::file(char const * filename, bool create)
@@ -321,9 +335,16 @@ MaRC::FITS::file::telescope() const
 
 MaRC::FITS::output_file::output_file(char const * filename)
     : file(filename, true)
+    , compression_()
 {
 }
 
+void
+MaRC::FITS::output_file::compression(compression_parameters const & c)
+{
+    this->compression_ = c;
+}
+
 std::unique_ptr<MaRC::FITS::image>
 MaRC::FITS::output_file::make_image(int bitpix,
                                     size_t samples,
@@ -331,6 +352,49 @@ MaRC::FITS::output_file::make_image(int bitpix,
                                     size_t planes,
                                     char const * extname)
 {
+    fitsfile * const fptr = this->fptr_.get();
+    auto const & c = this->compression_;
+
+    int status = 0;
+
+    /*
+      CFITSIO compresses images created after the compression
+      parameters are set, one tile at a time as the image is written.
+      CFITSIO offers no way to compress tiles outside of that
+      serialized write path, so compression runs on the map writer
+      thread, overlapped with mapping of the next batch of map
+      planes.
+    */
+    if (c.enabled) {
+        int const type =
+            (bitpix < 0
+             ? GZIP_2  // Byte shuffled GZIP suits floating point data.
+             : (bitpix == LONGLONG_IMG ? GZIP_1 : RICE_1));
+
+        long const tile_samples =
+            (c.tile_samples > 0
+             ? std::min(c.tile_samples, static_cast<long>(samples))
+             : static_cast<long>(samples));
+
+        long tile[] = {
+            tile_samples,
+            std::clamp(c.tile_lines, 1L, static_cast<long>(lines)),
+            1   // One plane per tile.
+        };
+
+        int const ndim = (planes > 1 ? 3 : 2);
+
+        fits_set_compression_type(fptr, type, &status);
+        fits_set_tile_dim(fptr, ndim, tile, &status);
+
+        if (bitpix < 0)
+            fits_set_quantize_level(fptr, c.quantize, &status);
+    } else {
+        fits_set_compression_type(fptr, NOCOMPRESS, &status);
+    }
+
+    MaRC::FITS::throw_on_error(status);
+
     return std::make_unique<MaRC::FITS::image>(this->fptr_,
                                                bitpix,
                                                samples,
@@ -344,43 +408,73 @@ MaRC::FITS::output_file::make_image(int bitpix,
 
 MaRC::FITS::input_file::input_file(char const * filename)
     : file(filename, false)
+    , filename_(filename)
+    , plane_(1)
 {
-    // Verify checksums if present.
-    int dataok = 0;
-    int hduok  = 0;
+    this->verify_checksum();
+}
+
+void
+MaRC::FITS::input_file::hdu(int number)
+{
+    int hdutype = 0;
     int status = 0;
 
-    if (fits_verify_chksum(this->fptr_.get(),
-                           &dataok,
-                           &hduok,
-                           &status) != 0) {
-        if (dataok == -1)  // Incorrect data checksum
-            MaRC::warn("Data checksum for FITS file \"{}\" "
-                       "is incorrect",
-                       filename);
+    // CFITSIO HDU numbers start at one, i.e. the primary HDU.
+    fits_movabs_hdu(this->fptr_.get(), number + 1, &hdutype, &status);
 
-        if (hduok == -1)
-            MaRC::warn("Header checksum for FITS file \"{}\" "
-                       "is incorrect",
-                       filename);
-    }
+    if (status == 0 && hdutype != IMAGE_HDU)
+        throw std::runtime_error(
+            fmt::format("HDU {} in FITS file \"{}\" is not an image.",
+                        number,
+                        this->filename_));
+
+    throw_on_error(status);
+
+    this->verify_checksum();
 }
 
 void
-MaRC::FITS::input_file::read(std::vector<double> & image,
-                             std::size_t & samples,
-                             std::size_t & lines) const
+MaRC::FITS::input_file::hdu(std::string const & extname)
+{
+    static constexpr int extver = 0;  // Ignore EXTVER.
+
+    int status = 0;
+
+    fits_movnam_hdu(this->fptr_.get(),
+                    IMAGE_HDU,
+                    const_cast<char *>(extname.c_str()),
+                    extver,
+                    &status);
+
+    throw_on_error(status);
+
+    this->verify_checksum();
+}
+
+void
+MaRC::FITS::input_file::plane(std::size_t number)
+{
+    if (number == 0)
+        throw std::invalid_argument("FITS image planes start at one.");
+
+    this->plane_ = number;
+}
+
+void
+MaRC::FITS::input_file::dimensions(std::size_t & samples,
+                                   std::size_t & lines) const
 {
     // Get the image parameters.
 
     /**
-     * @note Only two-dimensional %FITS images are currently
-     *       supported.
+     * @note Only two-dimensional %FITS images, or planes in a
+     *       three-dimensional image cube, are currently supported.
      */
-    using naxes_array_type = std::array<LONGLONG, 2>;
+    using naxes_array_type = std::array<LONGLONG, 3>;
 
     /// Array containing %FITS image dimensions.
-    naxes_array_type naxes;
+    naxes_array_type naxes{ 0, 0, 1 };
 
     int naxis = 0;
     int bitpix = 0;
@@ -395,37 +489,140 @@ MaRC::FITS::input_file::read(std::vector<double> & image,
         throw_on_error(status);
 
     // Sanity checks.
-    if (naxis < static_cast<int>(naxes.size()))
+    if (naxis < 2)
         throw std::runtime_error("too few dimensions in FITS image");
 
+    if (naxis < 3)
+        naxes[2] = 1;  // Two-dimensional image, i.e. a single plane.
+
+    if (static_cast<LONGLONG>(this->plane_) > naxes[2])
+        throw std::runtime_error(
+            fmt::format("FITS image \"{}\" has no plane {}.",
+                        this->filename_,
+                        this->plane_));
+
     // Smallest image size MaRC will accept is 2x2.  Even that is too
     // small, but let's not be too picky.
     constexpr naxes_array_type::value_type mindim = 2;
     if (naxes[0] < mindim || naxes[1] < mindim)
         throw std::runtime_error("image dimension is too small");
 
-    // CFITSIO wants its own LONGLONG type, not size_t.
-    LONGLONG const nelements = naxes[0] * naxes[1];
+    samples = static_cast<std::size_t>(naxes[0]);
+    lines   = static_cast<std::size_t>(naxes[1]);
+}
+
+std::size_t
+MaRC::FITS::input_file::planes() const
+{
+    std::array<LONGLONG, 3> naxes{ 0, 0, 1 };
+
+    int naxis = 0;
+    int bitpix = 0;
+    int status = 0;
 
-    using image_type = std::remove_reference_t<decltype(image)>;
+    if (fits_get_img_paramll(this->fptr_.get(),
+                             naxes.size(),
+                             &bitpix,
+                             &naxis,
+                             naxes.data(),
+                             &status) != 0)
+        throw_on_error(status);
+
+    return (naxis < 3 ? 1 : static_cast<std::size_t>(naxes[2]));
+}
+
+void
+MaRC::FITS::input_file::read(std::vector<double> & image,
+                             std::size_t left,
+                             std::size_t top,
+                             std::size_t samples,
+                             std::size_t lines) const
+{
+    constexpr std::size_t count = 1;  // Only the selected plane.
+
+    std::vector<std::vector<double>> bands;
+
+    this->read(bands, left, top, samples, lines, count);
+
+    image = std::move(bands.front());
+}
+
+void
+MaRC::FITS::input_file::read(std::vector<std::vector<double>> & bands,
+                             std::size_t left,
+                             std::size_t top,
+                             std::size_t samples,
+                             std::size_t lines,
+                             std::size_t count) const
+{
+    std::size_t image_samples = 0;
+    std::size_t image_lines   = 0;
+
+    this->dimensions(image_samples, image_lines);
+
+    if (samples == 0 || lines == 0
+        || left >= image_samples || samples > image_samples - left
+        || top  >= image_lines   || lines   > image_lines   - top)
+        throw std::runtime_error(
+            fmt::format("Region ({}, {}) {}x{} is not within "
+                        "{}x{} FITS image \"{}\".",
+                        left,
+                        top,
+                        samples,
+                        lines,
+                        image_samples,
+                        image_lines,
+                        this->filename_));
+
+    // The selected plane is the first one read.
+    std::size_t const last_plane = this->plane_ + count - 1;
+
+    if (count == 0 || last_plane > this->planes())
+        throw std::runtime_error(
+            fmt::format("FITS image \"{}\" has no planes {} "
+                        "through {}.",
+                        this->filename_,
+                        this->plane_,
+                        last_plane));
+
+    int naxis = 0;
+    int status = 0;
+
+    if (fits_get_img_dim(this->fptr_.get(), &naxis, &status) != 0)
+        throw_on_error(status);
+
+    /*
+      First and last pixels (inclusive) in the region to be read
+      along each image axis, including the planes along the third
+      axis.  Only the first element along any additional axes
+      is read.
+
+      @attention First pixel in CFITSIO is {1, 1} not {0, 0}.
+    */
+    std::vector<long> fpixel(naxis, 1);
+    std::vector<long> lpixel(naxis, 1);
+    std::vector<long> inc(naxis, 1);
+
+    fpixel[0] = static_cast<long>(left + 1);
+    lpixel[0] = static_cast<long>(left + samples);
+    fpixel[1] = static_cast<long>(top + 1);
+    lpixel[1] = static_cast<long>(top + lines);
+
+    if (naxis > 2) {
+        fpixel[2] = static_cast<long>(this->plane_);
+        lpixel[2] = static_cast<long>(last_plane);
+    }
+
+    using image_type = std::vector<double>;
     using value_type = image_type::value_type;
 
     constexpr auto nan =
         std::numeric_limits<value_type>::signaling_NaN();
 
-    /**
-     * @todo Should we bother initializing the image vector with NaN?
-     *       CFITSIO will just overwrite each element regardless,
-     *       right?
-     */
-    image_type tmp(nelements, nan);
+    // Number of elements in the region of each plane.
+    std::size_t const size = samples * lines;
 
-    /**
-     * First pixel to be read.
-     *
-     * @attention First pixel in CFITSIO is {1, 1} not {0, 0}.
-     */
-    LONGLONG fpixel[] = {1, 1};
+    image_type tmp(size * count);
 
     // For integer typed FITS images with a BLANK value, set the
     // "blank" value in our floating point converted copy of the image
@@ -436,17 +633,73 @@ MaRC::FITS::input_file::read(std::vector<double> & image,
     static_assert(std::is_same<value_type, decltype(nulval)>(),
                   "Nul value type doesn't match photo container type.");
 
-    if (fits_read_pixll(this->fptr_.get(),
-                        traits<value_type>::datatype,
-                        fpixel,
-                        nelements,
-                        &nulval,  // "Blank" value in our image.
-                        tmp.data(),
-                        &anynul,  // Were any blank values found?
-                        &status) != 0)
+    if (fits_read_subset(this->fptr_.get(),
+                         traits<value_type>::datatype,
+                         fpixel.data(),
+                         lpixel.data(),
+                         inc.data(),
+                         &nulval,  // "Blank" value in our image.
+                         tmp.data(),
+                         &anynul,  // Were any blank values found?
+                         &status) != 0)
         throw_on_error(status);
 
-    image   = std::move(tmp);
-    samples = static_cast<std::size_t>(naxes[0]);
-    lines   = static_cast<std::size_t>(naxes[1]);
+    // Split the planes read from the image cube into separate bands.
+    std::vector<image_type> b(count);
+
+    if (count == 1) {
+        b.front() = std::move(tmp);
+    } else {
+        auto first = tmp.cbegin();
+
+        for (auto & band : b) {
+            band.assign(first, first + size);
+            first += size;
+        }
+    }
+
+    bands = std::move(b);
+}
+
+void
+MaRC::FITS::input_file::read(std::vector<double> & image,
+                             std::size_t & samples,
+                             std::size_t & lines) const
+{
+    std::size_t s = 0;
+    std::size_t l = 0;
+
+    this->dimensions(s, l);
+
+    constexpr std::size_t left = 0;
+    constexpr std::size_t top  = 0;
+
+    this->read(image, left, top, s, l);
+
+    samples = s;
+    lines   = l;
+}
+
+void
+MaRC::FITS::input_file::verify_checksum() const
+{
+    // Verify checksums if present.
+    int dataok = 0;
+    int hduok  = 0;
+    int status = 0;
+
+    if (fits_verify_chksum(this->fptr_.get(),
+                           &dataok,
+                           &hduok,
+                           &status) != 0) {
+        if (dataok == -1)  // Incorrect data checksum
+            MaRC::warn("Data checksum for FITS file \"{}\" "
+                       "is incorrect",
+                       this->filename_);
+
+        if (hduok == -1)
+            MaRC::warn("Header checksum for FITS file \"{}\" "
+                       "is incorrect",
+                       this->filename_);
+    }
 }
@@ -38,6 +38,56 @@ namespace MaRC
          */
         void throw_on_error(int status);
 
+        /**
+         * @brief Can CFITSIO be used from multiple threads?
+         *
+         * CFITSIO may only be used concurrently from multiple
+         * threads, each with its own @c fitsfile, if it was built
+         * with thread support.
+         *
+         * @return @c true if CFITSIO is thread-safe, and @c false
+         *         otherwise.
+         */
+        bool is_reentrant();
+
+        /**
+         * @struct compression_parameters
+         *
+         * @brief %FITS image tile compression parameters.
+         *
+         * Integer images are compressed with the Rice algorithm,
+         * except for 64 bit integer images which Rice does not
+         * support, and floating point images with GZIP.  CFITSIO
+         * records the compression parameters in the compressed image
+         * header, e.g. @c ZCMPTYPE, @c ZTILEn and @c ZQUANTIZ.
+         */
+        struct compression_parameters
+        {
+            /// Are images compressed?
+            bool enabled = false;
+
+            /**
+             * @brief Number of samples in each tile.
+             *
+             * A value of zero corresponds to the image width.
+             */
+            long tile_samples = 0;
+
+            /// Number of lines in each tile.
+            long tile_lines = 1;
+
+            /**
+             * @brief Floating point quantization level.
+             *
+             * Floating point images are losslessly compressed if
+             * zero.  Otherwise, positive values are quantization
+             * levels relative to the image noise, and negative
+             * values are absolute quantization levels, as described
+             * in the CFITSIO documentation.
+             */
+            float quantize = 0;
+        };
+
         /**
          * @class file
          *
@@ -271,6 +321,15 @@ namespace MaRC
             /// Destructor
             ~output_file() = default;
 
+            /**
+             * @brief Set tile compression parameters.
+             *
+             * @param[in] c Tile compression parameters applied to
+             *              images subsequently created by
+             *              @c make_image().
+             */
+            void compression(compression_parameters const & c);
+
             /**
              * @brief Create a %FITS image array HDU.
              *
@@ -300,6 +359,11 @@ namespace MaRC
                 size_t planes,
                 char const * extname = nullptr);
 
+        private:
+
+            /// Image tile compression parameters.
+            compression_parameters compression_;
+
         };
 
         // -------------------------------------------------------
@@ -330,6 +394,129 @@ namespace MaRC
             /// Destructor
             ~input_file() = default;
 
+            /**
+             * @brief Select the image HDU by number.
+             *
+             * @param[in] number HDU number, where zero corresponds
+             *                   to the primary HDU, one to the first
+             *                   extension, etc.
+             *
+             * @throw std::runtime_error No such image HDU.
+             */
+            void hdu(int number);
+
+            /**
+             * @brief Select the image HDU by extension name.
+             *
+             * @param[in] extname Value of the %FITS @c EXTNAME
+             *                    keyword in the image extension.
+             *
+             * @throw std::runtime_error No such image extension.
+             */
+            void hdu(std::string const & extname);
+
+            /**
+             * @brief Select the image plane to be read.
+             *
+             * @param[in] number Plane number in an image cube,
+             *                   starting at one.  Only the first
+             *                   plane is read by default.
+             *
+             * @throw std::invalid_argument @a number is zero.
+             */
+            void plane(std::size_t number);
+
+            /**
+             * @brief Get the dimensions of the selected image plane.
+             *
+             * @param[out] samples The number of columns in the %FITS
+             *                     image.
+             * @param[out] lines   The number of rows in the %FITS
+             *                     image.
+             *
+             * @throw std::runtime_error The selected image HDU is
+             *                           not a suitable image, or
+             *                           doesn't contain the
+             *                           selected plane.
+             */
+            void dimensions(std::size_t & samples,
+                            std::size_t & lines) const;
+
+            /**
+             * @brief Get the number of planes in the image.
+             *
+             * @return Number of planes in a three-dimensional image
+             *         cube, or one for a two-dimensional image.
+             *
+             * @throw std::runtime_error Error reading image
+             *                           parameters.
+             */
+            std::size_t planes() const;
+
+            /**
+             * @brief Read a region of the %FITS image into the given
+             *        @c vector.
+             *
+             * Only the given region of the selected image plane is
+             * read from the %FITS file, i.e. the half-open intervals
+             * [@a left, @a left + @a samples) and [@a top, @a top +
+             * @a lines), where @a top corresponds to the first
+             * image row in the %FITS file.
+             *
+             * @param[out] img     Vector that will contain the read
+             *                     %FITS image data, with @a samples
+             *                     elements per line.
+             * @param[in]  left    First column (zero-based) in the
+             *                     region.
+             * @param[in]  top     First row (zero-based) in the
+             *                     region.
+             * @param[in]  samples The number of columns in the
+             *                     region.
+             * @param[in]  lines   The number of rows in the region.
+             *
+             * @throw std::runtime_error Error reading image from
+             *                           %FITS file, or region is
+             *                           not within the image.
+             */
+            void read(std::vector<double> & img,
+                      std::size_t left,
+                      std::size_t top,
+                      std::size_t samples,
+                      std::size_t lines) const;
+
+            /**
+             * @brief Read a region of consecutive image planes.
+             *
+             * Read the same region of @a count consecutive planes,
+             * beginning with the selected plane, in a single pass
+             * over the %FITS image cube.
+             *
+             * @param[out] bands   Vector that will contain @a count
+             *                     vectors, one per plane, each with
+             *                     the read region of that plane.
+             * @param[in]  left    First column (zero-based) in the
+             *                     region.
+             * @param[in]  top     First row (zero-based) in the
+             *                     region.
+             * @param[in]  samples The number of columns in the
+             *                     region.
+             * @param[in]  lines   The number of rows in the region.
+             * @param[in]  count   The number of planes to read.
+             *
+             * @throw std::runtime_error Error reading image from
+             *                           %FITS file, or region is
+             *                           not within the image cube.
+             *
+             * @see read(std::vector<double> &, std::size_t,
+             *           std::size_t, std::size_t, std::size_t) const
+             */
+            void read(std::vector<std::vector<double>> & bands,
+                      std::size_t left,
+                      std::size_t top,
+                      std::size_t samples,
+                      std::size_t lines,
+                      std::size_t count) const;
+
             /**
              * @brief Read the %FITS image into the given @c vector.
              *
@@ -357,6 +544,19 @@ namespace MaRC
                       std::size_t & samples,
                       std::size_t & lines) const;
 
+        private:
+
+            /// Warn if the current HDU checksums are incorrect.
+            void verify_checksum() const;
+
+        private:
+
+            /// Name of the %FITS file.
+            std::string const filename_;
+
+            /// Image plane to be read, starting at one.
+            std::size_t plane_;
+
         };
 
     }  // FITS
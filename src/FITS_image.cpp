@@ -9,9 +9,85 @@
  */
 
 #include "FITS_image.h"
+#include "strerror.h"
 
+#include <marc/Log.h>
+#include <marc/config.h>  // For WORDS_BIGENDIAN.
+
+#include <algorithm>
+#include <vector>
+#include <stdexcept>
 #include <cmath>
 #include <cstring>
+#include <cerrno>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+
+namespace
+{
+    /**
+     * @brief Size of image bands written directly into the %FITS
+     *        data unit, in bytes.
+     */
+    constexpr std::size_t band_bytes = 1 << 22;  // 4 MiB
+
+    /**
+     * @brief Convert image data to the big-endian %FITS
+     *        representation.
+     *
+     * @tparam     N     Size of each element in bytes.
+     * @param[in]  src   Native image data.
+     * @param[out] dst   Big-endian image data.
+     * @param[in]  count Number of elements.
+     */
+    template <std::size_t N>
+    void to_big_endian(unsigned char const * src,
+                       unsigned char * dst,
+                       std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i, src += N, dst += N)
+            for (std::size_t b = 0; b < N; ++b)
+                dst[b] = src[N - 1 - b];
+    }
+
+    /**
+     * @brief Write a block of bytes to the given file offset.
+     *
+     * @param[in] fd     File descriptor.
+     * @param[in] buf    Bytes to be written.
+     * @param[in] count  Number of bytes to be written.
+     * @param[in] offset Offset in file at which the bytes will be
+     *                   written.
+     *
+     * @throw std::runtime_error Write failed.
+     */
+    void write_block(int fd,
+                     unsigned char const * buf,
+                     std::size_t count,
+                     off_t offset)
+    {
+        while (count > 0) {
+            auto const n = ::pwrite(fd, buf, count, offset);
+
+            if (n == -1) {
+                if (errno == EINTR)
+                    continue;
+
+                char err[128];
+                throw std::runtime_error(
+                    MaRC::strerror(errno, err, sizeof(err)));
+            }
+
+            buf    += n;
+            count  -= n;
+            offset += n;
+        }
+    }
+}
 
 
 MaRC::FITS::image::image(MaRC::FITS::file::shared_ptr fptr,
@@ -24,6 +100,8 @@ MaRC::FITS::image::image(MaRC::FITS::file::shared_ptr fptr,
     , fpixel_(1)  // CFITSIO first pixel is 1, not 0.
     , nelements_(samples * lines)
     , max_elements_(nelements_ * planes)
+    , scaled_(false)
+    , reserved_(false)
 {
     int const naxis =
         (planes > 1
@@ -112,22 +190,28 @@ MaRC::FITS::image::author(std::string const & a)
 void
 MaRC::FITS::image::bzero(double zero)
 {
-    if (!std::isnan(zero))
+    if (!std::isnan(zero)) {
         this->update_fits_key(this->fptr_.get(),
                               "BZERO",
                               zero,
                               "physical value corresponding to "
                               "zero in the map");
+
+        this->scaled_ = this->scaled_ || zero != 0;
+    }
 }
 
 void
 MaRC::FITS::image::bscale(double scale)
 {
-    if (!std::isnan(scale))
+    if (!std::isnan(scale)) {
         this->update_fits_key(this->fptr_.get(),
                               "BSCALE",
                               scale,
                               "linear data scaling coefficient");
+
+        this->scaled_ = this->scaled_ || scale != 1;
+    }
 }
 
 void
@@ -185,6 +269,9 @@ MaRC::FITS::image::internal_scale(double scale, double offset)
     fits_set_bscale(this->fptr_.get(), scale, offset, &status);
 
     MaRC::FITS::throw_on_error(status);
+
+    // The internal scaling factors override BSCALE and BZERO.
+    this->scaled_ = (scale != 1 || offset != 0);
 }
 
 void
@@ -226,3 +313,156 @@ MaRC::FITS::image::update_fits_key(fitsfile * fptr,
 
     MaRC::FITS::throw_on_error(status);
 }
+
+bool
+MaRC::FITS::image::writable(std::size_t size) const
+{
+    if (this->fpixel_>= this->max_elements_) {
+        MaRC::error("FITS image array is already fully written.");
+
+        return false;
+    } else if(static_cast<LONGLONG>(size) != this->nelements_) {
+        MaRC::error("FITS image and data array sizes, "
+                    "{} and {}, do not match.",
+                    this->nelements_, size);
+
+        return false;
+    }
+
+    return true;
+}
+
+bool
+MaRC::FITS::image::write_direct(void const * data,
+                                int bitpix,
+                                std::size_t size,
+                                MaRC::thread_pool & pool)
+{
+    fitsfile * const fptr = this->fptr_.get();
+
+    int status = 0;
+
+    /*
+      The data may only be written directly if it differs from its
+      FITS representation by byte order alone.
+    */
+    int img_type = 0;
+    fits_get_img_type(fptr, &img_type, &status);
+
+    if (status != 0
+        || img_type != bitpix
+        || this->scaled_
+        || fits_is_compressed_image(fptr, &status)) {
+        fits_clear_errmsg();
+        return false;
+    }
+
+    /*
+      Extend the FITS file over the entire data unit by writing its
+      last element so that all planes may be written in place.
+    */
+    if (!this->reserved_) {
+        unsigned char zero = 0;
+        fits_write_img(fptr, TBYTE, this->max_elements_, 1, &zero, &status);
+
+        if (status != 0) {
+            fits_clear_errmsg();
+            return false;
+        }
+
+        this->reserved_ = true;
+    }
+
+    /*
+      Write and discard data buffered by CFITSIO so that it neither
+      overwrites nor masks the data written below.  The data unit may
+      also have been moved by header keywords written since the last
+      plane, so retrieve its current location.
+    */
+    LONGLONG headstart = 0;
+    LONGLONG datastart = 0;
+    LONGLONG dataend   = 0;
+    char filename[FLEN_FILENAME] = { 0 };
+
+    fits_flush_buffer(fptr, 1, &status);
+    fits_get_hduaddrll(fptr, &headstart, &datastart, &dataend, &status);
+    fits_file_name(fptr, filename, &status);
+
+    if (status != 0) {
+        fits_clear_errmsg();
+        return false;
+    }
+
+    // Leading '!' in the file name requests that it be overwritten.
+    char const * const path =
+        (filename[0] == '!' ? filename + 1 : filename);
+
+    std::size_t const total = this->nelements_ * size;
+    off_t const start = datastart + (this->fpixel_ - 1) * size;
+
+    // Only regular files already extended over the data unit are
+    // written directly, e.g. not compressed or in-memory files.
+    struct stat st;
+    if (::stat(path, &st) != 0
+        || !S_ISREG(st.st_mode)
+        || st.st_size < static_cast<off_t>(start + total))
+        return false;
+
+    int const fd = ::open(path, O_WRONLY);
+    if (fd == -1)
+        return false;
+
+    auto const bytes = static_cast<unsigned char const *>(data);
+    std::size_t const band_size = band_bytes - band_bytes % size;
+    std::size_t const bands = (total + band_size - 1) / band_size;
+
+    bool written = true;
+
+    try {
+        pool.run(bands,
+                 [=](std::size_t i)
+                 {
+                     std::size_t const offset = i * band_size;
+                     std::size_t const count =
+                         std::min(band_size, total - offset);
+
+                     auto const src = bytes + offset;
+
+#ifndef WORDS_BIGENDIAN
+                     if (size > 1) {
+                         std::vector<unsigned char> band(count);
+                         auto const dst = band.data();
+                         auto const n = count / size;
+
+                         switch (size) {
+                         case 2: to_big_endian<2>(src, dst, n); break;
+                         case 4: to_big_endian<4>(src, dst, n); break;
+                         case 8: to_big_endian<8>(src, dst, n); break;
+                         default:
+                             throw std::invalid_argument(
+                                 "Unsupported FITS data element size.");
+                         }
+
+                         write_block(fd, dst, count, start + offset);
+
+                         return;
+                     }
+#endif  /* !WORDS_BIGENDIAN */
+
+                     // Native and FITS byte orders are the same.
+                     write_block(fd, src, count, start + offset);
+                 });
+    } catch (std::exception const & e) {
+        MaRC::warn("Unable to write directly to FITS file "
+                   "\"{}\": {}",
+                   path,
+                   e.what());
+
+        written = false;
+    }
+
+    if (::close(fd) != 0)
+        written = false;
+
+    return written;
+}
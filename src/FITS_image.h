@@ -13,6 +13,7 @@
 #define MARC_FITS_IMAGE_H
 
 #include "FITS_file.h"
+#include "thread_pool.h"
 
 #include <fitsio.h>
 
@@ -226,6 +227,64 @@ namespace MaRC
             template <typename T>
             bool write(T const & img);
 
+            /**
+             * @brief Write the image into the %FITS file concurrently.
+             *
+             * Split the image into bands that are converted to the
+             * big-endian %FITS representation and written directly
+             * to their offsets in the %FITS data unit by the threads
+             * in the given @a pool, bypassing CFITSIO.  The checksum
+             * and other keywords are still written by CFITSIO once
+             * the data is in place.
+             *
+             * The image is written through CFITSIO instead, as in
+             * @c write(T const &), if the data unit cannot be
+             * written directly, such as when the %FITS file is
+             * compressed or not a regular file, or when the data
+             * must be scaled.
+             *
+             * @tparam    T    Image/data container type.
+             * @param[in] img  Array or vector containing the image
+             *                 data to be written to the %FITS file.
+             * @param[in] pool Threads writing the image bands.
+             *
+             * @return @c true on success, and @c false otherwise.
+             */
+            template <typename T>
+            bool write(T const & img, thread_pool & pool);
+
+        private:
+
+            /**
+             * @brief Can an image of the given size be written?
+             *
+             * @param[in] size Number of elements in the image.
+             *
+             * @return @c true if there is room for the image in the
+             *         %FITS image array, and @c false otherwise.
+             */
+            bool writable(std::size_t size) const;
+
+            /**
+             * @brief Write an image plane directly into the %FITS
+             *        data unit.
+             *
+             * @param[in] data   Image plane data.
+             * @param[in] bitpix %FITS bits per pixel value
+             *                   corresponding to the @a data type.
+             * @param[in] size   Size of each @a data element in
+             *                   bytes.
+             * @param[in] pool   Threads writing the image bands.
+             *
+             * @return @c true if the image plane was written, and
+             *         @c false if it should be written through
+             *         CFITSIO instead.
+             */
+            bool write_direct(void const * data,
+                              int bitpix,
+                              std::size_t size,
+                              thread_pool & pool);
+
         private:
 
             /**
@@ -301,6 +360,15 @@ namespace MaRC
             /// Maximum number of elements in the %FITS image.
             LONGLONG const max_elements_;
 
+            /// Is the data scaled by CFITSIO when written?
+            bool scaled_;
+
+            /**
+             * @brief Has space for the entire data unit been
+             *        allocated in the %FITS file?
+             */
+            bool reserved_;
+
         };
 
     }  // FITS
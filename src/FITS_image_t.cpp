@@ -91,18 +91,8 @@ template <typename T>
 bool
 MaRC::FITS::image::write(T const & img)
 {
-    if (this->fpixel_>= this->max_elements_) {
-        MaRC::error("FITS image array is already fully written.");
-
-        return false;
-    } else if(static_cast<LONGLONG>(std::size(img))
-              != this->nelements_) {
-        MaRC::error("FITS image and data array sizes, "
-                    "{} and {}, do not match.",
-                    this->nelements_, std::size(img));
-
+    if (!this->writable(std::size(img)))
         return false;
-    }
 
     int status = 0;
 
@@ -149,5 +139,30 @@ MaRC::FITS::image::write(T const & img)
     return true;
 }
 
+template <typename T>
+bool
+MaRC::FITS::image::write(T const & img, thread_pool & pool)
+{
+    if (!this->writable(std::size(img)))
+        return false;
+
+    auto data = std::data(img);
+
+    using data_type =
+        typename std::remove_const<
+            typename std::remove_pointer<decltype(data)>::type>::type;
+
+    if (!this->write_direct(data,
+                            FITS::traits<data_type>::bitpix,
+                            sizeof(data_type),
+                            pool))
+        return this->write(img);  // Fall back on CFITSIO.
+
+    // Set offset in the FITS array to the next plane.
+    this->fpixel_ += this->nelements_;
+
+    return true;
+}
+
 
 #endif  /* MARC_FITS_IMAGE_T_CPP */
@@ -0,0 +1,153 @@
+/**
+ * @file FITS_writer.cpp
+ *
+ * Copyright (C) 2026  Ossama Othman
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * @author Ossama Othman
+ */
+
+#include "FITS_writer.h"
+
+#include <stdexcept>
+
+
+MaRC::FITS::writer::writer(std::size_t depth, bool threaded)
+    : depth_(depth)
+    , jobs_()
+    , lock_()
+    , queued_()
+    , completed_()
+    , busy_(false)
+    , done_(false)
+    , error_()
+    , thread_()
+{
+    if (depth == 0)
+        throw std::invalid_argument("FITS writer queue depth is zero.");
+
+    // Start the thread last so that all members are initialized
+    // before it runs.
+    if (threaded)
+        this->thread_ = std::thread(&writer::run, this);
+}
+
+MaRC::FITS::writer::~writer()
+{
+    if (!this->thread_.joinable())
+        return;  // Jobs were run synchronously.
+
+    {
+        std::lock_guard<std::mutex> guard(this->lock_);
+        this->done_ = true;
+    }
+
+    this->queued_.notify_one();
+
+    // Remaining jobs are run before the thread exits.
+    this->thread_.join();
+}
+
+void
+MaRC::FITS::writer::submit(job_type job)
+{
+    if (!this->thread_.joinable()) {
+        job();  // No writer thread.  Run the job now.
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> guard(this->lock_);
+
+        this->completed_.wait(guard,
+                              [this]()
+                              {
+                                  return
+                                      this->jobs_.size() < this->depth_;
+                              });
+
+        this->rethrow();
+
+        this->jobs_.push_back(std::move(job));
+    }
+
+    this->queued_.notify_one();
+}
+
+void
+MaRC::FITS::writer::wait()
+{
+    std::unique_lock<std::mutex> guard(this->lock_);
+
+    this->completed_.wait(guard,
+                          [this]()
+                          {
+                              return this->jobs_.empty() && !this->busy_;
+                          });
+
+    this->rethrow();
+}
+
+void
+MaRC::FITS::writer::run()
+{
+    std::unique_lock<std::mutex> guard(this->lock_);
+
+    for (;;) {
+        this->queued_.wait(guard,
+                           [this]()
+                           {
+                               return !this->jobs_.empty() || this->done_;
+                           });
+
+        if (this->jobs_.empty())
+            break;  // Shut down, and no more jobs to run.
+
+        job_type job(std::move(this->jobs_.front()));
+        this->jobs_.pop_front();
+        this->busy_ = true;
+
+        guard.unlock();
+
+        std::exception_ptr error;
+
+        try {
+            job();
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        /*
+          Release resources held by the job, such as a map plane
+          buffer or a FITS image, on this thread before reporting
+          completion.
+        */
+        job = nullptr;
+
+        guard.lock();
+
+        /*
+          Keep running subsequent jobs after a failure, since they
+          may be responsible for returning resources to other
+          threads.  Only the first error is reported.
+        */
+        if (error && !this->error_)
+            this->error_ = error;
+
+        this->busy_ = false;
+
+        this->completed_.notify_all();
+    }
+}
+
+void
+MaRC::FITS::writer::rethrow()
+{
+    if (this->error_) {
+        std::exception_ptr error;
+        std::swap(error, this->error_);
+
+        std::rethrow_exception(error);
+    }
+}
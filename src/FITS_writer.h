@@ -0,0 +1,271 @@
+// -*- C++ -*-
+/**
+ * @file FITS_writer.h
+ *
+ * Copyright (C) 2026  Ossama Othman
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * @author Ossama Othman
+ */
+
+#ifndef MARC_FITS_WRITER_H
+#define MARC_FITS_WRITER_H
+
+#include <vector>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <exception>
+#include <memory>
+#include <cstddef>
+
+
+namespace MaRC
+{
+    namespace FITS
+    {
+
+        /**
+         * @class writer
+         *
+         * @brief Perform %FITS file operations on a dedicated thread.
+         *
+         * CFITSIO serializes all operations on a given @c fitsfile,
+         * and writing a map plane (including the checksum and any
+         * compression work) may take a significant amount of time.
+         * This class moves that work off the mapping thread so that
+         * plane @c N+1 may be mapped while plane @c N is being
+         * written.
+         *
+         * Jobs are run in the order they were submitted.  Once a job
+         * touching a given %FITS file has been submitted, all
+         * subsequent operations on that file must also be submitted
+         * to the writer to preserve that ordering.
+         *
+         * The job queue is bounded.  @c submit() blocks the caller
+         * when the queue is full, which in turn bounds the number of
+         * completed map planes awaiting a write.
+         *
+         * Jobs may also be run synchronously on the submitting
+         * thread, such as when CFITSIO is not thread-safe.
+         */
+        class writer
+        {
+        public:
+
+            /// Type of job run on the writer thread.
+            using job_type = std::function<void()>;
+
+            /// Constructor.
+            /**
+             * @param[in] depth    Maximum number of queued jobs.
+             * @param[in] threaded Run jobs on a dedicated thread if
+             *                     @c true.  Otherwise run them on
+             *                     the thread calling @c submit().
+             *
+             * @throw std::invalid_argument @a depth is zero.
+             */
+            explicit writer(std::size_t depth = 2, bool threaded = true);
+
+            // Disallow copying.
+            writer(writer const &) = delete;
+            writer & operator=(writer const &) = delete;
+
+            /**
+             * @brief Destructor.
+             *
+             * Run remaining jobs, and join the writer thread.
+             */
+            ~writer();
+
+            /**
+             * @brief Queue a job to be run on the writer thread.
+             *
+             * @param[in] job Job to be run.
+             *
+             * @throw Rethrows the exception thrown by a previously
+             *        run job, if any.
+             */
+            void submit(job_type job);
+
+            /**
+             * @brief Wait for all queued jobs to complete.
+             *
+             * @throw Rethrows the exception thrown by a previously
+             *        run job, if any.
+             */
+            void wait();
+
+        private:
+
+            /// Writer thread entry point.
+            void run();
+
+            /// Rethrow a pending job exception, if any.
+            /**
+             * @note @c lock_ must be held by the caller.
+             */
+            void rethrow();
+
+        private:
+
+            /// Maximum number of queued jobs.
+            std::size_t const depth_;
+
+            /// Queue of jobs awaiting execution.
+            std::deque<job_type> jobs_;
+
+            /// Lock synchronizing access to the job queue.
+            std::mutex lock_;
+
+            /// Signaled when a job has been queued.
+            std::condition_variable queued_;
+
+            /// Signaled when a job has completed.
+            std::condition_variable completed_;
+
+            /// Is a job currently running?
+            bool busy_;
+
+            /// Has the writer been shut down?
+            bool done_;
+
+            /// Exception thrown by a job.
+            std::exception_ptr error_;
+
+            /// The writer thread.
+            std::thread thread_;
+
+        };
+
+        /**
+         * @class buffer_pool
+         *
+         * @brief Bounded pool of reusable image buffers.
+         *
+         * Map planes are handed to a @c writer in a buffer obtained
+         * from this pool.  The buffer is returned to the pool once
+         * the last handle to it is released, typically when the
+         * writer job that wrote the plane is destroyed, even if the
+         * write failed.  The mapper then reuses it for a subsequent
+         * plane rather than allocating a new one.  At most
+         * @c capacity buffers exist at any given time so
+         * @c acquire() blocks until one has been returned if all of
+         * them are in use.
+         *
+         * @note Buffer handles refer back to the pool, so the pool
+         *       must be managed by a @c std::shared_ptr.
+         *
+         * @tparam T Buffer element type.
+         */
+        template <typename T>
+        class buffer_pool
+            : public std::enable_shared_from_this<buffer_pool<T>>
+        {
+        public:
+
+            /// Pooled buffer type.
+            using buffer_type = std::vector<T>;
+
+            /**
+             * @brief Handle to a pooled buffer.
+             *
+             * Copies of the handle share the same buffer, which is
+             * returned to the pool when the last of them is
+             * destroyed.
+             */
+            using handle_type = std::shared_ptr<buffer_type>;
+
+            /// Constructor.
+            /**
+             * @param[in] capacity Maximum number of buffers.
+             */
+            explicit buffer_pool(std::size_t capacity)
+                : capacity_(capacity)
+                , allocated_(0)
+                , buffers_()
+                , lock_()
+                , returned_()
+            {
+                // Returning a buffer to the pool must not allocate.
+                this->buffers_.reserve(capacity);
+            }
+
+            // Disallow copying.
+            buffer_pool(buffer_pool const &) = delete;
+            buffer_pool & operator=(buffer_pool const &) = delete;
+
+            /// Obtain a buffer, blocking until one is available.
+            handle_type acquire()
+            {
+                auto pool = this->shared_from_this();
+
+                std::unique_ptr<buffer_type> b;
+
+                {
+                    std::unique_lock<std::mutex> guard(this->lock_);
+
+                    if (this->buffers_.empty()
+                        && this->allocated_ < this->capacity_) {
+                        b = std::make_unique<buffer_type>();
+                        ++this->allocated_;
+                    } else {
+                        this->returned_.wait(
+                            guard,
+                            [this]()
+                            {
+                                return !this->buffers_.empty();
+                            });
+
+                        b = std::move(this->buffers_.back());
+                        this->buffers_.pop_back();
+                    }
+                }
+
+                return handle_type(b.release(),
+                                   [pool](buffer_type * p)
+                                   {
+                                       pool->release(p);
+                                   });
+            }
+
+        private:
+
+            /// Return a buffer to the pool for reuse.
+            void release(buffer_type * b)
+            {
+                {
+                    std::lock_guard<std::mutex> guard(this->lock_);
+                    this->buffers_.emplace_back(b);
+                }
+
+                this->returned_.notify_one();
+            }
+
+        private:
+
+            /// Maximum number of buffers.
+            std::size_t const capacity_;
+
+            /// Number of buffers handed out so far.
+            std::size_t allocated_;
+
+            /// Buffers available for reuse.
+            std::vector<std::unique_ptr<buffer_type>> buffers_;
+
+            /// Lock synchronizing access to the pool.
+            std::mutex lock_;
+
+            /// Signaled when a buffer has been returned.
+            std::condition_variable returned_;
+
+        };
+
+    }  // FITS
+}  // MaRC
+
+
+#endif  /* MARC_FITS_WRITER_H */
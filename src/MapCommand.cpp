@@ -1,7 +1,7 @@
 /**
  * @file MapCommand.cpp
  *
- * Copyright (C) 2004, 2017-2020, 2024  Ossama Othman
+ * Copyright (C) 2004, 2017-2020, 2024, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: GPL-2.0-or-later
  *
@@ -16,6 +16,7 @@
 #include "FITS_image.h"
 
 #include <marc/VirtualImage.h>
+#include <marc/BackplaneImage.h>
 #include <marc/Mathematics.h>
 #include <marc/Log.h>
 #include <marc/config.h>
@@ -25,6 +26,10 @@
 #include <iostream>
 #include <iomanip>
 #include <memory>
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
 #include <type_traits>  // For sanity check below.
 #include <chrono>
 #include <cassert>
@@ -69,15 +74,17 @@ MaRC::MapCommand::MapCommand(std::string filename,
                              long lines,
                              std::unique_ptr<MapFactory> factory,
                              std::unique_ptr<map_parameters> params)
-    : samples_(samples)
-    , lines_(lines)
-    , factory_(std::move(factory))
+    : outputs_()
     , image_factories_()
-    , filename_(std::move(filename))
     , lat_interval_(0)
     , lon_interval_(0)
     , transform_data_(false)
     , create_grid_(false)
+    , lookahead_(0)
+    , batch_(1)
+    , compression_()
+    , source_driven_(false)
+    , plans_()
     , parameters_(std::move(params))
 {
     // Compile-time FITS data type sanity check.
@@ -125,22 +132,60 @@ MaRC::MapCommand::MapCommand(std::string filename,
         "Underlying types do not satisfy FITS data type requirements.");
 
     assert(this->parameters_);
+
+    this->outputs_.push_back(
+        { std::move(filename), samples, lines, std::move(factory) });
 }
 
 int
 MaRC::MapCommand::execute()
 {
-    std::cout << "\nCreating map: " << this->filename_ << '\n';
+    std::cout << '\n';
+
+    for (auto const & o : this->outputs_)
+        std::cout << "Creating map: " << o.filename << '\n';
 
     // All necessary map configuration parameters should now be in
     // place.  Populate other parameters automatically, if possible.
     if (!populate_map_parameters())
         return -1;
 
-    (void) unlink(this->filename_.c_str());
+    // Create the map files.
+    std::vector<std::unique_ptr<FITS::output_file>> files;
+
+    for (auto const & o : this->outputs_) {
+        (void) unlink(o.filename.c_str());
+
+        files.push_back(
+            std::make_unique<FITS::output_file>(o.filename.c_str()));
+
+        files.back()->compression(this->compression_);
+    }
+
+    /*
+      Write to the map files on a separate thread so that mapping
+      overlaps with FITS file I/O.  All operations on the map files
+      from this point on go through the writer, which runs them on
+      this thread instead if CFITSIO is not thread-safe.  The writer
+      jobs in turn write map planes directly into the map file in
+      bands on the threads in the pool, when possible, so the pool
+      must outlive the writer.  Source images, such as the photos in
+      a mosaic, are created on the same threads.
+    */
+    thread_pool pool;
+
+    /*
+      Allow the writes of every map plane in a batch to be queued so
+      that mapping of the next batch need not wait for queue space.
+      The number of completed map planes held in memory is bounded
+      by the map plane buffer pools instead.
+    */
+    auto const queue_depth =
+        plane_buffers
+        * std::max(this->batch_planes(), std::size_t(1))
+        * this->outputs_.size();
 
-    // Create the map file.
-    FITS::output_file f(this->filename_.c_str());
+    FITS::writer writer(queue_depth, FITS::is_reentrant());
 
     /**
      * @todo Map timing should not include %FITS file operations.
@@ -150,22 +195,26 @@ MaRC::MapCommand::execute()
     // Create and write the map planes.
     switch (this->parameters_->bitpix()) {
     case BYTE_IMG:
-        this->template make_map_planes<FITS::byte_type>(f);
+        this->template make_map_planes<FITS::byte_type>(files, writer, pool);
         break;
     case SHORT_IMG:
-        this->template make_map_planes<FITS::short_type>(f);
+        this->template make_map_planes<FITS::short_type>(files, writer, pool);
         break;
     case LONG_IMG:
-        this->template make_map_planes<FITS::long_type>(f);
+        this->template make_map_planes<FITS::long_type>(files, writer, pool);
         break;
     case LONGLONG_IMG:
-        this->template make_map_planes<FITS::longlong_type>(f);
+        this->template make_map_planes<FITS::longlong_type>(files,
+                                                            writer,
+                                                            pool);
         break;
     case FLOAT_IMG:
-        this->template make_map_planes<FITS::float_type>(f);
+        this->template make_map_planes<FITS::float_type>(files, writer, pool);
         break;
     case DOUBLE_IMG:
-        this->template make_map_planes<FITS::double_type>(f);
+        this->template make_map_planes<FITS::double_type>(files,
+                                                          writer,
+                                                          pool);
         break;
     default:
         // We should never get here.
@@ -180,10 +229,15 @@ MaRC::MapCommand::execute()
     std::cout << "Completed mapping data in " << seconds.count()
               << " seconds.\n";
 
-    // Write the map grid if requested.
-    this->write_grid(f);
+    // Write the map grids if requested.
+    for (std::size_t i = 0; i < files.size(); ++i)
+        this->write_grid(this->outputs_[i], *files[i], writer, pool);
 
-    std::cout << "Created map: " << this->filename_ << '\n';
+    // Wait for all map file writes to complete.
+    writer.wait();
+
+    for (auto const & o : this->outputs_)
+        std::cout << "Created map: " << o.filename << '\n';
 
     return 0;
 }
@@ -191,63 +245,61 @@ MaRC::MapCommand::execute()
 char const *
 MaRC::MapCommand::projection_name() const
 {
-    return this->factory_->projection_name();
+    return this->outputs_.front().factory->projection_name();
+}
+
+void
+MaRC::MapCommand::add_output(output o)
+{
+    if (!o.factory)
+        throw std::invalid_argument("No map factory for map output.");
+
+    auto const same_file =
+        [&o](output const & other)
+        {
+            return other.filename == o.filename;
+        };
+
+    if (std::any_of(this->outputs_.cbegin(),
+                    this->outputs_.cend(),
+                    same_file)) {
+        auto const s =
+            fmt::format("Map file \"{}\" specified more than once.",
+                        o.filename);
+
+        throw std::invalid_argument(s);
+    }
+
+    this->outputs_.push_back(std::move(o));
 }
 
 MaRC::MapCommand::grid_type
-MaRC::MapCommand::make_grid(long samples,
-                            long lines,
+MaRC::MapCommand::make_grid(output const & o,
                             double lat_interval,
                             double lon_interval)
 {
-    return this->factory_->make_grid(samples,
-                                     lines,
-                                     lat_interval,
-                                     lon_interval);
+    return o.factory->make_grid(o.samples,
+                                o.lines,
+                                lat_interval,
+                                lon_interval);
 }
 
 void
-MaRC::MapCommand::write_grid(MaRC::FITS::output_file & map_file)
+MaRC::MapCommand::write_grid(output const & o,
+                             MaRC::FITS::output_file & map_file,
+                             MaRC::FITS::writer & writer,
+                             MaRC::thread_pool & pool)
 {
     if (!this->create_grid_)
         return;
 
-    constexpr std::size_t planes = 1;  // Only one grid image plane.
-    static char const extname[] = "GRID";
-
-    auto grid_image =
-        map_file.make_image(FITS::traits<FITS::byte_type>::bitpix,
-                            this->samples_,
-                            this->lines_,
-                            planes,
-                            extname);
-
-    // Write the grid comments.
-    for (auto const & xcomment : this->parameters_->xcomments())
-        grid_image->comment(xcomment);
-
-    std::string const xhistory =
-        std::string(this->projection_name())
-        + " projection grid created using " PACKAGE_STRING ".";
-
-    // Write some MaRC-specific HISTORY comments.
-    grid_image->history(xhistory);
-
-    // Write map grid DATAMIN and DATAMAX keywords.  Both are the
-    // SAME, since only one valid value exists in the grid image.
-    double minimum = std::numeric_limits<grid_type::value_type>::max();
-    double maximum = minimum;
-
-    grid_image->datamin(minimum);
-    grid_image->datamax(maximum);
-
-    int grid_blank = 0;
-    grid_image->blank<decltype(grid_blank)>(grid_blank);
-
+    /*
+      Create the grid before queuing the grid image creation so that
+      grid creation overlaps with writing the map planes.
+    */
     auto const start = std::chrono::high_resolution_clock::now();
 
-    grid_type grid(this->make_grid(this->samples_,
-                                   this->lines_,
+    grid_type grid(this->make_grid(o,
                                    this->lat_interval_,
                                    this->lon_interval_));
 
@@ -258,8 +310,46 @@ MaRC::MapCommand::write_grid(MaRC::FITS::output_file & map_file)
     std::cout << "Completed mapping grid in " << seconds.count()
               << " seconds.\n";
 
-    if(!grid_image->template write<grid_type>(grid))
-        MaRC::error("Unable to write grid image to map file.");
+    writer.submit(
+        [this, &o, &map_file, &pool, grid = std::move(grid)]()
+        {
+            constexpr std::size_t planes = 1;  // Only one grid image plane.
+            static char const extname[] = "GRID";
+
+            auto grid_image =
+                map_file.make_image(FITS::traits<FITS::byte_type>::bitpix,
+                                    o.samples,
+                                    o.lines,
+                                    planes,
+                                    extname);
+
+            // Write the grid comments.
+            for (auto const & xcomment : this->parameters_->xcomments())
+                grid_image->comment(xcomment);
+
+            std::string const xhistory =
+                std::string(o.factory->projection_name())
+                + " projection grid created using " PACKAGE_STRING ".";
+
+            // Write some MaRC-specific HISTORY comments.
+            grid_image->history(xhistory);
+
+            // Write map grid DATAMIN and DATAMAX keywords.  Both are
+            // the SAME, since only one valid value exists in the grid
+            // image.
+            double minimum =
+                std::numeric_limits<grid_type::value_type>::max();
+            double maximum = minimum;
+
+            grid_image->datamin(minimum);
+            grid_image->datamax(maximum);
+
+            int grid_blank = 0;
+            grid_image->blank<decltype(grid_blank)>(grid_blank);
+
+            if(!grid_image->template write<grid_type>(grid, pool))
+                MaRC::error("Unable to write grid image to map file.");
+        });
 }
 
 void
@@ -280,11 +370,67 @@ MaRC::MapCommand::image_factories(image_factories_type factories)
     this->image_factories_ = std::move(factories);
 }
 
+void
+MaRC::MapCommand::lookahead(std::size_t depth)
+{
+    if (depth > 0 && !FITS::is_reentrant()) {
+        MaRC::warn("CFITSIO is not thread-safe.  "
+                   "Map plane prefetching disabled.");
+
+        depth = 0;
+    }
+
+    this->lookahead_ = depth;
+}
+
+void
+MaRC::MapCommand::batch(std::size_t images)
+{
+    if (images == 0)
+        throw std::invalid_argument("Map batch has no source images.");
+
+    this->batch_ = images;
+}
+
+void
+MaRC::MapCommand::compression(FITS::compression_parameters const & c)
+{
+    this->compression_ = c;
+}
+
+void
+MaRC::MapCommand::source_driven(bool enable)
+{
+    this->source_driven_ = enable;
+}
+
+void
+MaRC::MapCommand::coordinate_tolerance(double km)
+{
+    for (auto & o : this->outputs_)
+        o.factory->coordinate_tolerance(km);
+}
+
+void
+MaRC::MapCommand::math(math_mode mode)
+{
+    for (auto & o : this->outputs_)
+        o.factory->math(mode);
+}
+
+void
+MaRC::MapCommand::resampling_plans(
+    std::shared_ptr<resampling_plan_file> plans)
+{
+    this->plans_ = std::move(plans);
+}
+
 void
 MaRC::MapCommand::write_virtual_image_facts(MaRC::FITS::image & map_image,
                                             std::size_t plane,
                                             std::size_t num_planes,
-                                            SourceImage const * image)
+                                            SourceImage const * image,
+                                            std::size_t band)
 {
     /**
      * @todo This entire method seems is a bit of hack.  Come up with
@@ -292,10 +438,21 @@ MaRC::MapCommand::write_virtual_image_facts(MaRC::FITS::image & map_image,
      *       information to the %FITS file.
      */
 
-    auto const v = dynamic_cast<VirtualImage const *>(image);
+    double scale  = 1;
+    double offset = 0;
 
-    if (!v)
-        return;  // Not a VirtualImage subclass instance.
+    if (auto const v = dynamic_cast<VirtualImage const *>(image)) {
+        scale  = v->scale();
+        offset = v->offset();
+    } else if (auto const b =
+               dynamic_cast<BackplaneImage const *>(image)) {
+        auto const & p = b->planes()[band];
+
+        scale  = p.scale;
+        offset = p.offset;
+    } else {
+        return;  // Not a VirtualImage or BackplaneImage.
+    }
 
     /**
      * @bug This prevents the BUNIT card from being written for
@@ -310,9 +467,6 @@ MaRC::MapCommand::write_virtual_image_facts(MaRC::FITS::image & map_image,
     // maximize significant digits.  Write map plane-specific scaling
     // factors to the FITS file.
 
-    double scale  = v->scale();
-    double offset = v->offset();
-
     // Avoid writing "-0".  It's harmless but rather unsightly.
     constexpr int epsilons = 1;
     if (MaRC::almost_zero(offset, epsilons))
@@ -436,6 +590,27 @@ MaRC::MapCommand::populate_map_parameters()
     return this->parameters_->merge(to_merge);
 }
 
+std::size_t
+MaRC::MapCommand::batch_planes() const
+{
+    std::vector<std::size_t> bands;
+    bands.reserve(this->image_factories_.size());
+
+    for (auto const & i : this->image_factories_)
+        bands.push_back(i->bands());
+
+    auto const count = std::min(this->batch_, bands.size());
+
+    std::partial_sort(bands.begin(),
+                      bands.begin() + count,
+                      bands.end(),
+                      std::greater<>());
+
+    return std::accumulate(bands.cbegin(),
+                           bands.cbegin() + count,
+                           std::size_t(0));
+}
+
 int
 MaRC::MapCommand::number_of_digits(std::size_t num)
 {
@@ -2,7 +2,7 @@
 /**
  * @file MapCommand.h
  *
- * Copyright (C) 2004, 2017-2019  Ossama Othman
+ * Copyright (C) 2004, 2017-2019, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: GPL-2.0-or-later
  *
@@ -13,12 +13,16 @@
 #define MARC_MAP_COMMAND_H
 
 #include "FITS_file.h"
+#include "FITS_writer.h"
+#include "thread_pool.h"
 #include "SourceImageFactory.h"
 #include "map_parameters.h"
+#include "resampling_plan_file.h"
 
 #include <marc/MapFactory.h>
 
 #include <list>
+#include <vector>
 #include <string>
 #include <memory>
 
@@ -28,7 +32,12 @@ namespace MaRC
     /**
      * @class MapCommand
      *
-     * @brief Drive creation of a single map and grid.
+     * @brief Drive creation of a map and grid.
+     *
+     * The same source images may be mapped to several map
+     * projections, each written to its own map file.  The source
+     * images are then only created once, and all map projections
+     * are created concurrently.
      */
     class MapCommand
     {
@@ -41,6 +50,27 @@ namespace MaRC
         using image_factories_type =
             std::list<std::unique_ptr<MaRC::SourceImageFactory>>;
 
+        /**
+         * @struct output
+         *
+         * @brief Map file created from the source images.
+         */
+        struct output
+        {
+            /// Name of map output file.
+            std::string filename;
+
+            /// Number of samples in map.
+            long samples;
+
+            /// Number of lines in map.
+            long lines;
+
+            /// @c MapFactory object responsible for creating the map
+            /// and grid.
+            std::unique_ptr<MapFactory> factory;
+        };
+
         /// Constructor.
         /**
          * @param[in,out] filename  Name of map output file.
@@ -66,8 +96,22 @@ namespace MaRC
         /// Execute the command.
         int execute();
 
+        /**
+         * @brief Add a map created from the same source images.
+         *
+         * @param[in,out] o Map file, dimensions and @c MapFactory
+         *                  of the additional map.
+         *
+         * @throw std::invalid_argument Map file name already used
+         *                              by this command.
+         */
+        void add_output(output o);
+
         /// Get map file name.
-        std::string const & filename() const { return this->filename_; }
+        std::string const & filename() const
+        {
+            return this->outputs_.front().filename;
+        }
 
         /// Get name of projection.
         char const * projection_name() const;
@@ -86,13 +130,124 @@ namespace MaRC
          */
         void image_factories(image_factories_type factories);
 
+        /**
+         * @brief Set the number of map planes to prefetch.
+         *
+         * Creating a @c SourceImage may be expensive, e.g. reading a
+         * %FITS file and computing a body mask.  Up to @a depth
+         * upcoming @c SourceImage objects will be created on
+         * background threads while the current batch is being
+         * mapped.  Each of them is held in memory until its map
+         * planes have been mapped.  A @a depth of zero disables
+         * prefetching.
+         *
+         * @param[in] depth Number of source images to prefetch.
+         *
+         * @see @c batch()
+         *
+         * @note Prefetching is disabled if CFITSIO is not
+         *       thread-safe.
+         */
+        void lookahead(std::size_t depth);
+
+        /**
+         * @brief Set the number of source images mapped together.
+         *
+         * Up to @a images source images are mapped in a single
+         * traversal of the map, so the map latitudes and longitudes
+         * are only computed once for all of their planes.  Each
+         * batch of map planes is written while the next one is
+         * being mapped.  The @c SourceImage and map planes of an
+         * entire batch are held in memory at once, so larger
+         * batches trade memory for fewer map traversals.
+         *
+         * @param[in] images Number of source images mapped in each
+         *                   traversal of the map.  The default of
+         *                   one maps each source image, and all of
+         *                   its bands, separately.
+         *
+         * @throw std::invalid_argument @a images is zero.
+         */
+        void batch(std::size_t images);
+
+        /**
+         * @brief Set map image tile compression parameters.
+         *
+         * @param[in] c Tile compression parameters applied to the
+         *              map and grid images.
+         */
+        void compression(FITS::compression_parameters const & c);
+
+        /**
+         * @brief Only traverse map regions covered by source images.
+         *
+         * Skip map pixels outside of the region covered by the
+         * footprints of the source images, rather than computing
+         * their latitudes and longitudes only to find no data
+         * there.  This mostly benefits maps much larger than the
+         * region covered by the source images, such as global maps
+         * of a single photo.
+         *
+         * @param[in] enable Enable source-driven mapping.
+         *
+         * @see @c MaRC::MapFactory::map_coverage()
+         */
+        void source_driven(bool enable);
+
+        /**
+         * @brief Set the accuracy of interpolated map coordinates.
+         *
+         * @param[in] km Maximum distance on the surface of the body
+         *               between interpolated and exact map pixel
+         *               locations, in kilometers, for all map
+         *               outputs.
+         *
+         * @see @c MaRC::MapFactory::coordinate_tolerance()
+         */
+        void coordinate_tolerance(double km);
+
+        /**
+         * @brief Set the transcendental math implementation.
+         *
+         * @param[in] mode Transcendental math implementation used by
+         *                 all map outputs.
+         *
+         * @see @c MaRC::MapFactory::math()
+         */
+        void math(math_mode mode);
+
+        /**
+         * @brief Map source images through recorded resampling
+         *        plans.
+         *
+         * Source images that support resampling plans, such as
+         * photos and mosaics of photos, are mapped through the next
+         * plans in @a plans, one per map output, rather than through
+         * the map projection and viewing geometry.  The plans are
+         * recorded first if the file is new.  Other source images
+         * are mapped as usual.
+         *
+         * @param[in] plans Resampling plans shared by all maps, in
+         *                  the order the maps are created, or
+         *                  @c nullptr to map all source images
+         *                  directly.
+         */
+        void resampling_plans(std::shared_ptr<resampling_plan_file> plans);
+
     private:
 
+        /**
+         * @brief Data of each band of a source image, as expected
+         *        by @c ResamplingPlan::apply().
+         */
+        using plan_data = std::vector<ResamplingPlan::source_list>;
+
         /**
          * @brief Write @c VirtualImage information to %FITS file.
          *
          * Write information specific to @c VirtualImage (e.g.
-         * @c MuImage) based map planes to the map %FITS file.
+         * @c MuImage) and @c BackplaneImage based map planes to the
+         * map %FITS file.
          *
          * @param[in] map_image  %FITS image array HDU enscapulation.
          * @param[in] plane      Map plane number of @c VirtualImage.
@@ -102,20 +257,125 @@ namespace MaRC
          *                       @c VirtualImage about which facts
          *                       are being written to the %FITS
          *                       file.
+         * @param[in] band       Band of @a image mapped to the map
+         *                       plane.
          */
         void write_virtual_image_facts(FITS::image & map_image,
                                        std::size_t plane,
                                        std::size_t num_planes,
-                                       SourceImage const * image);
+                                       SourceImage const * image,
+                                       std::size_t band);
 
         /**
          * @brief Create and write map planes.
          *
-         * @tparam        T    Map data type.
-         * @param[in,out] file Object representing %FITS output file.
+         * Source images are mapped in batches of up to @c batch_
+         * images.  Map planes of the first output are created on the
+         * calling thread, and those of additional outputs on
+         * separate threads.  They are written to the %FITS files by
+         * the @a writer thread while the next batch is being
+         * mapped.
+         *
+         * @tparam        T      Map data type.
+         * @param[in,out] files  Objects representing the %FITS output
+         *                       file of each output, in order.
+         * @param[in,out] writer Thread writing to the %FITS output
+         *                       files.
+         * @param[in,out] pool   Threads used by the @a writer to
+         *                       write each map plane, and to create
+         *                       the source images.
+         */
+        template <typename T>
+        void make_map_planes(
+            std::vector<std::unique_ptr<FITS::output_file>> & files,
+            MaRC::FITS::writer & writer,
+            MaRC::thread_pool & pool);
+
+        /**
+         * @brief Map a batch of source images to a single output.
+         *
+         * Source images with a resampling plan are mapped through
+         * it.  The others are mapped in a single traversal of the
+         * map.
+         *
+         * @tparam        T      Map data type.
+         * @param[in]     o      Map output being created.
+         * @param[in]     images Source images in the batch.
+         * @param[in]     minmax Physical data extrema of each source
+         *                       image.
+         * @param[in]     plans  Resampling plan of each source image
+         *                       for @a o.
+         * @param[in]     data   Data of each source image mapped
+         *                       through its plan, or an empty list
+         *                       for source images without a plan.
+         * @param[in,out] info   Map plotting information.
+         * @param[in,out] maps   Map planes of the batch, in order.
+         */
+        template <typename T>
+        void map_batch(output const & o,
+                       MapFactory::source_list const & images,
+                       MapFactory::extrema_list<T> const & minmax,
+                       std::vector<ResamplingPlan> const & plans,
+                       std::vector<plan_data> const & data,
+                       plot_info<T> & info,
+                       std::vector<MapFactory::map_type<T>> & maps) const;
+
+        /**
+         * @brief Write a batch of map planes of a single output.
+         *
+         * @tparam        T            Map data type.
+         * @param[in]     map_image    Primary image array HDU of
+         *                             the map file.
+         * @param[in]     maps         Buffers containing the map
+         *                             planes to be written.  They
+         *                             are returned to their pool
+         *                             once written.
+         * @param[in]     plane_images @c SourceImage of each map
+         *                             plane in @a maps.
+         * @param[in]     first_plane  Map plane number of the first
+         *                             plane in @a maps.
+         * @param[in]     num_planes   Number of map planes.
+         * @param[in,out] writer       Thread writing to the %FITS
+         *                             output file.
+         * @param[in,out] pool         Threads used by the @a writer
+         *                             to write each map plane.
+         */
+        template <typename T>
+        void write_map_planes(
+            std::shared_ptr<FITS::image> const & map_image,
+            std::vector<typename FITS::buffer_pool<T>::handle_type>
+                const & maps,
+            std::vector<std::shared_ptr<SourceImage const>> const &
+                plane_images,
+            std::size_t first_plane,
+            std::size_t num_planes,
+            MaRC::FITS::writer & writer,
+            MaRC::thread_pool & pool);
+
+        /**
+         * @brief Return the most map planes mapped in one batch.
+         *
+         * @return Total number of bands of the @c batch_ source
+         *         images with the most bands.
+         */
+        std::size_t batch_planes() const;
+
+        /**
+         * @brief Create the primary image array HDU of a map file.
+         *
+         * @tparam        T          Map data type.
+         * @param[in,out] file       Object representing %FITS
+         *                           output file.
+         * @param[in]     o          Map output being written.
+         * @param[in]     num_planes Number of map planes.
+         *
+         * @return Map image with all map-wide keywords written.
          */
         template <typename T>
-        void make_map_planes(MaRC::FITS::output_file & file);
+        std::shared_ptr<FITS::image> make_map_image(
+            MaRC::FITS::output_file & file,
+            output const & o,
+            std::size_t num_planes);
 
         /**
          * @brief Create grid image.
@@ -124,24 +384,34 @@ namespace MaRC
          * class template member) that calls back on the type-specific
          * @c MapFactory to create the grid.
          *
-         * @param[in] samples      Number of samples in the map.
-         * @param[in] lines        Number of lines   in the map.
+         * @param[in] o            Map output of the grid.
          * @param[in] lat_interval Grid latitude  spacing.
          * @param[in] lon_interval Grid longitude spacing.
          *
          * @return @c Grid object containing grid image.
          */
-        grid_type make_grid(long samples,
-                            long lines,
+        grid_type make_grid(output const & o,
                             double lat_interval,
                             double lon_interval);
 
         /**
          * @brief Write map grid to the map %FITS file.
          *
-         * @param[in,out] file Object representing %FITS output file.
+         * The grid is created on the calling thread, and written to
+         * the %FITS file by the @a writer thread.
+         *
+         * @param[in]     o      Map output of the grid.
+         * @param[in,out] file   Object representing %FITS output
+         *                       file.
+         * @param[in,out] writer Thread writing to the %FITS output
+         *                       file.
+         * @param[in,out] pool   Threads used by the @a writer to
+         *                       write the grid image.
          */
-        void write_grid(MaRC::FITS::output_file & file);
+        void write_grid(output const & o,
+                        MaRC::FITS::output_file & file,
+                        MaRC::FITS::writer & writer,
+                        MaRC::thread_pool & pool);
 
         /**
          * @brief Automatically populate map parameters.
@@ -167,17 +437,22 @@ namespace MaRC
 
     private:
 
-        /// Number of samples in map.
-        long const samples_;
-
-        /// Number of lines in map.
-        long const lines_;
+        /**
+         * @brief Number of map plane buffers per plane in a batch.
+         *
+         * Two buffers per plane allow the next batch of map planes
+         * to be mapped while the previous one is being written,
+         * without accumulating completed map planes in memory faster
+         * than they can be written.
+         */
+        static constexpr std::size_t plane_buffers = 2;
 
         /**
-         * @c MapFactory object responsible for creating maps and
-         * grids.
+         * Map files, dimensions and @c MapFactory objects
+         * responsible for creating maps and grids.  The first
+         * output corresponds to the map entry itself.
          */
-        std::unique_ptr<MapFactory> const factory_;
+        std::vector<output> outputs_;
 
         /**
          * List of @c SourceImageFactory objects that create the
@@ -185,9 +460,6 @@ namespace MaRC
          */
         image_factories_type image_factories_;
 
-        /// Map filename.
-        std::string const filename_;
-
         /// Latitude grid line interval.
         double lat_interval_;
 
@@ -214,6 +486,21 @@ namespace MaRC
         /// Flag that determines if a grid is created.
         bool create_grid_;
 
+        /// Number of map planes to prefetch.
+        std::size_t lookahead_;
+
+        /// Number of source images mapped in each map traversal.
+        std::size_t batch_;
+
+        /// Map image tile compression parameters.
+        FITS::compression_parameters compression_;
+
+        /// Only traverse map regions covered by source images.
+        bool source_driven_;
+
+        /// Resampling plans of source images, if any.
+        std::shared_ptr<resampling_plan_file> plans_;
+
         /// User supplied map parameters.
         std::unique_ptr<map_parameters> parameters_;
 
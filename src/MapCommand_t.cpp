@@ -1,7 +1,7 @@
 /**
  * @file MapCommand_t.cpp
  *
- * Copyright (C) 2004, 2017-2020  Ossama Othman
+ * Copyright (C) 2004, 2017-2020, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: GPL-2.0-or-later
  *
@@ -14,6 +14,7 @@
 #include "MapCommand.h"
 #include "FITS_traits.h"
 #include "FITS_image.h"
+#include "FITS_writer.h"
 #include "ProgressConsole.h"
 
 #include <marc/MapFactory.h>
@@ -22,20 +23,34 @@
 #include <marc/details/format.h>
 
 #include <type_traits>
+#include <algorithm>
+#include <vector>
+#include <memory>
+#include <future>
+#include <deque>
+#include <stdexcept>
 
 #include <fitsio.h>
 
 
 template <typename T>
-void
-MaRC::MapCommand::make_map_planes(MaRC::FITS::output_file & file)
+std::shared_ptr<MaRC::FITS::image>
+MaRC::MapCommand::make_map_image(MaRC::FITS::output_file & file,
+                                 output const & o,
+                                 std::size_t num_planes)
 {
-    // Create primary image array HDU.
-    auto map_image =
+    /*
+      Create primary image array HDU.
+
+      The image is shared with the jobs run on the writer thread.
+      The last of those jobs releases it, at which point the image
+      checksum is written on the writer thread.
+    */
+    std::shared_ptr<FITS::image> map_image =
         file.make_image(this->parameters_->bitpix(),
-                        this->samples_,
-                        this->lines_,
-                        this->image_factories_.size());
+                        o.samples,
+                        o.lines,
+                        num_planes);
 
     auto const blank = this->parameters_->blank();
 
@@ -69,7 +84,7 @@ MaRC::MapCommand::make_map_planes(MaRC::FITS::output_file & file)
 
     std::string const history =
         fmt::format("{} projection created by " PACKAGE_STRING ".",
-                    this->projection_name());
+                    o.factory->projection_name());
 
     // Write some MaRC-specific HISTORY comments.
     map_image->history(history);
@@ -109,78 +124,416 @@ MaRC::MapCommand::make_map_planes(MaRC::FITS::output_file & file)
      *       image parameters.
      */
 
+    return map_image;
+}
+
+template <typename T>
+void
+MaRC::MapCommand::make_map_planes(
+    std::vector<std::unique_ptr<FITS::output_file>> & files,
+    MaRC::FITS::writer & writer,
+    MaRC::thread_pool & pool)
+{
+    /*
+      Each band of a multi-band source image, such as the planes of
+      a multispectral image cube, is mapped to a separate map plane.
+    */
+    std::size_t num_planes = 0;
+
+    for (auto const & i : this->image_factories_)
+        num_planes += i->bands();
+
+    auto const num_outputs = this->outputs_.size();
+
+    std::vector<std::shared_ptr<FITS::image>> map_images;
+    map_images.reserve(num_outputs);
+
+    for (std::size_t n = 0; n < num_outputs; ++n)
+        map_images.push_back(
+            this->template make_map_image<T>(*files[n],
+                                             this->outputs_[n],
+                                             num_planes));
+
     // Keep track of mapped planes for reporting to user.
-    int plane_count = 1;
-    std::size_t const num_planes = this->image_factories_.size();
+    std::size_t plane_count = 1;
     auto const digits = this->number_of_digits(num_planes);
 
     SourceImageFactory::scale_offset_functor const sof =
         scale_and_offset<T>;
 
-    plot_info<T> info(this->samples_,
-                      this->lines_,
-                      blank);
+    auto const blank = this->parameters_->blank();
 
-    info.notifier().subscribe(std::make_unique<Progress::Console>());
+    std::deque<plot_info<T>> infos;
 
-    // Create and write the map planes.
-    for (auto const & i : this->image_factories_) {
-        // Create the SourceImage.
-        std::unique_ptr<SourceImage> const image(i->make(sof));
+    for (auto const & o : this->outputs_) {
+        infos.emplace_back(o.samples, o.lines, blank);
+        infos.back().source_driven(this->source_driven_);
+    }
 
-        if (!image)
-            continue;  // Problem creating SourceImage.  Move on.
+    // Only report the progress of the first output to avoid
+    // interleaving progress from concurrently created maps.
+    infos.front().notifier().subscribe(
+        std::make_unique<Progress::Console>());
+
+    /*
+      Map plane buffers are handed off to the writer thread once
+      mapped, and returned to these pools once written.  Bounding
+      the number of buffers allows the next batch of map planes to
+      be mapped while the previous one is being written without
+      accumulating completed planes in memory faster than they can
+      be written.  Each output has its own pool since the map
+      dimensions may differ between outputs.
+    */
+    using buffer_pool_type = FITS::buffer_pool<T>;
+    using buffer_list = std::vector<typename buffer_pool_type::handle_type>;
+
+    auto const capacity = plane_buffers * this->batch_planes();
+
+    std::vector<std::shared_ptr<buffer_pool_type>> buffers;
+    buffers.reserve(num_outputs);
+
+    for (std::size_t n = 0; n < num_outputs; ++n)
+        buffers.push_back(std::make_shared<buffer_pool_type>(capacity));
+
+    /*
+      Create the SourceImage for upcoming map planes on background
+      threads while the current batch is being mapped.  The
+      SourceImage creation is deferred until needed on this thread
+      if prefetching is disabled.
+    */
+    using image_future = std::future<std::unique_ptr<SourceImage>>;
+
+    std::deque<image_future> pending;
+
+    auto const policy =
+        (this->lookahead_ > 0 ? std::launch::async : std::launch::deferred);
+
+    auto next = this->image_factories_.cbegin();
+    auto const end = this->image_factories_.cend();
+
+    auto const prefetch =
+        [&]()
+        {
+            // The current plane plus the lookahead.
+            for ( ; next != end && pending.size() <= this->lookahead_;
+                  ++next) {
+                auto const factory = next->get();
+
+                pending.push_back(
+                    std::async(policy,
+                               [factory, &sof, &pool]()
+                               {
+                                   return factory->make(sof, pool);
+                               }));
+            }
+        };
+
+    // Create and write the map planes, a batch at a time.
+    for (auto i = this->image_factories_.cbegin(); i != end; ) {
+        MapFactory::source_list images;
+        MapFactory::extrema_list<T> minmax;
+
+        // Source image corresponding to each map plane in the batch.
+        std::vector<std::shared_ptr<SourceImage const>> plane_images;
+
+        for ( ; i != end && images.size() < this->batch_; ++i) {
+            prefetch();
+
+            // Obtain the SourceImage, waiting for it to be created
+            // if necessary.
+            std::shared_ptr<SourceImage const> const image(
+                pending.front().get());
+
+            pending.pop_front();
+
+            if (!image)
+                continue;  // Problem creating SourceImage.  Move on.
+
+            images.push_back(image.get());
+            minmax.push_back((*i)->minmax());
+            plane_images.insert(plane_images.end(), image->bands(), image);
+        }
+
+        if (images.empty())
+            continue;
+
+        auto const planes = plane_images.size();
 
         /**
          * @todo Move to @c MaRC::Progess::Console.
          */
-        fmt::print("Plane {:>{}} / {}: ",
-                   plane_count, digits, num_planes);
+        if (planes == 1)
+            fmt::print("Plane {:>{}} / {}: ",
+                       plane_count, digits, num_planes);
+        else
+            fmt::print("Planes {:>{}} - {:>{}} / {}: ",
+                       plane_count, digits,
+                       plane_count + planes - 1, digits,
+                       num_planes);
+
+        // Reuse previously written plane buffers if available.
+        std::vector<buffer_list> handles(num_outputs);
+        std::vector<std::vector<MapFactory::map_type<T>>> maps(
+            num_outputs);
+
+        for (std::size_t n = 0; n < num_outputs; ++n) {
+            for (std::size_t p = 0; p < planes; ++p) {
+                handles[n].push_back(buffers[n]->acquire());
+                maps[n].push_back(std::move(*handles[n].back()));
+            }
+        }
 
-        // Add description of the source image.
-        // comment_list_type descriptions;
+        /*
+          Obtain the resampling plans of the source images that
+          support them for each output, in the order they are
+          recorded.  Plans are obtained on this thread since that
+          order must not depend on the order in which the outputs
+          are mapped.
+        */
+        std::vector<std::vector<ResamplingPlan>> plans(num_outputs);
+        std::vector<plan_data> data(images.size());
 
-        // std::string image_title =
-        //     fmt::format("Plane {:>{}}: {}",
-        //                 plane_count, digits, image->name());
+        for (std::size_t j = 0; this->plans_ && j < images.size(); ++j) {
+            auto const image = images[j];
 
-        // descriptions.push_back();
+            if (image->resampling_sources().empty())
+                continue;  // Map directly.
 
-        /**
-         * @todo Refactor this call so that it isn't specific to
-         *       @c VirtualImage subclasses.
-         */
-        // Add description specific to the VirtualImage, if we have
-        // one, in the map FITS file.
-        this->write_virtual_image_facts(*map_image,
-                                        plane_count,
-                                        num_planes,
-                                        image.get());
-
-        // Create the map plane.
-        auto map =
-            this->factory_->template make_map<T>(*image,
-                                                 i->minmax(),
-                                                 info);
-
-        if (!info.data_mapped())
-            MaRC::warn("No data mapped for plane {}.", plane_count);
-
-        if (!map_image->template write<decltype(map)>(map))
-            MaRC::error("Unable to write plane {} to map file.",
-                        plane_count);
-
-        ++plane_count;
+            for (std::size_t b = 0; b < image->bands(); ++b) {
+                data[j].emplace_back();
+
+                if (!image->resampling_data(b, data[j].back()))
+                    throw std::runtime_error(
+                        "Unable to retrieve source image data for "
+                        "resampling plan.");
+            }
+        }
+
+        for (std::size_t n = 0; n < num_outputs; ++n) {
+            auto const & o = this->outputs_[n];
+
+            plans[n].resize(images.size());
+
+            for (std::size_t j = 0; j < images.size(); ++j)
+                if (!data[j].empty())
+                    plans[n][j] = this->plans_->next(*o.factory,
+                                                     *images[j],
+                                                     o.samples,
+                                                     o.lines);
+        }
+
+        /*
+          All other map planes in the batch are created in a single
+          traversal of each map.  The source images are only read,
+          so all outputs are mapped concurrently from the same source
+          images.  The first output is mapped on this thread.
+        */
+        auto const map =
+            [&](std::size_t n)
+            {
+                this->template map_batch<T>(this->outputs_[n],
+                                            images,
+                                            minmax,
+                                            plans[n],
+                                            data,
+                                            infos[n],
+                                            maps[n]);
+            };
+
+        std::vector<std::future<void>> jobs;
+
+        for (std::size_t n = 1; n < num_outputs; ++n)
+            jobs.push_back(std::async(std::launch::async, map, n));
+
+        map(0);
+
+        for (auto & job : jobs)
+            job.get();
+
+        for (std::size_t n = 0; n < num_outputs; ++n) {
+            if (!infos[n].data_mapped())
+                MaRC::warn("No data mapped for plane {} of {}.",
+                           plane_count,
+                           this->outputs_[n].filename);
+
+            for (std::size_t p = 0; p < planes; ++p)
+                *handles[n][p] = std::move(maps[n][p]);
+
+            this->template write_map_planes<T>(map_images[n],
+                                               handles[n],
+                                               plane_images,
+                                               plane_count,
+                                               num_planes,
+                                               writer,
+                                               pool);
+        }
+
+        plane_count += planes;
     }
 
-    if (info.data_mapped()) {
+    for (std::size_t n = 0; n < num_outputs; ++n) {
+        auto & info = infos[n];
+
+        if (info.data_mapped()) {
+            /*
+              Write DATAMIN and DATAMAX keywords.
+
+              At this point we know the extrema were set.
+            */
+            writer.submit(
+                [map_image = map_images[n],
+                 minimum = *info.minimum(),
+                 maximum = *info.maximum()]()
+                {
+                    map_image->template datamin<T>(minimum);
+                    map_image->template datamax<T>(maximum);
+                });
+        }
+
         /*
-          Write DATAMIN and DATAMAX keywords.
+          Hand our reference to the map image over to the writer
+          thread so that the image is finalized there, after all of
+          the above writes have completed.
+        */
+        writer.submit([image = std::move(map_images[n])]() mutable
+                      {
+                          image.reset();
+                      });
+    }
+}
+
+template <typename T>
+void
+MaRC::MapCommand::map_batch(output const & o,
+                            MapFactory::source_list const & images,
+                            MapFactory::extrema_list<T> const & minmax,
+                            std::vector<ResamplingPlan> const & plans,
+                            std::vector<plan_data> const & data,
+                            plot_info<T> & info,
+                            std::vector<MapFactory::map_type<T>> & maps)
+    const
+{
+    // Source images mapped through the map projection, and their
+    // map planes.
+    MapFactory::source_list traversed;
+    MapFactory::extrema_list<T> traversed_minmax;
+    std::vector<MapFactory::map_type<T>> traversed_maps;
+
+    /*
+      Track the extrema of the map planes mapped through resampling
+      plans separately so that the progress of the batch is only
+      reported once.
+    */
+    plot_info<T> plan_info(info.samples(), info.lines(), info.blank());
+
+    std::size_t plane = 0;
+
+    for (std::size_t j = 0; j < images.size(); ++j) {
+        auto const bands = images[j]->bands();
+
+        if (data[j].empty()) {
+            traversed.push_back(images[j]);
+            traversed_minmax.push_back(minmax[j]);
+
+            // Reuse the map plane buffers.
+            for (std::size_t b = 0; b < bands; ++b)
+                traversed_maps.push_back(std::move(maps[plane + b]));
+        } else {
+            for (std::size_t b = 0; b < bands; ++b)
+                plans[j].apply(data[j][b],
+                               minmax[j],
+                               plan_info,
+                               maps[plane + b]);
+        }
+
+        plane += bands;
+    }
+
+    if (plan_info.data_mapped()) {
+        info.update_extrema(*plan_info.minimum());
+        info.update_extrema(*plan_info.maximum());
+    }
+
+    if (traversed.empty()) {
+        info.notifier().notify_done(info.samples() * info.lines());
+
+        return;
+    }
+
+    o.factory->template make_maps<T>(traversed,
+                                     traversed_minmax,
+                                     info,
+                                     traversed_maps);
 
-          At this point we know the extrema were set.
+    // Return the traversed map planes to their place in the batch.
+    auto t = traversed_maps.begin();
+
+    plane = 0;
+
+    for (std::size_t j = 0; j < images.size(); ++j) {
+        auto const bands = images[j]->bands();
+
+        if (data[j].empty())
+            for (std::size_t b = 0; b < bands; ++b)
+                maps[plane + b] = std::move(*t++);
+
+        plane += bands;
+    }
+}
+
+template <typename T>
+void
+MaRC::MapCommand::write_map_planes(
+    std::shared_ptr<FITS::image> const & map_image,
+    std::vector<typename FITS::buffer_pool<T>::handle_type> const & maps,
+    std::vector<std::shared_ptr<SourceImage const>> const & plane_images,
+    std::size_t first_plane,
+    std::size_t num_planes,
+    MaRC::FITS::writer & writer,
+    MaRC::thread_pool & pool)
+{
+    // Band of the source image mapped to the map plane.
+    std::size_t band = 0;
+
+    for (std::size_t p = 0; p < maps.size(); ++p) {
+        if (p > 0 && plane_images[p] == plane_images[p - 1])
+            ++band;
+        else
+            band = 0;
+
+        /*
+          The buffer is returned to its pool when the job is
+          destroyed on the writer thread, even if the write fails.
         */
-        map_image->template datamin<T>(*info.minimum());
-        map_image->template datamax<T>(*info.maximum());
+        writer.submit(
+            [this,
+             &pool,
+             map_image,
+             image = plane_images[p],
+             band,
+             map = maps[p],
+             plane_count = first_plane + p,
+             num_planes]()
+            {
+                /**
+                 * @todo Refactor this call so that it isn't specific
+                 *       to @c VirtualImage subclasses.
+                 */
+                // Add description specific to the VirtualImage, if
+                // we have one, in the map FITS file.
+                this->write_virtual_image_facts(*map_image,
+                                                plane_count,
+                                                num_planes,
+                                                image.get(),
+                                                band);
+
+                if (!map_image->template write<MapFactory::map_type<T>>(
+                        *map,
+                        pool))
+                    MaRC::error("Unable to write plane {} to map "
+                                "file.",
+                                plane_count);
+            });
     }
 }
 
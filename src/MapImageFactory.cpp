@@ -0,0 +1,120 @@
+/**
+ * @file MapImageFactory.cpp
+ *
+ * Copyright (C) 2026  Ossama Othman
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * @author Ossama Othman
+ */
+
+#include "MapImageFactory.h"
+#include "map_parameters.h"
+
+#include "marc/MapImage.h"
+#include "marc/MapFactory.h"
+
+#include <vector>
+
+
+MaRC::MapImageFactory::MapImageFactory(char const * filename)
+    : SourceImageFactory()
+    , file_(filename)
+    , interpolate_(false)
+    , projection_()
+{
+}
+
+/**
+ * @brief Set map parameter from the source map %FITS file.
+ *
+ * @param parameter Name of map parameter to be set.
+ */
+#define MARC_SET_PARAM(parameter) p.parameter(this->file_.parameter())
+
+bool
+MaRC::MapImageFactory::populate_parameters(
+    MaRC::map_parameters & p) const
+{
+    MARC_SET_PARAM(author);
+    MARC_SET_PARAM(bitpix);
+    MARC_SET_PARAM(blank);
+    MARC_SET_PARAM(bunit);
+
+    // The DATAMIN and DATAMAX values are set in this image factory
+    // instead.  See PhotoImageFactory::populate_parameters().
+
+    MARC_SET_PARAM(equinox);
+    MARC_SET_PARAM(instrument);
+    MARC_SET_PARAM(object);
+    MARC_SET_PARAM(observer);
+    MARC_SET_PARAM(origin);
+    MARC_SET_PARAM(reference);
+    MARC_SET_PARAM(telescope);
+
+    return true;
+}
+
+std::unique_ptr<MaRC::SourceImage>
+MaRC::MapImageFactory::make(scale_offset_functor /* calc_so */,
+                            thread_pool & /* pool */)
+{
+    if (!this->projection_)
+        return nullptr;
+
+    std::size_t samples = 0;
+    std::size_t lines   = 0;
+
+    this->file_.dimensions(samples, lines);
+
+    // Blank map pixels are read as NaN.
+    std::vector<double> map;
+
+    this->file_.read(map, 0, 0, samples, lines);
+
+    // Set physical data extrema if not previously set.
+    auto const & datamin = this->file_.datamin();
+    auto const & datamax = this->file_.datamax();
+
+    if (datamin)
+        this->minimum(*datamin);
+    if (datamax)
+        this->maximum(*datamax);
+
+    return std::make_unique<MaRC::MapImage>(this->projection_,
+                                            std::move(map),
+                                            samples,
+                                            lines,
+                                            this->interpolate_);
+}
+
+void
+MaRC::MapImageFactory::hdu(int number)
+{
+    this->file_.hdu(number);
+}
+
+void
+MaRC::MapImageFactory::hdu(std::string const & extname)
+{
+    this->file_.hdu(extname);
+}
+
+void
+MaRC::MapImageFactory::plane(std::size_t number)
+{
+    this->file_.plane(number);
+}
+
+void
+MaRC::MapImageFactory::interpolate(bool enable)
+{
+    this->interpolate_ = enable;
+}
+
+void
+MaRC::MapImageFactory::projection(
+    std::shared_ptr<MapFactory const> projection)
+{
+    this->projection_ = std::move(projection);
+}
@@ -0,0 +1,129 @@
+// -*- C++ -*-
+/**
+ * @file MapImageFactory.h
+ *
+ * Copyright (C) 2026  Ossama Othman
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * @author Ossama Othman
+ */
+
+#ifndef MARC_MAP_IMAGE_FACTORY_H
+#define MARC_MAP_IMAGE_FACTORY_H
+
+#include "SourceImageFactory.h"
+#include "FITS_file.h"
+
+#include <memory>
+#include <string>
+#include <cstddef>
+
+
+namespace MaRC
+{
+    class MapFactory;
+
+    /**
+     * @class MapImageFactory
+     *
+     * @brief Factory class that creates MapImage objects.
+     *
+     * This class creates @c MapImage objects from a plane of an
+     * existing %MaRC map %FITS file, allowing that map to be used
+     * as the source of data for another map.  As with photos, the
+     * map data isn't read until it is time for it to be mapped.
+     */
+    class MapImageFactory final : public SourceImageFactory
+    {
+    public:
+
+        /**
+         * @brief Constructor.
+         *
+         * @param[in] filename Name of file containing the map.
+         *
+         * @throw std::runtime_error Error opening the map %FITS
+         *                           file.
+         */
+        MapImageFactory(char const * filename);
+
+        /// Destructor.
+        ~MapImageFactory() override = default;
+
+        /**
+         * @brief Populate map parameters.
+         *
+         * @param[in,out] p Map parameters to be populated.
+         *
+         * return @c true if population of map parameters succeeded,
+         *        and @c false otherwise.
+         */
+        bool populate_parameters(
+            map_parameters & p) const override;
+
+        /**
+         * @brief Create a @c MapImage.
+         *
+         * @return @c MapImage containing the selected map plane, or
+         *         @c nullptr if the map projection wasn't set.
+         */
+        std::unique_ptr<SourceImage> make(
+            scale_offset_functor calc_so,
+            thread_pool & pool) override;
+
+        /**
+         * @brief Select the map image HDU by number.
+         *
+         * @param[in] number HDU number, where zero corresponds to
+         *                   the primary HDU.
+         *
+         * @see MaRC::FITS::input_file::hdu(int)
+         */
+        void hdu(int number);
+
+        /**
+         * @brief Select the map image HDU by extension name.
+         *
+         * @param[in] extname %FITS image extension name.
+         *
+         * @see MaRC::FITS::input_file::hdu(std::string const &)
+         */
+        void hdu(std::string const & extname);
+
+        /**
+         * @brief Select the map plane in a map cube.
+         *
+         * @param[in] number Plane number, starting at one.
+         */
+        void plane(std::size_t number);
+
+        /// Set map interpolation flag.
+        void interpolate(bool enable);
+
+        /**
+         * @brief Set the map projection used to create the map.
+         *
+         * @param[in] projection Map projection with the same
+         *                       configuration used to create the
+         *                       map.  It must provide the forward
+         *                       projection equations.
+         */
+        void projection(std::shared_ptr<MapFactory const> projection);
+
+    private:
+
+        /// %FITS file containing the map.
+        FITS::input_file file_;
+
+        /// Perform map pixel interpolation.
+        bool interpolate_;
+
+        /// Map projection used to create the map.
+        std::shared_ptr<MapFactory const> projection_;
+
+    };
+
+}
+
+#endif  /* MARC_MAP_IMAGE_FACTORY_H */
@@ -1,7 +1,7 @@
 /**
  * @file MosaicImageFactory.cpp
  *
- * Copyright (C) 2004, 2017, 2020  Ossama Othman
+ * Copyright (C) 2004, 2017, 2020, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: GPL-2.0-or-later
  *
@@ -9,11 +9,13 @@
  */
 
 #include "MosaicImageFactory.h"
+#include "thread_pool.h"
 
 #include <marc/first_read.h>
 #include <marc/unweighted_average.h>
 #include <marc/weighted_average.h>
 
+#include <vector>
 #include <stdexcept>
 
 
@@ -72,7 +74,8 @@ MaRC::MosaicImageFactory::populate_parameters(
 }
 
 std::unique_ptr<MaRC::SourceImage>
-MaRC::MosaicImageFactory::make(scale_offset_functor calc_so)
+MaRC::MosaicImageFactory::make(scale_offset_functor calc_so,
+                               thread_pool & pool)
 {
     /**
      * @todo Verify that the extrema handling in this method is
@@ -82,9 +85,8 @@ MaRC::MosaicImageFactory::make(scale_offset_functor calc_so)
     extrema_type ex;
     bool valid_minimum = true;
     bool valid_maximum = true;
-    MosaicImage::list_type photos;
 
-    for (auto & factory : this->factories_) {
+    for (auto const & factory : this->factories_) {
         auto const & minmax = factory->minmax();
 
         if (!minmax.minimum())
@@ -93,8 +95,42 @@ MaRC::MosaicImageFactory::make(scale_offset_functor calc_so)
             valid_maximum = false;
 
         ex.update(minmax);
+    }
+
+    /*
+      Create the photos concurrently.  Each PhotoImageFactory has its
+      own FITS file, meaning no CFITSIO fitsfile object is accessed by
+      more than one thread.  Photos are stored at the index of their
+      factory so that their order in the mosaic is the same as the
+      order of the factories, regardless of the order in which they
+      were created.
+    */
+    std::vector<PhotoImageFactory *> factories;
+    factories.reserve(this->factories_.size());
+
+    for (auto const & factory : this->factories_)
+        factories.push_back(factory.get());
 
-        photos.push_back(factory->make(calc_so));
+    MosaicImage::list_type photos(factories.size());
+
+    auto const make_photo =
+        [&factories, &photos, &calc_so, &pool](std::size_t i)
+        {
+            photos[i] = factories[i]->make(calc_so, pool);
+        };
+
+    /*
+      Create the photos on the threads shared by the map command
+      rather than starting a set of threads for each mosaic, which
+      would oversubscribe the CPU when several mosaics are prefetched
+      at once.  Fall back on creating the photos on this thread if
+      CFITSIO isn't thread-safe.
+    */
+    if (FITS::is_reentrant()) {
+        pool.run(factories.size(), make_photo);
+    } else {
+        for (std::size_t i = 0; i < factories.size(); ++i)
+            make_photo(i);
     }
 
     /*
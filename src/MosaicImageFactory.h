@@ -2,7 +2,7 @@
 /**
  * @file MosaicImageFactory.h
  *
- * Copyright (C) 2004, 2017, 2019  Ossama Othman
+ * Copyright (C) 2004, 2017, 2019, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: GPL-2.0-or-later
  *
@@ -67,7 +67,8 @@ namespace MaRC
 
         /// Create a @c MosaicImage.
         std::unique_ptr<SourceImage> make(
-            scale_offset_functor calc_so) override;
+            scale_offset_functor calc_so,
+            thread_pool & pool) override;
 
     private:
 
@@ -1,7 +1,7 @@
 /**
  * @file PhotoImageFactory.cpp
  *
- * Copyright (C) 2004, 2017-2020  Ossama Othman
+ * Copyright (C) 2004, 2017-2020, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: GPL-2.0-or-later
  *
@@ -38,6 +38,7 @@
 MaRC::PhotoImageFactory::PhotoImageFactory(char const * filename)
     : SourceImageFactory()
     , file_(filename)
+    , bands_(1)
     , flat_field_()
     , geometric_correction_(false)
     // , photometric_correction_(false)
@@ -89,26 +90,71 @@ MaRC::PhotoImageFactory::populate_parameters(
 }
 
 std::unique_ptr<MaRC::SourceImage>
-MaRC::PhotoImageFactory::make(scale_offset_functor /* calc_so */)
+MaRC::PhotoImageFactory::make(scale_offset_functor /* calc_so */,
+                              thread_pool & /* pool */)
 {
     if (!this->config_ || !this->geometry_)
         return nullptr;  // not set or make() already called!
 
-    std::vector<double> img;
     std::size_t samples = 0;
     std::size_t lines   = 0;
 
-    this->file_.read(img, samples, lines);
+    this->file_.dimensions(samples, lines);
+
+    // Make sure the non-nibbled window isn't empty before reading it.
+    this->config_->validate_parameters(samples, lines);
+
+    /*
+      Only read the non-nibbled window of the photo.  The nibble
+      values apply to the photo after it has been inverted, so
+      mirror the window in the FITS image accordingly.
+    */
+    std::size_t const window_samples =
+        samples
+        - this->config_->nibble_left()
+        - this->config_->nibble_right();
+
+    std::size_t const window_lines =
+        lines
+        - this->config_->nibble_top()
+        - this->config_->nibble_bottom();
+
+    std::size_t const left =
+        (this->invert_h_
+         ? this->config_->nibble_right()
+         : this->config_->nibble_left());
+
+    std::size_t const top =
+        (this->invert_v_
+         ? this->config_->nibble_bottom()
+         : this->config_->nibble_top());
+
+    PhotoImage::band_list_type bands;
+
+    this->file_.read(bands,
+                     left,
+                     top,
+                     window_samples,
+                     window_lines,
+                     this->bands_);
 
     // Perform flat fielding if a flat field file was provided.
-    this->flat_field_correct(img, samples, lines);
+    this->flat_field_correct(bands,
+                             samples,
+                             lines,
+                             left,
+                             top,
+                             window_samples,
+                             window_lines);
 
     // Invert image if desired.
-    if (this->invert_h_)
-        MaRC::invert_samples(img, samples, lines);
+    for (auto & img : bands) {
+        if (this->invert_h_)
+            MaRC::invert_samples(img, window_samples, window_lines);
 
-    if (this->invert_v_)
-        MaRC::invert_lines(img, samples, lines);
+        if (this->invert_v_)
+            MaRC::invert_lines(img, window_samples, window_lines);
+    }
 
     if (this->geometric_correction_) {
         this->geometry_->geometric_correction(
@@ -116,14 +162,20 @@ MaRC::PhotoImageFactory::make(scale_offset_functor /* calc_so */)
     }
 
     if (this->interpolate_) {
+        /*
+          The PhotoImage only holds the non-nibbled window, and
+          interpolates with pixel coordinates relative to it.
+        */
+        constexpr std::size_t no_nibble = 0;
+
         this->config_->interpolation_strategy(
             std::make_unique<BilinearInterpolation>(
-                samples,
-                lines,
-                this->config_->nibble_left(),
-                this->config_->nibble_right(),
-                this->config_->nibble_top(),
-                this->config_->nibble_bottom()));
+                window_samples,
+                window_lines,
+                no_nibble,
+                no_nibble,
+                no_nibble,
+                no_nibble));
     }
 
     /**
@@ -142,13 +194,40 @@ MaRC::PhotoImageFactory::make(scale_offset_functor /* calc_so */)
         this->maximum(*datamax);
 
     return
-        std::make_unique<MaRC::PhotoImage>(std::move(img),
+        std::make_unique<MaRC::PhotoImage>(std::move(bands),
                                            samples,
                                            lines,
                                            std::move(this->config_),
                                            std::move(this->geometry_));
 }
 
+void
+MaRC::PhotoImageFactory::hdu(int number)
+{
+    this->file_.hdu(number);
+}
+
+void
+MaRC::PhotoImageFactory::hdu(std::string const & extname)
+{
+    this->file_.hdu(extname);
+}
+
+void
+MaRC::PhotoImageFactory::plane(std::size_t number)
+{
+    this->file_.plane(number);
+}
+
+void
+MaRC::PhotoImageFactory::bands(std::size_t count)
+{
+    if (count == 0)
+        throw std::invalid_argument("Number of image bands is zero.");
+
+    this->bands_ = count;
+}
+
 void
 MaRC::PhotoImageFactory::flat_field(char const * name)
 {
@@ -189,9 +268,14 @@ MaRC::PhotoImageFactory::viewing_geometry(
 }
 
 void
-MaRC::PhotoImageFactory::flat_field_correct(std::vector<double> & img,
-                                            std::size_t samples,
-                                            std::size_t lines) const
+MaRC::PhotoImageFactory::flat_field_correct(
+    std::vector<std::vector<double>> & bands,
+    std::size_t samples,
+    std::size_t lines,
+    std::size_t left,
+    std::size_t top,
+    std::size_t region_samples,
+    std::size_t region_lines) const
 {
     if (this->flat_field_.empty())
         return;
@@ -206,7 +290,7 @@ MaRC::PhotoImageFactory::flat_field_correct(std::vector<double> & img,
         std::size_t f_samples = 0;
         std::size_t f_lines   = 0;
 
-        f.read(f_img, f_samples, f_lines);
+        f.dimensions(f_samples, f_lines);
 
         if (f_samples != samples || f_lines != lines) {
             auto s =
@@ -219,12 +303,16 @@ MaRC::PhotoImageFactory::flat_field_correct(std::vector<double> & img,
 
             throw std::runtime_error(s);
         }
+
+        f.read(f_img, left, top, region_samples, region_lines);
     }
 
     // Perform flat fielding.
-    std::size_t const size = img.size();
-    assert(size == f_img.size());
+    for (auto & img : bands) {
+        std::size_t const size = img.size();
+        assert(size == f_img.size());
 
-    for (std::size_t i = 0; i < size; ++i)
-        img[i] -= f_img[i];
+        for (std::size_t i = 0; i < size; ++i)
+            img[i] -= f_img[i];
+    }
 }
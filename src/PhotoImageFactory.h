@@ -2,7 +2,7 @@
 /**
  * @file PhotoImageFactory.h
  *
- * Copyright (C) 2004, 2017, 2019  Ossama Othman
+ * Copyright (C) 2004, 2017, 2019, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: GPL-2.0-or-later
  *
@@ -66,7 +66,52 @@ namespace MaRC
 
         /// Create a @c PhotoImage.
         std::unique_ptr<SourceImage> make(
-            scale_offset_functor calc_so) override;
+            scale_offset_functor calc_so,
+            thread_pool & pool) override;
+
+        /**
+         * @brief Select the photo image HDU by number.
+         *
+         * @param[in] number HDU number, where zero corresponds to
+         *                   the primary HDU.
+         *
+         * @see MaRC::FITS::input_file::hdu(int)
+         */
+        void hdu(int number);
+
+        /**
+         * @brief Select the photo image HDU by extension name.
+         *
+         * @param[in] extname %FITS image extension name.
+         *
+         * @see MaRC::FITS::input_file::hdu(std::string const &)
+         */
+        void hdu(std::string const & extname);
+
+        /**
+         * @brief Select the photo image plane in an image cube.
+         *
+         * @param[in] number Plane number, starting at one.
+         */
+        void plane(std::size_t number);
+
+        /**
+         * @brief Set the number of image planes to be mapped.
+         *
+         * Map @a count consecutive planes of an image cube,
+         * beginning with the selected plane, as bands of a single
+         * multi-band @c PhotoImage.  The bands share the same
+         * viewing geometry and body mask, and are mapped to
+         * separate map planes in a single pass.
+         *
+         * @param[in] count Number of planes, starting at one.
+         *
+         * @throw std::invalid_argument @a count is zero.
+         */
+        void bands(std::size_t count);
+
+        /// Number of map planes created from the @c PhotoImage.
+        std::size_t bands() const override { return this->bands_; }
 
         /// Set the flat field image filename.
         void flat_field(char const * name);
@@ -97,22 +142,41 @@ namespace MaRC
          * If a flat-field file was provided perform flat-field
          * correction on the photo image by substracting the
          * corresponding flat-field image elements from the photo
-         * image.
+         * image.  Only the region of the flat-field image
+         * corresponding to the region of the photo image that was
+         * read is used.  The same flat-field image is applied to
+         * every band.
          *
-         * @param[in,out] img     Image to be flat-field corrected.
-         * @param[in]     samples Number of samples in the image to be
-         *                        flat-field corrected.
-         * @param[in]     lines   Number of samples in the image to be
+         * @param[in,out] bands   Image region of each band to be
          *                        flat-field corrected.
+         * @param[in]     samples Number of samples in the entire
+         *                        photo image.
+         * @param[in]     lines   Number of lines in the entire photo
+         *                        image.
+         * @param[in]     left    First sample of the region in the
+         *                        photo image %FITS file.
+         * @param[in]     top     First line of the region in the
+         *                        photo image %FITS file.
+         * @param[in]     region_samples Number of samples in the
+         *                               region.
+         * @param[in]     region_lines   Number of lines in the
+         *                               region.
          */
-        void flat_field_correct(std::vector<double> & img,
+        void flat_field_correct(std::vector<std::vector<double>> & bands,
                                 std::size_t samples,
-                                std::size_t lines) const;
+                                std::size_t lines,
+                                std::size_t left,
+                                std::size_t top,
+                                std::size_t region_samples,
+                                std::size_t region_lines) const;
 
     private:
 
         /// %FITS file containing photo/image data.
-        FITS::input_file const file_;
+        FITS::input_file file_;
+
+        /// Number of image planes mapped as separate bands.
+        std::size_t bands_;
 
         /// Name of flat field image to be substracted from the
         /// photo/image containing the actual data.
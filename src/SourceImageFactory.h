@@ -2,7 +2,7 @@
 /**
  * @file SourceImageFactory.h
  *
- * Copyright (C) 2004, 2017, 2019-2020  Ossama Othman
+ * Copyright (C) 2004, 2017, 2019-2020, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: GPL-2.0-or-later
  *
@@ -14,6 +14,7 @@
 
 #include <memory>
 #include <functional>
+#include <cstddef>
 
 #include <marc/extrema.h>
 
@@ -22,6 +23,7 @@ namespace MaRC
 {
     class SourceImage;
     class map_parameters;
+    class thread_pool;
 
     /**
      * @class SourceImageFactory
@@ -92,12 +94,29 @@ namespace MaRC
          *                    prevent @c ImageFactory from having a
          *                    compile-time dependency on the map data
          *                    type.
+         * @param[in] pool    Threads shared by the map command that
+         *                    may be used to create the
+         *                    @c SourceImage, rather than starting
+         *                    new ones.  It may be in use by other
+         *                    threads at the same time.
          *
          * @return @c SourceImage from which map data will be
          *         sourced.
          */
         virtual std::unique_ptr<SourceImage> make(
-            scale_offset_functor calc_so) = 0;
+            scale_offset_functor calc_so,
+            thread_pool & pool) = 0;
+
+        /**
+         * @brief Number of map planes created from the
+         *        @c SourceImage.
+         *
+         * Each band of a multi-band @c SourceImage is mapped to a
+         * separate map plane.
+         *
+         * @see MaRC::SourceImage::bands()
+         */
+        virtual std::size_t bands() const { return 1; }
 
         /**
          * @brief Set the minimum physical data value.
@@ -1,7 +1,7 @@
 /**
  * @file command_line.cpp
  *
- * Copyright (C) 2018  Ossama Othman
+ * Copyright (C) 2018, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: GPL-2.0-or-later
  *
@@ -13,14 +13,16 @@
 #include <marc/config.h>
 
 #include <cassert>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
 
 #ifdef HAVE_ARGP
 # include <argp.h>
 #else
 # include <algorithm>
 # include <iostream>
-# include <cstring>
-# include <cstdlib>
 # ifdef HAVE_SYSEXITS_H
 #   include <sysexits.h>
 # else
@@ -36,19 +38,249 @@ namespace
     constexpr char const doc[] =
         "Create map projections based on information in given input files.";
 
+    /**
+     * @brief Convert a count command line argument.
+     *
+     * @param[in]  arg     Count command line argument.
+     * @param[in]  minimum Smallest valid count.
+     * @param[out] count   Converted count.
+     *
+     * @return @c true on successful conversion, and @c false
+     *         otherwise.
+     */
+    bool to_count(char const * arg, long minimum, std::size_t & count)
+    {
+        constexpr int base = 10;
+
+        errno = 0;
+
+        char * end = nullptr;
+        auto const n = std::strtol(arg, &end, base);
+
+        if (errno != 0 || end == arg || *end != '\0' || n < minimum)
+            return false;
+
+        count = static_cast<std::size_t>(n);
+
+        return true;
+    }
+
+    /// Smallest number of source images prefetched, i.e. none.
+    constexpr long min_lookahead = 0;
+
+    /// Smallest number of source images mapped in a map traversal.
+    constexpr long min_batch = 1;
+
+    /**
+     * @brief Convert compression tile size command line argument.
+     *
+     * @param[in]     arg Tile size command line argument of the
+     *                    form "SAMPLESxLINES".
+     * @param[in,out] c   Compression parameters containing the tile
+     *                    size.  Compression is enabled on successful
+     *                    conversion.
+     *
+     * @return @c true on successful conversion, and @c false
+     *         otherwise.
+     */
+    bool to_tile(char const * arg,
+                 MaRC::FITS::compression_parameters & c)
+    {
+        constexpr int base = 10;
+
+        errno = 0;
+
+        char * end = nullptr;
+        auto const samples = std::strtol(arg, &end, base);
+
+        if (errno != 0 || end == arg || *end != 'x' || samples < 1)
+            return false;
+
+        char const * const l = end + 1;
+        auto const lines = std::strtol(l, &end, base);
+
+        if (errno != 0 || end == l || *end != '\0' || lines < 1)
+            return false;
+
+        c.enabled      = true;
+        c.tile_samples = samples;
+        c.tile_lines   = lines;
+
+        return true;
+    }
+
+    /**
+     * @brief Convert floating point quantization level command line
+     *        argument.
+     *
+     * @param[in]     arg Quantization level command line argument.
+     * @param[in,out] c   Compression parameters containing the
+     *                    quantization level.  Compression is enabled
+     *                    on successful conversion.
+     *
+     * @return @c true on successful conversion, and @c false
+     *         otherwise.
+     */
+    bool to_quantize(char const * arg,
+                     MaRC::FITS::compression_parameters & c)
+    {
+        errno = 0;
+
+        char * end = nullptr;
+        auto const q = std::strtof(arg, &end);
+
+        if (errno != 0 || end == arg || *end != '\0' || !std::isfinite(q))
+            return false;
+
+        c.enabled  = true;
+        c.quantize = q;
+
+        return true;
+    }
+
+    /**
+     * @brief Convert map coordinate tolerance command line argument.
+     *
+     * @param[in]  arg       Tolerance command line argument in km.
+     * @param[out] tolerance Accuracy of interpolated map coordinates.
+     *
+     * @return @c true on successful conversion, and @c false
+     *         otherwise.
+     */
+    bool to_tolerance(char const * arg, double & tolerance)
+    {
+        errno = 0;
+
+        char * end = nullptr;
+        auto const km = std::strtod(arg, &end);
+
+        if (errno != 0 || end == arg || *end != '\0'
+            || !std::isfinite(km) || km < 0)
+            return false;
+
+        tolerance = km;
+
+        return true;
+    }
+
+    /**
+     * @brief Convert transcendental math mode command line argument.
+     *
+     * @param[in]  arg  Math mode command line argument, either
+     *                  "exact" or "fast".
+     * @param[out] mode Transcendental math implementation.
+     *
+     * @return @c true on successful conversion, and @c false
+     *         otherwise.
+     */
+    bool to_math_mode(char const * arg, MaRC::math_mode & mode)
+    {
+        if (strcmp(arg, "exact") == 0)
+            mode = MaRC::math_mode::exact;
+        else if (strcmp(arg, "fast") == 0)
+            mode = MaRC::math_mode::fast;
+        else
+            return false;
+
+        return true;
+    }
+
 #ifdef HAVE_ARGP
+    /**
+     * @struct parse_state
+     *
+     * @brief Storage for parsed command line arguments.
+     */
+    struct parse_state
+    {
+        /// %MaRC input filenames.
+        MaRC::command_line::arguments * files;
+
+        /// Number of map planes to prefetch.
+        std::size_t * lookahead;
+
+        /// Number of source images mapped in each map traversal.
+        std::size_t * batch;
+
+        /// Map image compression parameters.
+        MaRC::FITS::compression_parameters * compression;
+
+        /// Only traverse map regions covered by source images.
+        bool * source_driven;
+
+        /// Accuracy of interpolated map coordinates in km.
+        double * coordinate_tolerance;
+
+        /// Transcendental math implementation.
+        MaRC::math_mode * math;
+
+        /// Name of the resampling plan file.
+        std::string * resampling_plan;
+    };
+
+    /**
+     * @name Long-only Option Keys
+     *
+     * Keys for command line options without a short option.
+     */
+    ///@{
+    constexpr int lookahead_key = 256;
+    constexpr int compress_key  = 257;
+    constexpr int tile_key      = 258;
+    constexpr int quantize_key  = 259;
+    constexpr int source_driven_key = 260;
+    constexpr int tolerance_key     = 261;
+    constexpr int math_key          = 262;
+    constexpr int batch_key         = 263;
+    constexpr int plan_key          = 264;
+    ///@}
+
     error_t
-    parse_opt(int key, char * /* arg */, argp_state * state)
+    parse_opt(int key, char * arg, argp_state * state)
     {
-        auto const f =
-            static_cast<MaRC::command_line::arguments *>(state->input);
+        auto const p = static_cast<parse_state *>(state->input);
 
-        assert(f != nullptr);
+        assert(p != nullptr);
 
         switch(key) {
+        case lookahead_key:
+            if (!to_count(arg, min_lookahead, *p->lookahead))
+                argp_error(state, "invalid lookahead: %s", arg);
+            break;
+        case batch_key:
+            if (!to_count(arg, min_batch, *p->batch))
+                argp_error(state, "invalid batch size: %s", arg);
+            break;
+        case compress_key:
+            p->compression->enabled = true;
+            break;
+        case tile_key:
+            if (!to_tile(arg, *p->compression))
+                argp_error(state, "invalid tile size: %s", arg);
+            break;
+        case quantize_key:
+            if (!to_quantize(arg, *p->compression))
+                argp_error(state, "invalid quantization level: %s", arg);
+            break;
+        case source_driven_key:
+            *p->source_driven = true;
+            break;
+        case tolerance_key:
+            if (!to_tolerance(arg, *p->coordinate_tolerance))
+                argp_error(state, "invalid coordinate tolerance: %s", arg);
+            break;
+        case math_key:
+            if (!to_math_mode(arg, *p->math))
+                argp_error(state, "invalid math mode: %s", arg);
+            break;
+        case plan_key:
+            if (*arg == '\0')
+                argp_error(state, "empty resampling plan file name");
+            *p->resampling_plan = arg;
+            break;
         case ARGP_KEY_ARGS:
-            f->args(state->argc - state->next,
-                    state->argv + state->next);
+            p->files->args(state->argc - state->next,
+                           state->argv + state->next);
             break;
         case ARGP_KEY_NO_ARGS:
             argp_usage(state);
@@ -61,6 +293,70 @@ namespace
     }
 
     argp_option const options[] = {
+        { "lookahead",   // name
+          lookahead_key, // key
+          "IMAGES",      // arg
+          0,             // flags
+          "Number of upcoming source images to prepare in the "
+          "background while the current batch is mapped "
+          "(default: 0)",  // doc
+          0 },           // group
+        { "batch",       // name
+          batch_key,     // key
+          "IMAGES",      // arg
+          0,             // flags
+          "Number of source images mapped together in a single "
+          "map traversal (default: 1)",  // doc
+          0 },           // group
+        { "compress",    // name
+          compress_key,  // key
+          nullptr,       // arg
+          0,             // flags
+          "Tile compress map FITS images",  // doc
+          0 },           // group
+        { "tile",        // name
+          tile_key,      // key
+          "SAMPLESxLINES", // arg
+          0,             // flags
+          "Compressed image tile size, implies --compress "
+          "(default: one map line per tile)",  // doc
+          0 },           // group
+        { "quantize",    // name
+          quantize_key,  // key
+          "LEVEL",       // arg
+          0,             // flags
+          "Floating point map quantization level, implies "
+          "--compress (default: 0, lossless)",  // doc
+          0 },           // group
+        { "source-driven",  // name
+          source_driven_key, // key
+          nullptr,       // arg
+          0,             // flags
+          "Only traverse map regions covered by source images",  // doc
+          0 },           // group
+        { "coordinate-tolerance",  // name
+          tolerance_key, // key
+          "KM",          // arg
+          0,             // flags
+          "Interpolate map coordinates where accurate to within KM "
+          "kilometers (default: 0, exact)",  // doc
+          0 },           // group
+        { "math",        // name
+          math_key,      // key
+          "MODE",        // arg
+          0,             // flags
+          "Transcendental math used by the orthographic and polar "
+          "stereographic inverse projection equations, \"exact\" or "
+          "\"fast\" (default: exact).  Source image and body "
+          "computations always use exact math",  // doc
+          0 },           // group
+        { "resampling-plan",  // name
+          plan_key,      // key
+          "FILE",        // arg
+          0,             // flags
+          "Map photos through the resampling plans in FILE, "
+          "recording them first if FILE does not exist",  // doc
+          0 },           // group
         { nullptr,  // name
           0,        // key
           nullptr,  // arg
@@ -104,12 +400,23 @@ MaRC::command_line::parse(int argc, char * argv[])
     ::argp_program_version     = PACKAGE_STRING;
     ::argp_program_bug_address = "<" PACKAGE_BUGREPORT ">";
 
+    parse_state state = {
+        &this->files_,
+        &this->lookahead_,
+        &this->batch_,
+        &this->compression_,
+        &this->source_driven_,
+        &this->coordinate_tolerance_,
+        &this->math_,
+        &this->resampling_plan_
+    };
+
     return argp_parse(&the_argp,
                       argc,
                       argv,
                       0,          // flags
                       nullptr,    // arg_index
-                      &this->files_) == 0;
+                      &state) == 0;
 #else
     // No Argp support.  Fall back on basic argument parsing loop.
     constexpr char const try_message[] =
@@ -149,7 +456,15 @@ MaRC::command_line::parse(int argc, char * argv[])
 
                 // Dump full usage message.
                 std::cout << "Usage: " PACKAGE " "
-                          << "[-?V] [--help] [--usage] [--version] "
+                          << "[-?V] [--lookahead=IMAGES] "
+                          << "[--batch=IMAGES] [--compress]\n"
+                          << "            [--tile=SAMPLESxLINES] "
+                          << "[--quantize=LEVEL] [--source-driven]\n"
+                          << "            [--coordinate-tolerance=KM] "
+                          << "[--math=MODE]\n"
+                          << "            [--resampling-plan=FILE] "
+                          << "[--help] [--usage] [--version]\n"
+                          << "            "
                           << args_doc << '\n';
 
                 exit(EXIT_SUCCESS);
@@ -159,12 +474,124 @@ MaRC::command_line::parse(int argc, char * argv[])
                 std::cout << "Usage: " PACKAGE " [OPTION...] "
                           << args_doc << '\n'
                           << doc << "\n\n"
+                          << "      --lookahead=IMAGES\tNumber of upcoming "
+                             "source images to\n"
+                             "\t\t\tprepare in the background while "
+                             "the\n"
+                             "\t\t\tcurrent batch is mapped (default: "
+                             "0)\n"
+                          << "      --batch=IMAGES\tNumber of source "
+                             "images mapped together\n"
+                             "\t\t\tin a single map traversal "
+                             "(default: 1)\n"
+                          << "      --compress\t\tTile compress map FITS "
+                             "images\n"
+                          << "      --tile=SAMPLESxLINES\tCompressed image "
+                             "tile size, implies\n"
+                             "\t\t\t--compress (default: one map line per "
+                             "tile)\n"
+                          << "      --quantize=LEVEL\tFloating point map "
+                             "quantization level,\n"
+                             "\t\t\timplies --compress (default: 0, "
+                             "lossless)\n"
+                          << "      --source-driven\tOnly traverse map "
+                             "regions covered by\n"
+                             "\t\t\tsource images\n"
+                          << "      --coordinate-tolerance=KM\tInterpolate "
+                             "map coordinates where\n"
+                             "\t\t\taccurate to within KM kilometers\n"
+                             "\t\t\t(default: 0, exact)\n"
+                          << "      --math=MODE\t\tTranscendental math "
+                             "used by the\n"
+                             "\t\t\torthographic and polar "
+                             "stereographic\n"
+                             "\t\t\tinverse projection equations,\n"
+                             "\t\t\t\"exact\" or \"fast\" (default: "
+                             "exact).\n"
+                             "\t\t\tSource image and body computations\n"
+                             "\t\t\talways use exact math\n"
+                          << "      --resampling-plan=FILE\tMap photos "
+                             "through the\n"
+                             "\t\t\tresampling plans in FILE, "
+                             "recording\n"
+                             "\t\t\tthem first if FILE does not exist\n"
                           << "  -?, --help\t\tGive this help list\n"
                              "      --usage\t\tGive a short usage message\n"
                              "  -V, --version\t\tPrint program version\n\n"
                     " Report bugs to < " PACKAGE_BUGREPORT ">.\n";
 
                     exit(EXIT_SUCCESS);
+            } else if (strncmp(*arg, "--lookahead=", 12) == 0) {
+                if (!to_count(*arg + 12, min_lookahead, this->lookahead_)) {
+                    std::cerr
+                        << argv[0]
+                        << ": invalid lookahead: " << (*arg + 12) << '\n'
+                        << try_message;
+
+                    exit(EX_USAGE);
+                }
+            } else if (strncmp(*arg, "--batch=", 8) == 0) {
+                if (!to_count(*arg + 8, min_batch, this->batch_)) {
+                    std::cerr
+                        << argv[0]
+                        << ": invalid batch size: " << (*arg + 8) << '\n'
+                        << try_message;
+
+                    exit(EX_USAGE);
+                }
+            } else if (strcmp(*arg, "--compress") == 0) {
+                this->compression_.enabled = true;
+            } else if (strncmp(*arg, "--tile=", 7) == 0) {
+                if (!to_tile(*arg + 7, this->compression_)) {
+                    std::cerr
+                        << argv[0]
+                        << ": invalid tile size: " << (*arg + 7) << '\n'
+                        << try_message;
+
+                    exit(EX_USAGE);
+                }
+            } else if (strncmp(*arg, "--quantize=", 11) == 0) {
+                if (!to_quantize(*arg + 11, this->compression_)) {
+                    std::cerr
+                        << argv[0]
+                        << ": invalid quantization level: "
+                        << (*arg + 11) << '\n'
+                        << try_message;
+
+                    exit(EX_USAGE);
+                }
+            } else if (strcmp(*arg, "--source-driven") == 0) {
+                this->source_driven_ = true;
+            } else if (strncmp(*arg, "--coordinate-tolerance=", 23) == 0) {
+                if (!to_tolerance(*arg + 23, this->coordinate_tolerance_)) {
+                    std::cerr
+                        << argv[0]
+                        << ": invalid coordinate tolerance: "
+                        << (*arg + 23) << '\n'
+                        << try_message;
+
+                    exit(EX_USAGE);
+                }
+            } else if (strncmp(*arg, "--math=", 7) == 0) {
+                if (!to_math_mode(*arg + 7, this->math_)) {
+                    std::cerr
+                        << argv[0]
+                        << ": invalid math mode: " << (*arg + 7) << '\n'
+                        << try_message;
+
+                    exit(EX_USAGE);
+                }
+            } else if (strncmp(*arg, "--resampling-plan=", 18) == 0) {
+                if ((*arg)[18] == '\0') {
+                    std::cerr
+                        << argv[0]
+                        << ": empty resampling plan file name\n"
+                        << try_message;
+
+                    exit(EX_USAGE);
+                }
+
+                this->resampling_plan_ = *arg + 18;
             } else if (strcmp(*arg, "--version") == 0
                        || strcmp(*arg, "-V") == 0) {
                 // Dump MaRC program version.
@@ -181,6 +608,9 @@ MaRC::command_line::parse(int argc, char * argv[])
             }
 
             end = std::rotate(arg, arg + 1, end);
+
+            // Examine the argument rotated into this position.
+            --arg;
         }
     }
 
@@ -3,7 +3,7 @@
  *
  * %MaRC command line option parsing.
  *
- * Copyright (C) 2018  Ossama Othman
+ * Copyright (C) 2018, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: GPL-2.0-or-later
  *
@@ -13,6 +13,13 @@
 #ifndef MARC_COMMAND_LINE_H
 #define MARC_COMMAND_LINE_H
 
+#include "FITS_file.h"
+
+#include <marc/fast_math.h>
+
+#include <string>
+#include <cstddef>
+
 
 namespace MaRC
 {
@@ -106,7 +113,16 @@ namespace MaRC
         };
 
         /// Constructor.
-        command_line() : files_() {}
+        command_line()
+            : files_()
+            , lookahead_(0)
+            , batch_(1)
+            , compression_()
+            , source_driven_(false)
+            , coordinate_tolerance_(0)
+            , math_(math_mode::exact)
+            , resampling_plan_()
+        {}
 
         /// Destructor.
         ~command_line() = default;
@@ -121,6 +137,34 @@ namespace MaRC
         /// Get container of %MaRC input filenames.
         auto const & files() const { return this->files_; }
 
+        /// Get number of map planes to prefetch.
+        std::size_t lookahead() const { return this->lookahead_; }
+
+        /// Get number of source images mapped in each map traversal.
+        std::size_t batch() const { return this->batch_; }
+
+        /// Get map image compression parameters.
+        auto const & compression() const { return this->compression_; }
+
+        /// Should only map regions covered by source images be
+        /// traversed?
+        bool source_driven() const { return this->source_driven_; }
+
+        /// Get the accuracy of interpolated map coordinates in km.
+        double coordinate_tolerance() const
+        {
+            return this->coordinate_tolerance_;
+        }
+
+        /// Get the transcendental math implementation.
+        math_mode math() const { return this->math_; }
+
+        /// Get the name of the resampling plan file, if any.
+        auto const & resampling_plan() const
+        {
+            return this->resampling_plan_;
+        }
+
     private:
 
         /**
@@ -128,6 +172,54 @@ namespace MaRC
          */
         arguments files_;
 
+        /**
+         * @brief Number of map planes to prefetch while mapping.
+         *
+         * @see @c MaRC::MapCommand::lookahead()
+         */
+        std::size_t lookahead_;
+
+        /**
+         * @brief Number of source images mapped in each map
+         *        traversal.
+         *
+         * @see @c MaRC::MapCommand::batch()
+         */
+        std::size_t batch_;
+
+        /// Map image tile compression parameters.
+        FITS::compression_parameters compression_;
+
+        /**
+         * @brief Only traverse map regions covered by source images.
+         *
+         * @see @c MaRC::MapCommand::source_driven()
+         */
+        bool source_driven_;
+
+        /**
+         * @brief Accuracy of interpolated map coordinates in km.
+         *
+         * @see @c MaRC::MapFactory::coordinate_tolerance()
+         */
+        double coordinate_tolerance_;
+
+        /**
+         * @brief Transcendental math implementation.
+         *
+         * @see @c MaRC::MapFactory::math()
+         */
+        math_mode math_;
+
+        /**
+         * @brief Name of the resampling plan file.
+         *
+         * No resampling plans are used if empty.
+         *
+         * @see @c MaRC::MapCommand::resampling_plans()
+         */
+        std::string resampling_plan_;
+
     };
 
 }
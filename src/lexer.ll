@@ -5,7 +5,7 @@
  * Scanner for %MaRC input files.  Requires GNU Flex 2.5.4a or
  * greater.
  *
- * Copyright (C) 1996-1999, 2004, 2017-2018  Ossama Othman
+ * Copyright (C) 1996-1999, 2004, 2017-2018, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: GPL-2.0-or-later
  *
@@ -170,6 +170,7 @@ void yyset_column(int, yyscan_t);
 "SINUSOID"      { return _SINUSOID; }
 
 "MAP"           { BEGIN(string); return _MAP; }
+"OUTPUT"        { BEGIN(string); return OUTPUT; }
 "AUTHOR"        { BEGIN(comment_init); return AUTHOR; }
 "ORIGIN"        { BEGIN(comment_init); return ORIGIN; }
 "COMMENT"       { BEGIN(comment_init); return _COMMENT; }
@@ -200,6 +201,7 @@ void yyset_column(int, yyscan_t);
 "POL_RAD"       { return POL_RAD; }
 "ROTATION"      { BEGIN(keyword_token); return ROTATION; }
 "IMAGE"         { BEGIN(string); return _IMAGE; }
+"SOURCE_MAP"    { BEGIN(string); return SOURCE_MAP; }
 "PHOTO"         { return _PHOTO; }
 "MU"            { BEGIN(keyword_token); return _MU; }
 "MU0"           { BEGIN(keyword_token); return _MU0; }
@@ -223,6 +225,10 @@ void yyset_column(int, yyscan_t);
 "STD_LAT_2"     { return STD_LAT_2; }
 "INTERPOLATE"   { BEGIN(keyword_token); return _INTERPOLATE; }
 "REMOVE_SKY"    { BEGIN(keyword_token); return _REMOVE_SKY; }
+"EXTENSION"     { return EXTENSION; }
+"EXTNAME"       { BEGIN(string); return EXTNAME; }
+"IMAGE_PLANE"   { return IMAGE_PLANE; }
+"BANDS"         { return BANDS; }
 "NIBBLE"        { return NIBBLE; }
 "NIBBLE_LEFT"   { return NIBBLE_LEFT; }
 "NIBBLE_RIGHT"  { return NIBBLE_RIGHT; }
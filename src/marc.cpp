@@ -1,7 +1,7 @@
 /**
  * @file marc.cpp
  *
- * Copyright (C) 1996-1999, 2004, 2017-2018  Ossama Othman
+ * Copyright (C) 1996-1999, 2004, 2017-2018, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: GPL-2.0-or-later
  *
@@ -14,11 +14,13 @@
 #include "parse.hh"
 #include "lexer.hh"
 #include "MapCommand.h"
+#include "resampling_plan_file.h"
 
 #include <marc/config.h>
 #include <marc/Log.h>
 
 #include <string>
+#include <memory>
 #include <array>  // For std::size().
 #include <cstdio>
 #include <cerrno>
@@ -222,7 +224,22 @@ int main(int argc, char *argv[])
         auto const & commands =
             parse_parameter.commands();
 
+        // Resampling plans are shared by all maps, in order.
+        std::shared_ptr<MaRC::resampling_plan_file> plans;
+
+        if (!cl.resampling_plan().empty())
+            plans = std::make_shared<MaRC::resampling_plan_file>(
+                cl.resampling_plan());
+
         for (auto & p : commands) {
+            p->lookahead(cl.lookahead());
+            p->batch(cl.batch());
+            p->compression(cl.compression());
+            p->source_driven(cl.source_driven());
+            p->coordinate_tolerance(cl.coordinate_tolerance());
+            p->math(cl.math());
+            p->resampling_plans(plans);
+
             if (p->execute() != 0) {
                 MaRC::error("problem during creation of map '{}'",
                             p->filename());
@@ -4,7 +4,7 @@
  *
  * Parser for %MaRC input files.  Requires GNU Bison 1.35 or greater.
  *
- * Copyright (C) 1999, 2004, 2017-2020  Ossama Othman
+ * Copyright (C) 1999, 2004, 2017-2020, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: GPL-2.0-or-later
  *
@@ -15,14 +15,12 @@
 // SourceImage factories
 #include "PhotoImageFactory.h"
 #include "MosaicImageFactory.h"
-#include "MuImageFactory.h"
-#include "Mu0ImageFactory.h"
-#include "CosPhaseImageFactory.h"
-#include "LatitudeImageFactory.h"
-#include "LongitudeImageFactory.h"
+#include "MapImageFactory.h"
+#include "BackplaneImageFactory.h"
 
 // BodyData strategies
 #include <marc/OblateSpheroid.h>
+#include <marc/Sphere.h>
 
 // Image parameters
 #include <marc/PhotoImageParameters.h>
@@ -51,7 +49,10 @@
 #include <stdexcept>
 #include <limits>
 #include <memory>
+#include <vector>
 #include <array>  // For std::size().
+#include <algorithm>
+#include <numeric>
 #include <cstring>
 #include <cerrno>
 #include <cmath>
@@ -323,6 +324,10 @@ using namespace MaRC;
 
 std::unique_ptr<MapFactory> map_factory;
 
+// Map files created from the same source images, beginning with the
+// map entry itself.
+std::vector<MaRC::MapCommand::output> map_outputs;
+
 // CFITSIO's "naxes" parameter is an array of long values.
 long map_samples = 0;
 long map_lines = 0;
@@ -336,6 +341,8 @@ std::unique_ptr<MaRC::PhotoImageFactory> photo_factory;
 MaRC::MosaicImageFactory::list_type photo_factories;
 MaRC::MosaicImageFactory::average_type averaging_type;
 
+std::unique_ptr<MaRC::MapImageFactory> source_map_factory;
+
 std::unique_ptr<MaRC::PhotoImageParameters> photo_parameters;
 std::unique_ptr<MaRC::ViewingGeometry> viewing_geometry;
 
@@ -477,6 +484,7 @@ using auto_free = std::unique_ptr<T, deallocate_with_free>;
 
 // Reserved input file keywords
 %token _MAP "MAP"
+%token OUTPUT
 %token AUTHOR ORIGIN XCOMMENT
 %token _COMMENT "COMMENT"
 %token _DATA_TYPE "DATA_TYPE"
@@ -489,6 +497,7 @@ using auto_free = std::unique_ptr<T, deallocate_with_free>;
 %token _NONE "NONE"
 %token OPTIONS EQ_RAD POL_RAD ROTATION
 %token _IMAGE "IMAGE"
+%token SOURCE_MAP
 %token _PHOTO "PHOTO"
 %token _MU "MU"
 %token _MU0 "MU0"
@@ -498,6 +507,7 @@ using auto_free = std::unique_ptr<T, deallocate_with_free>;
 %token LATITUDE_TYPE CENTRIC GRAPHIC
 %token LAT_AT_CENTER LON_AT_CENTER
 %token SAMPLE_OA LINE_OA STD_LAT STD_LAT_1 STD_LAT_2 MAX_LAT POLE
+%token EXTENSION EXTNAME IMAGE_PLANE BANDS
 %token NIBBLE NIBBLE_LEFT NIBBLE_RIGHT NIBBLE_TOP NIBBLE_BOTTOM
 %token INVERT HORIZONTAL VERTICAL BOTH
 %token _INTERPOLATE "INTERPOLATE"
@@ -570,7 +580,14 @@ map_setup:
         projection_type
         planes
         samples
-        lines
+        lines {
+            map_outputs.clear();
+            map_outputs.push_back({ std::move(map_filename),
+                                    map_samples,
+                                    map_lines,
+                                    std::move(map_factory) });
+        }
+        outputs
         plane {
             /*
               We only perform this check if the number of planes was
@@ -581,7 +598,20 @@ map_setup:
               Once support for the "PLANES" keyword is removed, this
               check can be removed.
             */
-            if (num_planes > 0 && image_factories.size() != num_planes) {
+            /*
+              Each band of a multi-band image is mapped to a separate
+              map plane.
+            */
+            std::size_t const map_planes =
+                std::accumulate(image_factories.cbegin(),
+                                image_factories.cend(),
+                                std::size_t(0),
+                                [](std::size_t n, auto const & f)
+                                {
+                                    return n + f->bands();
+                                });
+
+            if (num_planes > 0 && map_planes != num_planes) {
                 /**
                  * @todo Call yyerror() here instead, e.g.:
                  *       yyerror(&yylloc, scanner, pp,
@@ -589,18 +619,25 @@ map_setup:
                  */
                 MaRC::error("number of planes ({}) does not "
                             "match \"PLANES\" value ({})",
-                            image_factories.size(),
+                            map_planes,
                             num_planes);
                 YYERROR;
             } else {
+                auto o = map_outputs.begin();
+
                 auto command =
                     std::make_unique<MaRC::MapCommand>(
-                        std::move(map_filename),
-                        map_samples,
-                        map_lines,
-                        std::move(map_factory),
+                        std::move(o->filename),
+                        o->samples,
+                        o->lines,
+                        std::move(o->factory),
                         std::move(map_params));
 
+                for (++o; o != map_outputs.end(); ++o)
+                    command->add_output(std::move(*o));
+
+                map_outputs.clear();
+
                 if (create_grid)
                     command->grid_intervals(lat_interval, lon_interval);
 
@@ -632,6 +669,29 @@ map_entry:
         }
 ;
 
+outputs:
+        %empty
+        | outputs output
+;
+
+/*
+  Additional map file created from the same source images as the
+  map entry, but with a different projection or size.
+*/
+output:
+        OUTPUT ':' _STRING
+        projection_type
+        samples
+        lines {
+            auto_free<char> str($3);
+
+            map_outputs.push_back({ $3,
+                                    map_samples,
+                                    map_lines,
+                                    std::move(map_factory) });
+        }
+;
+
 author:
         %empty
         | AUTHOR ':' _STRING {
@@ -882,10 +942,16 @@ body:   BODY ':' _STRING
 
           ($4).validate();
 
-          oblate_spheroid =
-              std::make_shared<MaRC::OblateSpheroid>($5,
-                                                     ($4).eq_rad,
-                                                     ($4).pol_rad);
+          // Spheres have faster latitude conversions and
+          // photometric angle computations.
+          if (($4).eq_rad == ($4).pol_rad)
+              oblate_spheroid =
+                  std::make_shared<MaRC::Sphere>($5, ($4).eq_rad);
+          else
+              oblate_spheroid =
+                  std::make_shared<MaRC::OblateSpheroid>($5,
+                                                         ($4).eq_rad,
+                                                         ($4).pol_rad);
         }
 ;
 
@@ -956,13 +1022,43 @@ plane_setup:
         plane_size
         plane_data_range
         plane_type      {
-            if (minimum)
-                image_factory->minimum(*minimum);
+            auto const backplanes =
+                dynamic_cast<MaRC::BackplaneImageFactory *>(
+                    image_factory.get());
+
+            if (backplanes) {
+                // The extrema only apply to this backplane, not to
+                // the backplanes it may be merged with below.
+                backplanes->data_range(minimum, maximum);
+            } else {
+                if (minimum)
+                    image_factory->minimum(*minimum);
+
+                if (maximum)
+                    image_factory->maximum(*maximum);
+            }
 
-            if (maximum)
-                image_factory->maximum(*maximum);
+            /**
+             * @deprecated Remove once deprecated plane number support
+             *             is removed.
+             */
+            expected_plane += image_factory->bands() - 1;
+
+            /*
+              Compute consecutive backplanes in the same map
+              traversal by merging them into a single multi-band
+              source image.
+            */
+            auto const previous =
+                (image_factories.empty()
+                 ? nullptr
+                 : dynamic_cast<MaRC::BackplaneImageFactory *>(
+                     image_factories.back().get()));
 
-            image_factories.push_back(std::move(image_factory));
+            if (backplanes && previous && previous->merge(*backplanes))
+                image_factory.reset();
+            else
+                image_factories.push_back(std::move(image_factory));
 
             photo_factories.clear();
         }
@@ -1064,6 +1160,14 @@ plane_type:
             if (photo_factories.size() == 1) {
                 image_factory = std::move(photo_factories.back());
                 photo_factories.pop_back();
+            } else if (std::any_of(photo_factories.cbegin(),
+                                   photo_factories.cend(),
+                                   [](auto const & f)
+                                   {
+                                       return f->bands() > 1;
+                                   })) {
+                MaRC::error("multi-band images may not be mosaiced");
+                YYERROR;
             } else {
                 image_factory =
                     std::make_unique<MaRC::MosaicImageFactory>(
@@ -1076,6 +1180,82 @@ plane_type:
         | phase
         | lat_plane
         | lon_plane
+        | source_map
+;
+
+/* -------------------- SOURCE MAP SETUP -------------------- */
+source_map:
+        source_map_file
+        source_map_hdu
+        source_map_plane
+        source_map_interpolate
+        projection_type {
+            // Map data is located on the source map through the
+            // projection used to create it.
+            source_map_factory->projection(std::move(map_factory));
+
+            image_factory = std::move(source_map_factory);
+        }
+;
+
+source_map_file:
+        SOURCE_MAP ':' _STRING {
+            auto_free<char> str($3);
+
+            try {
+                source_map_factory =
+                    std::make_unique<MaRC::MapImageFactory>($3);
+            } catch (std::exception const & e) {
+                MaRC::error("{}", e.what());
+                YYERROR;
+            }
+        }
+;
+
+source_map_hdu:
+        %empty  // First image HDU in the source map file.
+        | EXTENSION ':' size {
+          if ($3 >= 0) {
+              try {
+                  source_map_factory->hdu(static_cast<int>($3));
+              } catch (std::exception const & e) {
+                  MaRC::error("{}", e.what());
+                  YYERROR;
+              }
+          } else {
+              MaRC::error("incorrect value for EXTENSION entered: {}", $3);
+              YYERROR;
+          }
+        }
+        | EXTNAME ':' _STRING {
+          auto_free<char> str($3);
+
+          try {
+              source_map_factory->hdu(std::string($3));
+          } catch (std::exception const & e) {
+              MaRC::error("{}", e.what());
+              YYERROR;
+          }
+        }
+;
+
+source_map_plane:
+        %empty  // First plane in the source map.
+        | IMAGE_PLANE ':' size {
+          if ($3 > 0) {
+              source_map_factory->plane($3);
+          } else {
+              MaRC::error("incorrect value for IMAGE_PLANE entered: {}",
+                          $3);
+              YYERROR;
+          }
+        }
+;
+
+source_map_interpolate:
+        %empty
+        | _INTERPOLATE ':' YES { source_map_factory->interpolate(true);  }
+        | _INTERPOLATE ':' NO  { source_map_factory->interpolate(false); }
 ;
 
 /* -------------------- INPUT IMAGE SETUP -------------------- */
@@ -1152,6 +1332,13 @@ image_setup:
 ;
 
 image_initialize:
+        image_file
+        image_hdu
+        image_plane
+        image_bands
+;
+
+image_file:
         // Parse input image filename and initialize PhotoImageFactory
         // object.
         _IMAGE ':' _STRING {
@@ -1177,6 +1364,58 @@ image_initialize:
         }
 ;
 
+image_hdu:
+        %empty  // First image HDU in the input image file.
+        | EXTENSION ':' size {
+          if ($3 >= 0) {
+              try {
+                  photo_factory->hdu(static_cast<int>($3));
+              } catch (std::exception const & e) {
+                  MaRC::error("{}", e.what());
+                  YYERROR;
+              }
+          } else {
+              MaRC::error("incorrect value for EXTENSION entered: {}", $3);
+              YYERROR;
+          }
+        }
+        | EXTNAME ':' _STRING {
+          auto_free<char> str($3);
+
+          try {
+              photo_factory->hdu(std::string($3));
+          } catch (std::exception const & e) {
+              MaRC::error("{}", e.what());
+              YYERROR;
+          }
+        }
+;
+
+image_plane:
+        %empty  // First plane in the input image.
+        | IMAGE_PLANE ':' size {
+          if ($3 > 0) {
+              photo_factory->plane($3);
+          } else {
+              MaRC::error("incorrect value for IMAGE_PLANE entered: {}",
+                          $3);
+              YYERROR;
+          }
+        }
+;
+
+image_bands:
+        %empty  // Only the selected plane in the input image.
+        | BANDS ':' size {
+          if ($3 > 0) {
+              photo_factory->bands($3);
+          } else {
+              MaRC::error("incorrect value for BANDS entered: {}", $3);
+              YYERROR;
+          }
+        }
+;
+
 nibbling:
         %empty
         | nibble
@@ -1314,22 +1553,28 @@ remove_sky:
 
 mu:    _MU ':' sub_observ range {
             // Mu (potentially scaled to increase significant digits)
-            image_factory =
-                std::make_unique<MaRC::MuImageFactory>(oblate_spheroid,
-                                                       ($3).lat,
-                                                       ($3).lon,
-                                                       $4);
+            auto factory =
+                std::make_unique<MaRC::BackplaneImageFactory>(
+                    oblate_spheroid,
+                    MaRC::BackplaneImageFactory::backplane::mu);
+
+            factory->sub_observ(($3).lat, ($3).lon, $4);
+
+            image_factory = std::move(factory);
         }
         | _MU ':'
           sub_observ
           range
           sub_solar /* Unused */ {
             // Mu (potentially scaled to increase significant digits)
-            image_factory =
-                std::make_unique<MaRC::MuImageFactory>(oblate_spheroid,
-                                                       ($3).lat,
-                                                       ($3).lon,
-                                                       $4);
+            auto factory =
+                std::make_unique<MaRC::BackplaneImageFactory>(
+                    oblate_spheroid,
+                    MaRC::BackplaneImageFactory::backplane::mu);
+
+            factory->sub_observ(($3).lat, ($3).lon, $4);
+
+            image_factory = std::move(factory);
 
             MaRC::info("sub-solar point is no longer needed for MU planes");
         }
@@ -1337,20 +1582,28 @@ mu:    _MU ':' sub_observ range {
 
 mu0:    _MU0 ':' sub_solar {
           // Mu0 (potentially scaled to increase significant digits)
-          image_factory =
-              std::make_unique<MaRC::Mu0ImageFactory>(oblate_spheroid,
-                                                      ($3).lat,
-                                                      ($3).lon);
+          auto factory =
+              std::make_unique<MaRC::BackplaneImageFactory>(
+                  oblate_spheroid,
+                  MaRC::BackplaneImageFactory::backplane::mu0);
+
+          factory->sub_solar(($3).lat, ($3).lon);
+
+          image_factory = std::move(factory);
         }
         | _MU0 ':'
         sub_observ      /* Unused */
         range           /* Unused */
         sub_solar       {
           // Mu0 (potentially scaled to increase significant digits)
-          image_factory =
-              std::make_unique<MaRC::Mu0ImageFactory>(oblate_spheroid,
-                                                      ($5).lat,
-                                                      ($5).lon);
+          auto factory =
+              std::make_unique<MaRC::BackplaneImageFactory>(
+                  oblate_spheroid,
+                  MaRC::BackplaneImageFactory::backplane::mu0);
+
+          factory->sub_solar(($5).lat, ($5).lon);
+
+          image_factory = std::move(factory);
 
           MaRC::info("sub-observer point and range are no longer "
                      "needed for MU0 planes");
@@ -1360,23 +1613,29 @@ mu0:    _MU0 ':' sub_solar {
 phase:  _PHASE ':' sub_observ range sub_solar {
           // cos(phase angle) (potentially scaled to increase
           //                   significant digits)
-          image_factory =
-              std::make_unique<MaRC::CosPhaseImageFactory>(
+          auto factory =
+              std::make_unique<MaRC::BackplaneImageFactory>(
                   oblate_spheroid,
-                  ($3).lat,
-                  ($3).lon,
-                  ($5).lat,
-                  ($5).lon,
-                  $4);
+                  MaRC::BackplaneImageFactory::backplane::cos_phase);
+
+          factory->sub_observ(($3).lat, ($3).lon, $4);
+          factory->sub_solar(($5).lat, ($5).lon);
+
+          image_factory = std::move(factory);
         }
 ;
 
 lat_plane: LATITUDE ':' lat_type {
             // Latitudes in degrees (potentially scaled to increase
             //                       significant digits)
+            using backplane = MaRC::BackplaneImageFactory::backplane;
+
             image_factory =
-                std::make_unique<MaRC::LatitudeImageFactory>(
-                    oblate_spheroid, graphic_lat);
+                std::make_unique<MaRC::BackplaneImageFactory>(
+                    oblate_spheroid,
+                    graphic_lat
+                    ? backplane::graphic_latitude
+                    : backplane::latitude);
            }
 ;
 
@@ -1385,7 +1644,9 @@ lon_plane: LONGITUDE {
             // Longitudes in degrees (potentially scaled to increase
             //                        significant digits)
             image_factory =
-                std::make_unique<MaRC::LongitudeImageFactory>();
+                std::make_unique<MaRC::BackplaneImageFactory>(
+                    oblate_spheroid,
+                    MaRC::BackplaneImageFactory::backplane::longitude);
            }
 ;
 
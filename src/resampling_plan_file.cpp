@@ -0,0 +1,78 @@
+/**
+ * @file resampling_plan_file.cpp
+ *
+ * Copyright (C) 2026  Ossama Othman
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * @author Ossama Othman
+ */
+
+#include "resampling_plan_file.h"
+
+#include <marc/MapFactory.h>
+#include <marc/SourceImage.h>
+#include <marc/details/format.h>
+
+#include <stdexcept>
+
+
+MaRC::resampling_plan_file::resampling_plan_file(
+    std::string const & filename)
+    : filename_(filename)
+    , in_(filename, std::ios::binary)
+    , out_()
+{
+    if (this->in_.is_open())
+        return;  // Reuse previously recorded plans.
+
+    this->out_.open(filename, std::ios::binary | std::ios::trunc);
+
+    if (!this->out_.is_open())
+        throw std::runtime_error(
+            fmt::format("Unable to open resampling plan file \"{}\".",
+                        filename));
+}
+
+MaRC::ResamplingPlan
+MaRC::resampling_plan_file::next(MapFactory const & factory,
+                                 SourceImage const & image,
+                                 std::size_t samples,
+                                 std::size_t lines)
+{
+    if (this->recording()) {
+        auto plan = factory.make_plan(image, samples, lines);
+
+        try {
+            plan.save(this->out_);
+            this->out_.flush();
+        } catch (std::runtime_error const &) {
+            throw std::runtime_error(
+                fmt::format("Unable to write resampling plan to \"{}\".",
+                            this->filename_));
+        }
+
+        return plan;
+    }
+
+    ResamplingPlan plan;
+
+    try {
+        plan = ResamplingPlan::load(this->in_);
+    } catch (std::runtime_error const & e) {
+        throw std::runtime_error(
+            fmt::format("\"{}\": {}", this->filename_, e.what()));
+    }
+
+    if (plan.samples() != samples
+        || plan.lines() != lines
+        || plan.sources() != image.resampling_sources().size())
+        throw std::runtime_error(
+            fmt::format("Resampling plan in \"{}\" does not match the "
+                        "{}x{} map and source image being mapped.",
+                        this->filename_,
+                        samples,
+                        lines));
+
+    return plan;
+}
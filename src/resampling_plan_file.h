@@ -0,0 +1,108 @@
+// -*- C++ -*-
+/**
+ * @file resampling_plan_file.h
+ *
+ * Copyright (C) 2026  Ossama Othman
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * @author Ossama Othman
+ */
+
+#ifndef MARC_RESAMPLING_PLAN_FILE_H
+#define MARC_RESAMPLING_PLAN_FILE_H
+
+#include <marc/ResamplingPlan.h>
+
+#include <fstream>
+#include <string>
+#include <cstddef>
+
+
+namespace MaRC
+{
+    class MapFactory;
+    class SourceImage;
+
+    /**
+     * @class resampling_plan_file
+     *
+     * @brief File of resampling plans reused across runs.
+     *
+     * Maps of images in a time series with the same viewing
+     * geometry, image dimensions and map configuration differ only
+     * in their source image data.  The first run records the
+     * resampling plan of each source image in the file, in the
+     * order the images are mapped.  Later runs read those plans
+     * back, and map the images through them rather than through the
+     * map projection and viewing geometry.
+     *
+     * @note Only the number of source images and the map dimensions
+     *       are checked against the recorded plans.  The viewing
+     *       geometry and map configuration must match those of the
+     *       run that recorded the plans.
+     *
+     * @see @c MaRC::ResamplingPlan
+     */
+    class resampling_plan_file
+    {
+    public:
+
+        /// Constructor.
+        /**
+         * @param[in] filename Name of the resampling plan file.
+         *                     Plans are read from the file if it
+         *                     exists, and recorded in it otherwise.
+         *
+         * @throw std::runtime_error Unable to open the file.
+         */
+        explicit resampling_plan_file(std::string const & filename);
+
+        // Disallow copying.
+        resampling_plan_file(resampling_plan_file const &) = delete;
+        resampling_plan_file & operator=(
+            resampling_plan_file const &) = delete;
+
+        /// Destructor.
+        ~resampling_plan_file() = default;
+
+        /// Are plans being recorded rather than read?
+        bool recording() const { return this->out_.is_open(); }
+
+        /**
+         * @brief Get the plan of the next source image.
+         *
+         * @param[in] factory Map projection of the map.
+         * @param[in] image   Source image to be mapped.
+         * @param[in] samples Number of samples in the map.
+         * @param[in] lines   Number of lines   in the map.
+         *
+         * @return Plan read from the file, or the plan made from
+         *         @a image and recorded in the file.
+         *
+         * @throw std::runtime_error Unable to read or record the
+         *                           plan, or the plan read from the
+         *                           file does not match @a image or
+         *                           the map dimensions.
+         */
+        ResamplingPlan next(MapFactory const & factory,
+                            SourceImage const & image,
+                            std::size_t samples,
+                            std::size_t lines);
+
+    private:
+
+        /// Name of the resampling plan file.
+        std::string const filename_;
+
+        /// Stream from which recorded plans are read.
+        std::ifstream in_;
+
+        /// Stream to which new plans are recorded.
+        std::ofstream out_;
+
+    };
+
+}
+
+#endif  /* MARC_RESAMPLING_PLAN_FILE_H */
@@ -0,0 +1,144 @@
+/**
+ * @file thread_pool.cpp
+ *
+ * Copyright (C) 2026  Ossama Othman
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * @author Ossama Othman
+ */
+
+#include "thread_pool.h"
+
+#include <algorithm>
+
+
+MaRC::thread_pool::thread_pool(std::size_t threads)
+    : threads_()
+    , lock_()
+    , work_()
+    , done_()
+    , pending_()
+    , stop_(false)
+{
+    if (threads == 0)
+        threads = std::thread::hardware_concurrency();
+
+    // No need for worker threads if tasks run on the calling thread.
+    if (threads < 2)
+        return;
+
+    this->threads_.reserve(threads);
+
+    for (std::size_t i = 0; i < threads; ++i)
+        this->threads_.emplace_back(&thread_pool::work, this);
+}
+
+MaRC::thread_pool::~thread_pool()
+{
+    {
+        std::lock_guard<std::mutex> guard(this->lock_);
+        this->stop_ = true;
+    }
+
+    this->work_.notify_all();
+
+    for (auto & t : this->threads_)
+        t.join();
+}
+
+std::size_t
+MaRC::thread_pool::size() const
+{
+    return this->threads_.empty() ? 1 : this->threads_.size();
+}
+
+void
+MaRC::thread_pool::run(std::size_t count, task_type const & task)
+{
+    if (this->threads_.empty() || count < 2) {
+        // Run the tasks in order on this thread.
+        for (std::size_t i = 0; i < count; ++i)
+            task(i);
+
+        return;
+    }
+
+    batch b { task, count, 0, 0, std::vector<std::exception_ptr>(count) };
+
+    std::unique_lock<std::mutex> guard(this->lock_);
+
+    this->pending_.push_back(&b);
+
+    this->work_.notify_all();
+
+    /*
+      Run tasks in our own batch rather than only waiting for the
+      worker threads, so that the batch completes even if all of
+      them are busy, e.g. blocked in tasks that themselves wait for
+      this batch.
+    */
+    while (b.next < b.count)
+        this->run_next(b, guard);
+
+    // Wait for the tasks started by the worker threads.
+    this->done_.wait(guard,
+                     [&b]()
+                     {
+                         return b.completed == b.count;
+                     });
+
+    guard.unlock();
+
+    for (auto const & e : b.errors)
+        if (e)
+            std::rethrow_exception(e);
+}
+
+void
+MaRC::thread_pool::run_next(batch & b, std::unique_lock<std::mutex> & guard)
+{
+    auto const index = b.next++;
+
+    // All tasks in the batch have been started.
+    if (b.next == b.count)
+        this->pending_.erase(std::find(this->pending_.begin(),
+                                       this->pending_.end(),
+                                       &b));
+
+    guard.unlock();
+
+    std::exception_ptr error;
+
+    try {
+        b.task(index);
+    } catch (...) {
+        error = std::current_exception();
+    }
+
+    guard.lock();
+
+    b.errors[index] = error;
+
+    if (++b.completed == b.count)
+        this->done_.notify_all();
+}
+
+void
+MaRC::thread_pool::work()
+{
+    std::unique_lock<std::mutex> guard(this->lock_);
+
+    for (;;) {
+        this->work_.wait(guard,
+                         [this]()
+                         {
+                             return this->stop_ || !this->pending_.empty();
+                         });
+
+        if (this->pending_.empty())
+            break;  // Shutting down, and no tasks to run.
+
+        this->run_next(*this->pending_.front(), guard);
+    }
+}
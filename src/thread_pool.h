@@ -0,0 +1,162 @@
+// -*- C++ -*-
+/**
+ * @file thread_pool.h
+ *
+ * Copyright (C) 2026  Ossama Othman
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * @author Ossama Othman
+ */
+
+#ifndef MARC_THREAD_POOL_H
+#define MARC_THREAD_POOL_H
+
+#include <vector>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <exception>
+#include <cstddef>
+
+
+namespace MaRC
+{
+
+    /**
+     * @class thread_pool
+     *
+     * @brief Fixed size pool of worker threads.
+     *
+     * Run batches of independent tasks on a fixed set of worker
+     * threads.  Each task in a batch is identified by its index in
+     * the batch, allowing tasks to store their results in
+     * pre-allocated, index-addressed storage so that the order of
+     * results is deterministic regardless of the order in which the
+     * tasks complete.
+     *
+     * Batches may be run concurrently from several threads, and
+     * from tasks running in the pool.  Worker threads run the tasks
+     * of pending batches in the order the batches were submitted,
+     * and each calling thread also runs the tasks of its own batch.
+     * A batch therefore always makes progress, even if all worker
+     * threads are busy with other batches or blocked in a nested
+     * batch.
+     */
+    class thread_pool
+    {
+    public:
+
+        /**
+         * @brief Batch task type.
+         *
+         * @param[in] index Index of the task in the batch.
+         */
+        using task_type = std::function<void(std::size_t index)>;
+
+        /// Constructor.
+        /**
+         * @param[in] threads Number of worker threads.  The number
+         *                    of concurrent threads supported by the
+         *                    hardware will be used if zero.  Tasks
+         *                    are run on the calling thread if one.
+         */
+        explicit thread_pool(std::size_t threads = 0);
+
+        // Disallow copying.
+        thread_pool(thread_pool const &) = delete;
+        thread_pool & operator=(thread_pool const &) = delete;
+
+        /// Destructor.
+        ~thread_pool();
+
+        /// Number of threads running tasks.
+        std::size_t size() const;
+
+        /**
+         * @brief Run a batch of tasks, and wait for completion.
+         *
+         * The calling thread runs tasks in the batch alongside the
+         * worker threads.  This may be called concurrently from
+         * several threads, including from tasks running in the
+         * pool.
+         *
+         * @param[in] count Number of tasks in the batch.
+         * @param[in] task  Task to be run with each index in the
+         *                  range [0, @a count).  It must be safe
+         *                  to run concurrently with itself.
+         *
+         * @throw Rethrows the exception thrown by the task with the
+         *        lowest index, if any.  All tasks are run
+         *        regardless.
+         */
+        void run(std::size_t count, task_type const & task);
+
+    private:
+
+        /**
+         * @struct batch
+         *
+         * @brief Tasks submitted in a single call to @c run().
+         */
+        struct batch
+        {
+            /// Task run with each index in the batch.
+            task_type const & task;
+
+            /// Number of tasks in the batch.
+            std::size_t const count;
+
+            /// Index of the next task to be started.
+            std::size_t next;
+
+            /// Number of completed tasks.
+            std::size_t completed;
+
+            /// Exceptions thrown by the tasks.
+            std::vector<std::exception_ptr> errors;
+        };
+
+        /// Worker thread entry point.
+        void work();
+
+        /**
+         * @brief Run the next task in a batch.
+         *
+         * The task is run with the lock released.  The batch is no
+         * longer pending once its last task has been started.
+         *
+         * @param[in,out] b     Batch with tasks left to be started.
+         * @param[in,out] guard Lock on @c lock_, held on entry and
+         *                      on return.
+         */
+        void run_next(batch & b, std::unique_lock<std::mutex> & guard);
+
+    private:
+
+        /// Worker threads.
+        std::vector<std::thread> threads_;
+
+        /// Lock synchronizing access to the batches.
+        std::mutex lock_;
+
+        /// Signaled when a batch is pending, or on shutdown.
+        std::condition_variable work_;
+
+        /// Signaled when all tasks in a batch have completed.
+        std::condition_variable done_;
+
+        /// Batches with tasks left to be started, in order.
+        std::deque<batch *> pending_;
+
+        /// Have the worker threads been asked to exit?
+        bool stop_;
+
+    };
+
+}
+
+
+#endif  /* MARC_THREAD_POOL_H */
@@ -0,0 +1,107 @@
+/**
+ * @file BackplaneImageFactory_test.cpp
+ *
+ * Copyright (C) 2026 Ossama Othman
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * @author Ossama Othman
+ */
+
+#include "../src/BackplaneImageFactory.h"
+#include "../src/thread_pool.h"
+
+#include <marc/BackplaneImage.h>
+#include <marc/OblateSpheroid.h>
+#include <marc/scale_and_offset.h>
+
+#include <memory>
+#include <cstdint>
+
+
+namespace
+{
+    using backplane = MaRC::BackplaneImageFactory::backplane;
+
+    auto const body =
+        std::make_shared<MaRC::OblateSpheroid>(true, 71492, 66854);
+
+    /// Create a backplane factory with the given observer geometry.
+    std::unique_ptr<MaRC::BackplaneImageFactory>
+    make_factory(backplane type, double sub_observ_lat)
+    {
+        auto factory =
+            std::make_unique<MaRC::BackplaneImageFactory>(body, type);
+
+        factory->sub_observ(sub_observ_lat, 30, 1e7);
+
+        return factory;
+    }
+}
+
+/**
+ * @test Test that backplanes sharing the same geometry are merged
+ *       into one source image, each band keeping its own extrema.
+ */
+bool test_merge()
+{
+    auto mu = make_factory(backplane::mu, 10);
+    mu->data_range(0, std::nullopt);
+
+    auto lat = std::make_unique<MaRC::BackplaneImageFactory>(
+        body,
+        backplane::latitude);
+
+    auto mu0 = std::make_unique<MaRC::BackplaneImageFactory>(
+        body,
+        backplane::mu0);
+    mu0->sub_solar(0, 30);
+
+    if (!mu->merge(*lat) || !mu->merge(*mu0) || mu->bands() != 3)
+        return false;
+
+    MaRC::thread_pool pool(1);
+
+    auto const image = mu->make(MaRC::scale_and_offset<std::int16_t>,
+                                pool);
+
+    auto const backplanes =
+        dynamic_cast<MaRC::BackplaneImage const *>(image.get());
+
+    if (!backplanes || backplanes->bands() != 3)
+        return false;
+
+    auto const & planes = backplanes->planes();
+
+    /*
+      The user-specified minimum only applies to the mu band.  The
+      extrema of the source image factory itself are not set since
+      they would apply to all bands.
+    */
+    return
+        planes[0].type == backplane::mu
+        && planes[1].type == backplane::latitude
+        && planes[2].type == backplane::mu0
+        && *planes[0].minmax.minimum() == 0
+        && *planes[1].minmax.minimum() < 0
+        && *planes[2].minmax.minimum() < 0
+        && !mu->minmax().minimum()
+        && !mu->minmax().maximum();
+}
+
+/**
+ * @test Test that backplanes with different observer geometries are
+ *       not merged.
+ */
+bool test_geometry_mismatch()
+{
+    auto mu    = make_factory(backplane::mu, 10);
+    auto phase = make_factory(backplane::cos_phase, 20);
+
+    return !mu->merge(*phase) && mu->bands() == 1;
+}
+
+int main()
+{
+    return test_merge() && test_geometry_mismatch() ? 0 : -1;
+}
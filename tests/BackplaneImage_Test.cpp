@@ -0,0 +1,271 @@
+/**
+ * @file BackplaneImage_Test.cpp
+ *
+ * Copyright (C) 2026 Ossama Othman
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include <marc/BackplaneImage.h>
+#include <marc/LatitudeImage.h>
+#include <marc/LongitudeImage.h>
+#include <marc/MuImage.h>
+#include <marc/Mu0Image.h>
+#include <marc/CosPhaseImage.h>
+#include <marc/OblateSpheroid.h>
+#include <marc/Mercator.h>
+#include <marc/Constants.h>
+
+#include <memory>
+#include <vector>
+#include <stdexcept>
+#include <cmath>
+
+
+namespace
+{
+    // Jupiter
+    constexpr bool prograde = true;
+    constexpr double a      = 71492;  // Equatorial radius
+    constexpr double c      = 66854;  // Polar radius
+
+    constexpr double sub_observ_lat = -17;  // degrees
+    constexpr double sub_observ_lon =  15;
+    constexpr double sub_solar_lat  =  31;
+    constexpr double sub_solar_lon  =  42;
+    constexpr double range          = a * 20;
+
+    // Arbitrary scale and offset applied to all bands.
+    constexpr double scale  = 3;
+    constexpr double offset = -2;
+
+    // Absolute tolerance for the scaled data.
+    constexpr double tolerance = 1e-9;
+
+    auto const body =
+        std::make_shared<MaRC::OblateSpheroid>(prograde, a, c);
+
+    using backplane = MaRC::BackplaneImage::backplane;
+
+    MaRC::BackplaneImage::plane_list const planes =
+        {
+            { backplane::mu,               scale, offset },
+            { backplane::latitude,         scale, offset },
+            { backplane::cos_phase,        scale, offset },
+            { backplane::longitude,        scale, offset },
+            { backplane::mu0,              scale, offset },
+            { backplane::graphic_latitude, scale, offset }
+        };
+
+    /// Equivalent single band virtual images, in the same order.
+    std::vector<std::unique_ptr<MaRC::SourceImage>> make_images()
+    {
+        std::vector<std::unique_ptr<MaRC::SourceImage>> images;
+
+        images.push_back(
+            std::make_unique<MaRC::MuImage>(body,
+                                            sub_observ_lat,
+                                            sub_observ_lon,
+                                            range,
+                                            scale,
+                                            offset));
+        images.push_back(
+            std::make_unique<MaRC::LatitudeImage>(body,
+                                                  false,
+                                                  scale,
+                                                  offset));
+        images.push_back(
+            std::make_unique<MaRC::CosPhaseImage>(body,
+                                                  sub_observ_lat,
+                                                  sub_observ_lon,
+                                                  sub_solar_lat,
+                                                  sub_solar_lon,
+                                                  range,
+                                                  scale,
+                                                  offset));
+        images.push_back(
+            std::make_unique<MaRC::LongitudeImage>(scale, offset));
+        images.push_back(
+            std::make_unique<MaRC::Mu0Image>(body,
+                                             sub_solar_lat,
+                                             sub_solar_lon,
+                                             scale,
+                                             offset));
+        images.push_back(
+            std::make_unique<MaRC::LatitudeImage>(body,
+                                                  true,
+                                                  scale,
+                                                  offset));
+
+        return images;
+    }
+
+    bool close(double x, double y)
+    {
+        return
+            (std::isnan(x) && std::isnan(y))
+            || std::abs(x - y) <= tolerance;
+    }
+}
+
+/**
+ * @test Test MaRC::BackplaneImage data against the equivalent single
+ *       band virtual images.
+ */
+bool test_read_bands()
+{
+    MaRC::BackplaneImage const image(body,
+                                     sub_observ_lat,
+                                     sub_observ_lon,
+                                     sub_solar_lat,
+                                     sub_solar_lon,
+                                     range,
+                                     planes);
+
+    auto const images = make_images();
+
+    if (image.bands() != images.size())
+        return false;
+
+    std::vector<double> data(image.bands());
+
+    for (int i = -90; i <= 90; i += 10) {
+        double const lat = i * C::degree;
+
+        for (int j = -360; j <= 360; j += 20) {
+            double const lon = j * C::degree;
+
+            if (!image.read_bands(lat, lon, data.data()))
+                return false;
+
+            double first = 0;
+
+            if (!image.read_data(lat, lon, first)
+                || !close(first, data.front()))
+                return false;
+
+            for (std::size_t b = 0; b < images.size(); ++b) {
+                double datum = 0;
+
+                if (!images[b]->read_data(lat, lon, datum))
+                    datum = std::nan("");
+
+                if (!close(datum, data[b]))
+                    return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @test Test mapping all MaRC::BackplaneImage bands in one pass.
+ */
+bool test_make_maps()
+{
+    using data_type = double;
+
+    constexpr std::size_t samples = 72;
+    constexpr std::size_t lines   = 36;
+
+    MaRC::Mercator const projection(body);
+
+    MaRC::BackplaneImage const image(body,
+                                     sub_observ_lat,
+                                     sub_observ_lon,
+                                     sub_solar_lat,
+                                     sub_solar_lon,
+                                     range,
+                                     planes);
+
+    auto const images = make_images();
+
+    MaRC::extrema<data_type> const minmax;
+    MaRC::plot_info<data_type> info(samples, lines);
+
+    std::vector<MaRC::MapFactory::map_type<data_type>> maps;
+
+    projection.make_maps<data_type>(image, minmax, info, maps);
+
+    if (maps.size() != images.size())
+        return false;
+
+    for (std::size_t b = 0; b < images.size(); ++b) {
+        MaRC::plot_info<data_type> band_info(samples, lines);
+
+        auto const expected =
+            projection.make_map<data_type>(*images[b], minmax, band_info);
+
+        if (expected.size() != maps[b].size())
+            return false;
+
+        for (std::size_t i = 0; i < expected.size(); ++i)
+            if (!close(expected[i], maps[b][i]))
+                return false;
+    }
+
+    return true;
+}
+
+/**
+ * @test Test that the valid data range of each MaRC::BackplaneImage
+ *       band only applies to that band.
+ */
+bool test_band_minmax()
+{
+    // Only keep latitudes in the northern hemisphere.
+    MaRC::BackplaneImage::plane north{ backplane::latitude, 1, 0 };
+    north.minmax.minimum(0);
+
+    MaRC::BackplaneImage const image(body,
+                                     sub_observ_lat,
+                                     sub_observ_lon,
+                                     sub_solar_lat,
+                                     sub_solar_lon,
+                                     range,
+                                     { north,
+                                       { backplane::latitude, 1, 0 } });
+
+    double data[2] = {};
+
+    return
+        image.read_bands(45 * C::degree, 0, data)
+        && close(data[0], 45)
+        && close(data[1], 45)
+        && image.read_bands(-45 * C::degree, 0, data)
+        && std::isnan(data[0])
+        && close(data[1], -45)
+        && !image.read_data(-45 * C::degree, 0, data[0]);
+}
+
+/**
+ * @test Test that MaRC::BackplaneImage requires at least one band.
+ */
+bool test_no_planes()
+{
+    try {
+        MaRC::BackplaneImage const image(body,
+                                         sub_observ_lat,
+                                         sub_observ_lon,
+                                         sub_solar_lat,
+                                         sub_solar_lon,
+                                         range,
+                                         {});
+    } catch (std::invalid_argument const &) {
+        return true;
+    }
+
+    return false;
+}
+
+/// The canonical main entry point.
+int main()
+{
+    return
+        test_read_bands()
+        && test_make_maps()
+        && test_band_minmax()
+        && test_no_planes()
+        ? 0 : -1;
+}
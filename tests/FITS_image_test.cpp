@@ -0,0 +1,154 @@
+/**
+ * @file FITS_image_test.cpp
+ *
+ * Copyright (C) 2026 Ossama Othman
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * @author Ossama Othman
+ */
+
+#include "../src/FITS_file.h"
+#include "../src/FITS_image.h"
+#include "../src/FITS_traits.h"
+#include "../src/thread_pool.h"
+
+#include <fitsio.h>
+
+#include <vector>
+#include <string>
+#include <cstdio>
+
+
+namespace
+{
+    constexpr std::size_t samples = 37;
+    constexpr std::size_t lines   = 23;
+    constexpr std::size_t planes  = 3;
+
+    template <typename T>
+    std::vector<T> make_plane(std::size_t plane)
+    {
+        std::vector<T> p(samples * lines);
+
+        for (std::size_t i = 0; i < p.size(); ++i)
+            p[i] = static_cast<T>((plane + 1) * 1000 + i % 997);
+
+        return p;
+    }
+}
+
+/**
+ * @test Test that map planes written directly into the %FITS data
+ *       unit, interleaved with header writes that move the data
+ *       unit, are read back by CFITSIO unchanged with a valid
+ *       checksum.  Tile compressed images are written through
+ *       CFITSIO, and must also be read back unchanged since they
+ *       are compressed losslessly.
+ */
+template <typename T>
+bool test_write(MaRC::thread_pool & pool, bool compress)
+{
+    std::string const filename =
+        "FITS_image_test_"
+        + std::to_string(MaRC::FITS::traits<T>::bitpix)
+        + (compress ? "_compressed" : "")
+        + ".fits";
+
+    (void) std::remove(filename.c_str());
+
+    {
+        MaRC::FITS::output_file f(filename.c_str());
+
+        MaRC::FITS::compression_parameters c;
+        c.enabled      = compress;
+        c.tile_samples = 16;
+        c.tile_lines   = 8;
+
+        f.compression(c);
+
+        auto image = f.make_image(MaRC::FITS::traits<T>::bitpix,
+                                  samples,
+                                  lines,
+                                  planes);
+
+        for (std::size_t plane = 0; plane < planes; ++plane) {
+            /*
+              Write enough HISTORY cards to grow the header beyond
+              a FITS block, moving the data unit written so far.
+            */
+            for (int i = 0; i < 40; ++i)
+                image->history("Plane " + std::to_string(plane));
+
+            auto const p = make_plane<T>(plane);
+
+            // Write the last plane through CFITSIO.
+            bool const written =
+                (plane + 1 < planes
+                 ? image->write(p, pool)
+                 : image->write(p));
+
+            if (!written)
+                return false;
+        }
+
+        // Entire image already written.
+        if (image->write(make_plane<T>(0), pool))
+            return false;
+    }
+
+    fitsfile * fptr = nullptr;
+    int status = 0;
+
+    fits_open_image(&fptr, filename.c_str(), READONLY, &status);
+
+    int dataok = 0;
+    int hduok  = 0;
+    fits_verify_chksum(fptr, &dataok, &hduok, &status);
+
+    bool success = (status == 0 && dataok == 1 && hduok == 1);
+
+    for (std::size_t plane = 0; success && plane < planes; ++plane) {
+        auto const expected = make_plane<T>(plane);
+        std::vector<T> p(expected.size());
+
+        LONGLONG const fpixel = plane * p.size() + 1;
+        int anynul = 0;
+
+        fits_read_img(fptr,
+                      MaRC::FITS::traits<T>::datatype,
+                      fpixel,
+                      p.size(),
+                      nullptr,
+                      p.data(),
+                      &anynul,
+                      &status);
+
+        success = (status == 0 && p == expected);
+    }
+
+    fits_close_file(fptr, &status);
+
+    (void) std::remove(filename.c_str());
+
+    return success && status == 0;
+}
+
+/// The canonical main entry point.
+int main()
+{
+    MaRC::thread_pool pool(4);
+
+    using namespace MaRC::FITS;
+
+    for (bool const compress : { false, true })
+        if (!test_write<byte_type>(pool, compress)
+            || !test_write<short_type>(pool, compress)
+            || !test_write<long_type>(pool, compress)
+            || !test_write<longlong_type>(pool, compress)
+            || !test_write<float_type>(pool, compress)
+            || !test_write<double_type>(pool, compress))
+            return -1;
+
+    return 0;
+}
@@ -0,0 +1,191 @@
+/**
+ * @file FITS_writer_test.cpp
+ *
+ * Copyright (C) 2026 Ossama Othman
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * @author Ossama Othman
+ */
+
+#include "../src/FITS_writer.h"
+
+#include <vector>
+#include <memory>
+#include <thread>
+#include <stdexcept>
+
+
+/**
+ * @test Test that MaRC::FITS::writer runs jobs in submission order
+ *       on a thread other than the caller's.
+ */
+bool test_job_order()
+{
+    std::vector<int> order;
+    std::thread::id job_thread;
+
+    {
+        MaRC::FITS::writer writer;
+
+        constexpr int jobs = 10;
+
+        for (int i = 0; i < jobs; ++i)
+            writer.submit([&order, &job_thread, i]()
+                          {
+                              order.push_back(i);
+                              job_thread = std::this_thread::get_id();
+                          });
+
+        writer.wait();
+
+        if (static_cast<int>(order.size()) != jobs)
+            return false;
+    }
+
+    for (std::size_t i = 0; i < order.size(); ++i)
+        if (order[i] != static_cast<int>(i))
+            return false;
+
+    return job_thread != std::this_thread::get_id();
+}
+
+/**
+ * @test Test that a synchronous MaRC::FITS::writer runs jobs on the
+ *       caller's thread.
+ */
+bool test_synchronous()
+{
+    constexpr std::size_t depth = 1;
+    constexpr bool threaded = false;
+
+    MaRC::FITS::writer writer(depth, threaded);
+
+    std::thread::id job_thread;
+
+    writer.submit([&job_thread]()
+                  {
+                      job_thread = std::this_thread::get_id();
+                  });
+
+    // The job should already have been run.
+    return job_thread == std::this_thread::get_id();
+}
+
+/**
+ * @test Test that an exception thrown by a MaRC::FITS::writer job is
+ *       reported to the submitting thread.
+ */
+bool test_job_error()
+{
+    MaRC::FITS::writer writer;
+
+    try {
+        writer.submit([]() { throw std::runtime_error("write failed"); });
+
+        // The error may be reported here or when waiting.
+        writer.submit([]() {});
+        writer.wait();
+    } catch (std::runtime_error const &) {
+        // Only the first error is reported.
+        writer.wait();
+
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @test Test that MaRC::FITS::buffer_pool bounds and reuses buffers
+ *       returned from the writer thread.
+ */
+bool test_buffer_reuse()
+{
+    constexpr std::size_t capacity = 2;
+    constexpr std::size_t planes   = 8;
+    constexpr std::size_t size     = 1000;
+
+    auto const buffers =
+        std::make_shared<MaRC::FITS::buffer_pool<double>>(capacity);
+    MaRC::FITS::writer writer(capacity);
+
+    std::vector<double const *> seen;
+
+    for (std::size_t p = 0; p < planes; ++p) {
+        auto b = buffers->acquire();
+
+        // Reused buffers retain their storage.
+        b->assign(size, static_cast<double>(p));
+
+        seen.push_back(b->data());
+
+        // The buffer is returned to the pool when the job is
+        // destroyed.
+        writer.submit([b]() {});
+    }
+
+    writer.wait();
+
+    // Only "capacity" distinct buffers should ever have been used.
+    std::vector<double const *> distinct;
+
+    for (auto const s : seen) {
+        bool found = false;
+
+        for (auto const d : distinct)
+            if (d == s)
+                found = true;
+
+        if (!found)
+            distinct.push_back(s);
+    }
+
+    return distinct.size() <= capacity;
+}
+
+/**
+ * @test Test that a MaRC::FITS::buffer_pool buffer is returned to
+ *       the pool when the writer job holding it fails.
+ */
+bool test_buffer_release_on_error()
+{
+    constexpr std::size_t capacity = 1;
+
+    auto const buffers =
+        std::make_shared<MaRC::FITS::buffer_pool<int>>(capacity);
+    MaRC::FITS::writer writer;
+
+    writer.submit([b = buffers->acquire()]()
+                  {
+                      throw std::runtime_error("write failed");
+                  });
+
+    try {
+        writer.wait();
+    } catch (std::runtime_error const &) {
+    }
+
+    // This would block forever if the buffer had not been returned.
+    return buffers->acquire() != nullptr;
+}
+
+/// The canonical main entry point.
+int main()
+{
+    try {
+        constexpr std::size_t invalid_depth = 0;
+        MaRC::FITS::writer writer(invalid_depth);
+
+        return -1;  // Exception should have been thrown.
+    } catch (std::invalid_argument const &) {
+    }
+
+    return
+        test_job_order()
+        && test_synchronous()
+        && test_job_error()
+        && test_buffer_reuse()
+        && test_buffer_release_on_error()
+        ? 0 : -1;
+}
@@ -0,0 +1,298 @@
+/**
+ * @file MapImage_Test.cpp
+ *
+ * Copyright (C) 2026 Ossama Othman
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include <marc/MapImage.h>
+#include <marc/SimpleCylindrical.h>
+#include <marc/Mercator.h>
+#include <marc/PolarStereographic.h>
+#include <marc/Orthographic.h>
+#include <marc/OblateSpheroid.h>
+#include <marc/LatitudeImage.h>
+#include <marc/LongitudeImage.h>
+#include <marc/Constants.h>
+
+#include <memory>
+#include <vector>
+#include <stdexcept>
+#include <cmath>
+
+
+namespace
+{
+    constexpr double eq_rad  = 1234567;
+    constexpr double pol_rad = eq_rad / 2;
+
+    auto const prograde_body =
+        std::make_shared<MaRC::OblateSpheroid>(true, eq_rad, pol_rad);
+
+    auto const retrograde_body =
+        std::make_shared<MaRC::OblateSpheroid>(false, eq_rad, pol_rad);
+
+    /// Map the given virtual image to a map of type double.
+    MaRC::MapFactory::map_type<double>
+    make_map(MaRC::MapFactory const & projection,
+             MaRC::SourceImage const & image,
+             std::size_t samples,
+             std::size_t lines)
+    {
+        MaRC::extrema<double> const minmax;
+        MaRC::plot_info<double> info(samples, lines);
+
+        return projection.make_map<double>(image, minmax, info);
+    }
+}
+
+/**
+ * @test Test that the forward projection equations in
+ *       MaRC::MapFactory::map_coordinates() invert the latitudes and
+ *       longitudes plotted on the map.
+ */
+bool test_map_coordinates(MaRC::MapFactory const & projection,
+                          std::shared_ptr<MaRC::BodyData> const & body)
+{
+    constexpr std::size_t samples = 50;
+    constexpr std::size_t lines   = 61;
+
+    // Absolute tolerance in pixels.
+    constexpr double tolerance = 1e-6;
+
+    MaRC::LatitudeImage const latitudes(body, false, 1, 0);
+    MaRC::LongitudeImage const longitudes(1, 0);
+
+    auto const lat_map = make_map(projection, latitudes, samples, lines);
+    auto const lon_map = make_map(projection, longitudes, samples, lines);
+
+    std::size_t plotted = 0;
+
+    for (std::size_t k = 0; k < lines; ++k) {
+        for (std::size_t i = 0; i < samples; ++i) {
+            auto const offset = k * samples + i;
+
+            double const lat = lat_map[offset];
+            double const lon = lon_map[offset];
+
+            if (std::isnan(lat) || std::isnan(lon))
+                continue;  // Not on the body.
+
+            double sample = 0;
+            double line   = 0;
+
+            if (!projection.map_coordinates(samples,
+                                            lines,
+                                            lat * C::degree,
+                                            lon * C::degree,
+                                            sample,
+                                            line)
+                || std::abs(sample - (i + 0.5)) > tolerance
+                || std::abs(line   - (k + 0.5)) > tolerance)
+                return false;
+
+            ++plotted;
+        }
+    }
+
+    return plotted > 0;
+}
+
+bool test_map_coordinates()
+{
+    MaRC::OrthographicCenter const center;
+    MaRC::OrthographicCenter const lat_lon_center(MaRC::LAT_LON_GIVEN,
+                                                  -14,
+                                                  165);
+
+    std::shared_ptr<MaRC::BodyData> const body = prograde_body;
+
+    return
+        test_map_coordinates(
+            MaRC::SimpleCylindrical(prograde_body, -60, 75, 20, 300, false),
+            body)
+        && test_map_coordinates(
+            MaRC::SimpleCylindrical(retrograde_body, -90, 90, 0, 360, true),
+            retrograde_body)
+        && test_map_coordinates(MaRC::Mercator(prograde_body), body)
+        && test_map_coordinates(
+            MaRC::PolarStereographic(prograde_body, -30, true),
+            body)
+        && test_map_coordinates(
+            MaRC::PolarStereographic(prograde_body, 30, false),
+            body)
+        && test_map_coordinates(
+            MaRC::Orthographic(prograde_body, -14, 160, 35, -1, center),
+            body)
+        && test_map_coordinates(
+            MaRC::Orthographic(prograde_body,
+                               -14,
+                               160,
+                               35,
+                               -1,
+                               lat_lon_center),
+            body)
+        && test_map_coordinates(
+            MaRC::Orthographic(prograde_body, 90, 0, 0, -1, center),
+            body);
+}
+
+/**
+ * @test Test reprojecting a map through MaRC::MapImage.
+ */
+bool test_reprojection(bool interpolate)
+{
+    constexpr std::size_t samples = 360;
+    constexpr std::size_t lines   = 180;
+
+    // One degree per source map pixel.
+    constexpr double tolerance = 1;
+
+    auto const source_projection =
+        std::make_shared<MaRC::SimpleCylindrical>(prograde_body,
+                                                  -90,
+                                                  90,
+                                                  0,
+                                                  360,
+                                                  false);
+
+    MaRC::LatitudeImage const latitudes(prograde_body, false, 1, 0);
+
+    auto source_map =
+        make_map(*source_projection, latitudes, samples, lines);
+
+    MaRC::MapImage const image(source_projection,
+                               std::move(source_map),
+                               samples,
+                               lines,
+                               interpolate);
+
+    // Reproject to Mercator, and compare against the direct mapping.
+    constexpr std::size_t map_samples = 100;
+    constexpr std::size_t map_lines   = 51;
+
+    MaRC::Mercator const projection(prograde_body);
+
+    auto const expected =
+        make_map(projection, latitudes, map_samples, map_lines);
+
+    auto const map = make_map(projection, image, map_samples, map_lines);
+
+    for (std::size_t i = 0; i < map.size(); ++i)
+        if (std::isnan(map[i])
+            || std::abs(map[i] - expected[i]) > tolerance)
+            return false;
+
+    return true;
+}
+
+/**
+ * @test Test interpolating across the longitude seam of a map that
+ *       wraps around in longitude.
+ */
+bool test_seam()
+{
+    constexpr std::size_t samples = 36;
+    constexpr std::size_t lines   = 9;
+
+    // Longitude width of a map pixel.
+    constexpr double width = C::_2pi / samples;
+
+    MaRC::SimpleCylindrical const partial(prograde_body,
+                                          -90,
+                                          90,
+                                          0,
+                                          180,
+                                          false);
+
+    if (partial.wraps_longitude()
+        || !MaRC::Mercator(prograde_body).wraps_longitude())
+        return false;
+
+    /*
+      Create two maps of the sine of the longitude, one with its
+      longitude seam at 0 degrees, and one with its seam at 180
+      degrees.  Data read near 0 degrees longitude should be the
+      same in both, since the interpolated map pixels are the same.
+    */
+    auto const make_image =
+        [=](double lo_lon, double hi_lon)
+        {
+            auto const projection =
+                std::make_shared<MaRC::SimpleCylindrical>(prograde_body,
+                                                          -90,
+                                                          90,
+                                                          lo_lon,
+                                                          hi_lon,
+                                                          false);
+
+            // West longitudes increase to the left on maps of
+            // prograde bodies.
+            std::vector<double> map(samples * lines);
+
+            for (std::size_t k = 0; k < lines; ++k)
+                for (std::size_t i = 0; i < samples; ++i)
+                    map[k * samples + i] =
+                        std::sin(hi_lon * C::degree - (i + 0.5) * width);
+
+            return std::make_unique<MaRC::MapImage>(projection,
+                                                    std::move(map),
+                                                    samples,
+                                                    lines,
+                                                    true);
+        };
+
+    auto const seam     = make_image(0, 360);
+    auto const centered = make_image(-180, 180);
+
+    constexpr double tolerance = 1e-12;
+
+    for (double const offset : { -0.4, -0.25, -0.1, 0.0, 0.1, 0.25, 0.4 }) {
+        double const lon = offset * width;
+
+        double data = 0;
+        double expected = 0;
+
+        if (!seam->read_data(0, lon, data)
+            || !centered->read_data(0, lon, expected)
+            || std::abs(data - expected) > tolerance)
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ * @test Test that MaRC::MapImage rejects maps that don't match the
+ *       given dimensions.
+ */
+bool test_invalid_map()
+{
+    auto const projection =
+        std::make_shared<MaRC::Mercator>(prograde_body);
+
+    try {
+        MaRC::MapImage const image(projection,
+                                   std::vector<double>(10),
+                                   5,
+                                   3,
+                                   true);
+    } catch (std::invalid_argument const &) {
+        return true;
+    }
+
+    return false;
+}
+
+/// The canonical main entry point.
+int main()
+{
+    return
+        test_map_coordinates()
+        && test_reprojection(true)
+        && test_reprojection(false)
+        && test_seam()
+        && test_invalid_map()
+        ? 0 : -1;
+}
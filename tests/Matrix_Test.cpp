@@ -1,7 +1,7 @@
 /**
  * @file Matrix_Test.cpp
  *
- * Copyright (C) 2017 Ossama Othman
+ * Copyright (C) 2017, 2026 Ossama Othman
  *
  * SPDX-License-Identifier: GPL-2.0-or-later
  */
@@ -222,6 +222,31 @@ bool test_matrix_multiplication()
         && s * prod == sprod;
 }
 
+/**
+ * @test Test that matrix products sum their terms from left to right.
+ */
+bool test_multiplication_order()
+{
+    using matrix_type = MaRC::Matrix<double, 3, 3>;
+    using vector_type = MaRC::Vector<double, 3>;
+
+    // The first term is lost to rounding when added to the second,
+    // but not when the last two terms are added first.
+    matrix_type const m{{ 1, 1e16, -1e16 },
+                        { 0, 0,     0    },
+                        { 0, 0,     0    }};
+
+    matrix_type const ones{{ 1, 0, 0 },
+                           { 1, 0, 0 },
+                           { 1, 0, 0 }};
+
+    vector_type const v{ 1, 1, 1 };
+
+    double const expected = (1 + 1e16) + -1e16;
+
+    return (m * v)[0] == expected && (m * ones)(0, 0) == expected;
+}
+
 /**
  * @test Test the MaRC::transpose() function.
  */
@@ -241,6 +266,48 @@ bool test_matrix_transpose()
     return t == expected_t;
 }
 
+/**
+ * @test Test composite MaRC::Matrix and MaRC::Vector expressions,
+ *       including their compile-time evaluation.
+ */
+bool test_composite_expression()
+{
+    using matrix_type = MaRC::Matrix<int, 3, 3>;
+    using vector_type = MaRC::Vector<int, 3>;
+
+    constexpr auto rotation =
+        []()
+        {
+            // Rotation by 90 degrees about the z-axis.
+            matrix_type m;
+            m(0, 1) = -1;
+            m(1, 0) =  1;
+            m(2, 2) =  1;
+
+            return m;
+        }();
+
+    constexpr vector_type coord(5, 7, 11);
+    constexpr vector_type range(2, 3, 5);
+
+    constexpr auto rotated = rotation * (coord - range);
+
+    static_assert(rotated[0] == -4 && rotated[1] == 3 && rotated[2] == 6,
+                  "Matrix expression not evaluated at compile-time.");
+
+    constexpr auto identity = rotation * MaRC::transpose(rotation);
+
+    static_assert(identity(0, 0) == 1 && identity(0, 1) == 0
+                  && identity(1, 1) == 1 && identity(2, 2) == 1,
+                  "Matrix product not evaluated at compile-time.");
+
+    // Run-time evaluation of the same expression.
+    matrix_type const r(rotation);
+    vector_type const c(coord);
+
+    return r * (c - range) == rotated;
+}
+
 /// The canonical main entry point.
 int main()
 {
@@ -251,5 +318,7 @@ int main()
         && test_matrix_addition()
         && test_matrix_subtraction()
         && test_matrix_multiplication()
-        && test_matrix_transpose() ? 0 : -1;
+        && test_multiplication_order()
+        && test_matrix_transpose()
+        && test_composite_expression() ? 0 : -1;
 }
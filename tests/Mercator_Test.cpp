@@ -1,7 +1,7 @@
 /**
  * @file Mercator_Test.cpp
  *
- * Copyright (C) 2018, 2022  Ossama Othman
+ * Copyright (C) 2018, 2022, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: GPL-2.0-or-later
  */
@@ -9,6 +9,7 @@
 #include <marc/Mercator.h>
 #include <marc/OblateSpheroid.h>
 #include <marc/LatitudeImage.h>
+#include <marc/LongitudeImage.h>
 #include <marc/Constants.h>
 #include <marc/DefaultConfiguration.h>
 #include <marc/Mathematics.h>
@@ -19,6 +20,8 @@
 #include <ctime>
 #include <random>
 #include <algorithm>
+#include <stdexcept>
+#include <cmath>
 
 
 namespace
@@ -139,6 +142,150 @@ bool test_make_map()
         && MaRC::almost_zero(equator_data, epsilons);
 }
 
+/**
+ * @test Test the MaRC::MapFactory::make_map() variant that plots
+ *       into caller-supplied map storage.
+ */
+bool test_make_map_reuse()
+{
+    using data_type = double;
+
+    constexpr double scale  = 1;
+    constexpr double offset = 0;
+
+    auto const image =
+        std::make_unique<MaRC::LongitudeImage>(scale, offset);
+
+    MaRC::extrema<data_type> const minmax;
+    MaRC::plot_info<data_type> info(samples, lines);
+
+    auto const expected =
+        projection->template make_map<data_type>(*image, minmax, info);
+
+    // Map storage left over from a previous, unrelated map.
+    MaRC::MapFactory::map_type<data_type> map(samples, 12345);
+
+    projection->template make_map<data_type>(*image, minmax, info, map);
+
+    return map == expected;
+}
+
+/**
+ * @test Test that MaRC::MapFactory::make_maps() plots the same map
+ *       as MaRC::MapFactory::make_map() for a single band source
+ *       image.
+ */
+bool test_make_maps()
+{
+    using data_type = double;
+
+    constexpr double scale  = 1;
+    constexpr double offset = 0;
+
+    auto const image =
+        std::make_unique<MaRC::LongitudeImage>(scale, offset);
+
+    MaRC::extrema<data_type> const minmax;
+    MaRC::plot_info<data_type> info(samples, lines);
+
+    auto const expected =
+        projection->template make_map<data_type>(*image, minmax, info);
+
+    // Leftover map storage should be discarded.
+    std::vector<MaRC::MapFactory::map_type<data_type>> maps(3);
+
+    projection->template make_maps<data_type>(*image, minmax, info, maps);
+
+    return maps.size() == image->bands() && maps.front() == expected;
+}
+
+/**
+ * @test Test mapping several source images in a single traversal
+ *       with the MaRC::Mercator::make_maps() and
+ *       MaRC::Mercator::make_interleaved_maps() methods.
+ */
+bool test_make_multiple_maps()
+{
+    using data_type = double;
+
+    constexpr double scale  = 1;
+    constexpr double offset = 0;
+
+    auto const latitudes =
+        std::make_unique<MaRC::LatitudeImage>(body, false, scale, offset);
+
+    auto const longitudes =
+        std::make_unique<MaRC::LongitudeImage>(scale, offset);
+
+    MaRC::MapFactory::source_list const images =
+        { latitudes.get(), longitudes.get() };
+
+    // Restrict the latitude plane to the northern hemisphere.
+    MaRC::MapFactory::extrema_list<data_type> const minmax =
+        {
+            MaRC::extrema<data_type>(0, 90),
+            MaRC::extrema<data_type>()
+        };
+
+    MaRC::plot_info<data_type> info(samples, lines);
+
+    std::vector<MaRC::MapFactory::map_type<data_type>> expected;
+
+    for (std::size_t i = 0; i < images.size(); ++i)
+        expected.push_back(
+            projection->template make_map<data_type>(*images[i],
+                                                     minmax[i],
+                                                     info));
+
+    std::vector<MaRC::MapFactory::map_type<data_type>> maps;
+
+    projection->template make_maps<data_type>(images, minmax, info, maps);
+
+    MaRC::MapFactory::map_type<data_type> interleaved;
+
+    auto const planes =
+        projection->template make_interleaved_maps<data_type>(images,
+                                                              minmax,
+                                                              info,
+                                                              interleaved);
+
+    auto const equal =
+        [](data_type x, data_type y)
+        {
+            return (std::isnan(x) && std::isnan(y)) || x == y;
+        };
+
+    if (planes != images.size()
+        || maps.size() != planes
+        || interleaved.size() != samples * lines * planes)
+        return false;
+
+    for (std::size_t p = 0; p < planes; ++p) {
+        if (!std::equal(maps[p].cbegin(),
+                        maps[p].cend(),
+                        expected[p].cbegin(),
+                        expected[p].cend(),
+                        equal))
+            return false;
+
+        for (std::size_t i = 0; i < samples * lines; ++i)
+            if (!equal(interleaved[i * planes + p], expected[p][i]))
+                return false;
+    }
+
+    // Mismatched number of extrema.
+    try {
+        projection->template make_maps<data_type>(images,
+                                                  { minmax.front() },
+                                                  info,
+                                                  maps);
+    } catch (std::invalid_argument const &) {
+        return true;
+    }
+
+    return false;
+}
+
 /**
  * @test Test the MaRC::Mercator::make_grid() method, i.e. Mercator
  *       grid image creation.
@@ -200,6 +347,9 @@ int main()
     return
         test_projection_name()
         && test_make_map()
+        && test_make_map_reuse()
+        && test_make_maps()
+        && test_make_multiple_maps()
         && test_make_grid()
         && test_distortion()
         ? 0 : -1;
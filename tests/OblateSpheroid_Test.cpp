@@ -1,7 +1,7 @@
 /**
  * @file OblateSpheroid_Test.cpp
  *
- * Copyright (C) 2017 Ossama Othman
+ * Copyright (C) 2017, 2026 Ossama Othman
  *
  * SPDX-License-Identifier: GPL-2.0-or-later
  */
@@ -357,6 +357,70 @@ bool test_cos_phase()
     return MaRC::almost_equal(cos_phase, cos_phase_2, ulps);
 }
 
+/**
+ * @test Test that the fused &mu;, &mu;<SUB>0</SUB> and cos(&phi;)
+ *       calculation in MaRC::OblateSpheroid matches the individual
+ *       calculations.
+ */
+bool test_photometric_cosines()
+{
+    auto const o =
+        std::make_unique<MaRC::OblateSpheroid>(prograde, a, c);
+
+    constexpr double sub_observ_lat = -67 * C::degree;
+    constexpr double sub_observ_lon =  15 * C::degree;
+    constexpr double sub_solar_lat  =  31 * C::degree;
+    constexpr double sub_solar_lon  = 198 * C::degree;
+    constexpr double range          = a * 300;
+
+    // Absolute tolerance for the computed cosines.
+    constexpr double tolerance = 1e-12;
+
+    for (int i = -90; i <= 90; i += 15) {
+        double const lat = i * C::degree;
+
+        for (int j = 0; j < 360; j += 30) {
+            double const lon = j * C::degree;
+
+            double mu        = 0;
+            double mu0       = 0;
+            double cos_phase = 0;
+
+            o->photometric_cosines(sub_observ_lat,
+                                   sub_observ_lon,
+                                   sub_solar_lat,
+                                   sub_solar_lon,
+                                   lat,
+                                   lon,
+                                   range,
+                                   mu,
+                                   mu0,
+                                   cos_phase);
+
+            double const mu_2 =
+                o->mu(sub_observ_lat, sub_observ_lon, lat, lon, range);
+
+            double const mu0_2 =
+                o->mu0(sub_solar_lat, sub_solar_lon, lat, lon);
+
+            double const cos_phase_2 = o->cos_phase(sub_observ_lat,
+                                                    sub_observ_lon,
+                                                    sub_solar_lat,
+                                                    sub_solar_lon,
+                                                    lat,
+                                                    lon,
+                                                    range);
+
+            if (std::abs(mu - mu_2) > tolerance
+                || std::abs(mu0 - mu0_2) > tolerance
+                || std::abs(cos_phase - cos_phase_2) > tolerance)
+                return false;
+        }
+    }
+
+    return true;
+}
+
 /// The canonical main entry point.
 int main()
 {
@@ -367,5 +431,6 @@ int main()
         && test_mu()
         && test_mu0()
         && test_cos_phase()
+        && test_photometric_cosines()
         ? 0 : -1;
 }
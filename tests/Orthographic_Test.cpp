@@ -1,7 +1,7 @@
 /**
  * @file Orthographic_Test.cpp
  *
- * Copyright (C) 2018 Ossama Othman
+ * Copyright (C) 2018, 2026 Ossama Othman
  *
  * SPDX-License-Identifier: GPL-2.0-or-later
  */
@@ -9,6 +9,7 @@
 #include <marc/Orthographic.h>
 #include <marc/OblateSpheroid.h>
 #include <marc/LatitudeImage.h>
+#include <marc/LongitudeImage.h>
 #include <marc/Mathematics.h>
 #include <marc/Constants.h>
 #include <marc/DefaultConfiguration.h>
@@ -17,6 +18,9 @@
 #include <marc/Log.h>
 
 #include <memory>
+#include <array>
+#include <stdexcept>
+#include <cmath>
 #include <cstring>
 #include <algorithm>
 
@@ -202,6 +206,325 @@ bool test_make_grid()
 }
 
 
+/**
+ * @test Test interpolation of map coordinates within a given
+ *       tolerance.
+ */
+bool test_coordinate_tolerance()
+{
+    constexpr std::size_t map_samples = 301;
+    constexpr std::size_t map_lines   = 201;
+
+    // A small fraction of a map pixel.
+    constexpr double tolerance = eq_rad * 1e-3;  // km
+
+    MaRC::LatitudeImage const latitudes(body, false, 1, 0);
+    MaRC::LongitudeImage const longitudes(1, 0);
+
+    using map_type = MaRC::MapFactory::map_type<double>;
+
+    auto const make_maps =
+        [&](double km, map_type & lat_map, map_type & lon_map)
+        {
+            auto const p =
+                std::make_unique<MaRC::Orthographic>(body,
+                                                     sub_observ_lat,
+                                                     sub_observ_lon,
+                                                     position_angle,
+                                                     km_per_pixel,
+                                                     center);
+            p->coordinate_tolerance(km);
+
+            MaRC::extrema<double> const minmax;
+            MaRC::plot_info<double> lat_info(map_samples, map_lines);
+            MaRC::plot_info<double> lon_info(map_samples, map_lines);
+
+            lat_map = p->make_map<double>(latitudes, minmax, lat_info);
+            lon_map = p->make_map<double>(longitudes, minmax, lon_info);
+        };
+
+    map_type lat_exact, lon_exact, lat_map, lon_map;
+
+    make_maps(0, lat_exact, lon_exact);
+    make_maps(tolerance, lat_map, lon_map);
+
+    // Point on the surface of the body at the given degrees.
+    auto const point =
+        [](double lat, double lon)
+        {
+            lat *= C::degree;
+            lon *= C::degree;
+
+            double const r = body->centric_radius(lat);
+
+            return std::array<double, 3> {
+                r * std::cos(lat) * std::cos(lon),
+                r * std::cos(lat) * std::sin(lon),
+                r * std::sin(lat) };
+        };
+
+    std::size_t interpolated = 0;
+
+    for (std::size_t n = 0; n < lat_exact.size(); ++n) {
+        bool const on_body = !std::isnan(lat_exact[n]);
+
+        if (on_body != !std::isnan(lat_map[n]))
+            return false;
+
+        if (!on_body)
+            continue;
+
+        auto const a = point(lat_exact[n], lon_exact[n]);
+        auto const b = point(lat_map[n], lon_map[n]);
+
+        double const d =
+            std::hypot(a[0] - b[0], a[1] - b[1], a[2] - b[2]);
+
+        if (d > tolerance)
+            return false;
+
+        if (lat_map[n] != lat_exact[n] || lon_map[n] != lon_exact[n])
+            ++interpolated;
+    }
+
+    if (interpolated == 0)
+        return false;
+
+    try {
+        projection->coordinate_tolerance(-1);
+    } catch (std::invalid_argument const &) {
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @test Test that regional maps dominated by sky plot every map
+ *       pixel on the disk of the body, and no others, for polar and
+ *       non-polar projections.
+ */
+bool test_limb()
+{
+    constexpr std::size_t map_samples = 201;
+    constexpr std::size_t map_lines   = 151;
+
+    // Body center below the map, so that the limb crosses the map
+    // lines on both sides of the body.
+    constexpr double radius        = 100;    // pixels
+    constexpr double sample_center = 100.3;
+    constexpr double line_center   = -40.7;
+    constexpr double km            = eq_rad / radius;
+
+    MaRC::OrthographicCenter const given(MaRC::CENTER_GIVEN,
+                                         sample_center,
+                                         line_center);
+
+    MaRC::LatitudeImage const latitudes(body, false, 1, 0);
+
+    for (double lat : { sub_observ_lat, 90. }) {
+        MaRC::Orthographic const p(body,
+                                   lat,
+                                   sub_observ_lon,
+                                   position_angle,
+                                   km,
+                                   given);
+
+        MaRC::extrema<double> const minmax;
+        MaRC::plot_info<double> info(map_samples, map_lines);
+
+        auto const map = p.make_map<double>(latitudes, minmax, info);
+
+        /*
+          The disk of the body is bounded by an ellipse with the
+          equatorial radius as its semi-major axis, rotated by the
+          position angle.
+        */
+        double const b  = lat * C::degree;
+        double const pa = -position_angle * C::degree;
+        double const a2 = eq_rad * eq_rad;
+        double const b2 =
+            a2 * std::pow(std::sin(b), 2)
+            + pol_rad * pol_rad * std::pow(std::cos(b), 2);
+
+        std::size_t sky = 0;
+
+        for (std::size_t k = 0; k < map_lines; ++k) {
+            for (std::size_t i = 0; i < map_samples; ++i) {
+                double const x = (i + 0.5 - sample_center) * km;
+                double const z = (k + 0.5 - line_center) * km;
+                double const u = std::cos(pa) * x - std::sin(pa) * z;
+                double const v = std::sin(pa) * x + std::cos(pa) * z;
+
+                // Normalized squared distance from the body center.
+                double const d = u * u / a2 + v * v / b2;
+
+                bool const blank = std::isnan(map[k * map_samples + i]);
+
+                // Map pixels right on the limb could go either way.
+                if ((d < 1 - 1e-9 && blank) || (d > 1 + 1e-9 && !blank))
+                    return false;
+
+                if (blank)
+                    ++sky;
+            }
+        }
+
+        // Most of the map should be sky.
+        if (sky < map_samples * map_lines / 2
+            || sky == map_samples * map_lines)
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ * @test Test that the latitudes and longitudes plotted on maps with
+ *       non-zero sub-observer latitudes lie on the body, by mapping
+ *       them back through the forward projection equations.
+ */
+bool test_round_trip()
+{
+    MaRC::LatitudeImage const latitudes(body, false, 1, 0);
+    MaRC::LongitudeImage const longitudes(1, 0);
+
+    // Absolute tolerance in pixels.
+    constexpr double tolerance = 1e-6;
+
+    for (double lat : { sub_observ_lat, 50. }) {
+        MaRC::Orthographic const p(body,
+                                   lat,
+                                   sub_observ_lon,
+                                   position_angle,
+                                   km_per_pixel,
+                                   MaRC::OrthographicCenter());
+
+        MaRC::extrema<double> const minmax;
+        MaRC::plot_info<double> lat_info(samples, lines);
+        MaRC::plot_info<double> lon_info(samples, lines);
+
+        auto const lat_map =
+            p.make_map<double>(latitudes, minmax, lat_info);
+        auto const lon_map =
+            p.make_map<double>(longitudes, minmax, lon_info);
+
+        std::size_t plotted = 0;
+
+        for (std::size_t k = 0; k < lines; ++k) {
+            for (std::size_t i = 0; i < samples; ++i) {
+                auto const offset = k * samples + i;
+
+                if (std::isnan(lat_map[offset]))
+                    continue;  // Not on the body.
+
+                double sample = 0;
+                double line   = 0;
+
+                if (!p.map_coordinates(samples,
+                                       lines,
+                                       lat_map[offset] * C::degree,
+                                       lon_map[offset] * C::degree,
+                                       sample,
+                                       line)
+                    || std::abs(sample - (i + 0.5)) > tolerance
+                    || std::abs(line   - (k + 0.5)) > tolerance)
+                    return false;
+
+                ++plotted;
+            }
+        }
+
+        if (plotted == 0)
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ * @test Test that sky culled from orthographic maps contains no
+ *       mapped pixels, including bodies smaller than a map tile, and
+ *       that culling it leaves the maps unchanged.
+ */
+bool test_data_region()
+{
+    constexpr std::size_t map_samples = 201;
+    constexpr std::size_t map_lines   = 151;
+
+    MaRC::LatitudeImage const latitudes(body, false, 1, 0);
+
+    struct view
+    {
+        double radius;         // pixels
+        double sample_center;
+        double line_center;
+    };
+
+    /*
+      Body center below the map, a body in the middle of the map,
+      and bodies smaller than a map tile, one of which straddles
+      tile boundaries.
+    */
+    constexpr view views[] = {
+        { 100, 100.3, -40.7 },
+        {  30, 100.3,  75.2 },
+        { 2.6,  61.4,  37.9 },
+        { 2.6,  64.0, 128.0 }
+    };
+
+    for (auto const & v : views) {
+        MaRC::OrthographicCenter const given(MaRC::CENTER_GIVEN,
+                                             v.sample_center,
+                                             v.line_center);
+
+        MaRC::Orthographic const p(body,
+                                   sub_observ_lat,
+                                   sub_observ_lon,
+                                   position_angle,
+                                   eq_rad / v.radius,
+                                   given);
+
+        auto const region =
+            p.data_region({ &latitudes }, map_samples, map_lines);
+
+        MaRC::extrema<double> const minmax;
+        MaRC::plot_info<double> full_info(map_samples, map_lines);
+        MaRC::plot_info<double> info(map_samples, map_lines);
+
+        full_info.tile_culling(false);
+
+        auto const expected =
+            p.make_map<double>(latitudes, minmax, full_info);
+        auto const map = p.make_map<double>(latitudes, minmax, info);
+
+        std::size_t plotted = 0;
+
+        for (std::size_t k = 0; k < map_lines; ++k) {
+            for (std::size_t i = 0; i < map_samples; ++i) {
+                auto const offset = k * map_samples + i;
+                bool const data = !std::isnan(expected[offset]);
+
+                if (data != !std::isnan(map[offset])
+                    || (data && (expected[offset] != map[offset]
+                                 || !region.contains(i, k))))
+                    return false;
+
+                if (data)
+                    ++plotted;
+            }
+        }
+
+        // Most of the sky should be culled.
+        if (plotted == 0
+            || region.size() - plotted > (map_samples * map_lines
+                                          - plotted) / 2)
+            return false;
+    }
+
+    return true;
+}
+
 /// The canonical main entry point.
 int main()
 {
@@ -214,5 +537,9 @@ int main()
         test_projection_name()
         && test_make_map()
         && test_make_grid()
+        && test_coordinate_tolerance()
+        && test_limb()
+        && test_round_trip()
+        && test_data_region()
         ? 0 : -1;
 }
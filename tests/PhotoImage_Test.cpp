@@ -0,0 +1,460 @@
+/**
+ * @file PhotoImage_Test.cpp
+ *
+ * Copyright (C) 2026  Ossama Othman
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include <marc/PhotoImage.h>
+#include <marc/PhotoImageParameters.h>
+#include <marc/ViewingGeometry.h>
+#include <marc/OblateSpheroid.h>
+#include <marc/BilinearInterpolation.h>
+#include <marc/SimpleCylindrical.h>
+#include <marc/PolarStereographic.h>
+#include <marc/Orthographic.h>
+#include <marc/Constants.h>
+
+#include <vector>
+#include <limits>
+#include <memory>
+#include <cmath>
+
+
+namespace
+{
+    // Jupiter
+    constexpr bool   prograde   = true;
+    constexpr double eq_rad     = 71492;
+    constexpr double pol_rad    = 66854;
+
+    std::shared_ptr<MaRC::OblateSpheroid> body =
+        std::make_shared<MaRC::OblateSpheroid>(prograde, eq_rad, pol_rad);
+
+    // "Image" size
+    constexpr std::size_t samples = 400; // pixels
+    constexpr std::size_t lines   = 200;
+
+    // Nibble values that cut through the body in the image.
+    constexpr std::size_t nibble_left   = 150;
+    constexpr std::size_t nibble_right  = 20;
+    constexpr std::size_t nibble_top    = 40;
+    constexpr std::size_t nibble_bottom = 15;
+
+    auto make_geometry()
+    {
+        auto geometry = std::make_unique<MaRC::ViewingGeometry>(body);
+
+        geometry->body_center(samples / 2.0, lines / 2.0);
+        geometry->sub_observ(10, 30);
+        geometry->position_angle(15);
+        geometry->sub_solar(0, 30);
+        geometry->range(1e7);
+        geometry->km_per_pixel(1000);
+
+        geometry->finalize_setup(samples, lines);
+
+        return geometry;
+    }
+
+    auto make_config(bool remove_sky, bool window, bool interpolate)
+    {
+        auto config = std::make_unique<MaRC::PhotoImageParameters>();
+
+        config->nibble_left(nibble_left);
+        config->nibble_right(nibble_right);
+        config->nibble_top(nibble_top);
+        config->nibble_bottom(nibble_bottom);
+        config->remove_sky(remove_sky);
+
+        if (interpolate) {
+            // Interpolation occurs relative to the stored image data.
+            config->interpolation_strategy(
+                window
+                ? std::make_unique<MaRC::BilinearInterpolation>(
+                    samples - nibble_left - nibble_right,
+                    lines - nibble_top - nibble_bottom,
+                    0, 0, 0, 0)
+                : std::make_unique<MaRC::BilinearInterpolation>(
+                    samples,
+                    lines,
+                    nibble_left,
+                    nibble_right,
+                    nibble_top,
+                    nibble_bottom));
+        }
+
+        return config;
+    }
+}
+
+/**
+ * @test Test that a @c PhotoImage holding only the non-nibbled
+ *       window of an image retrieves the same data and weights as
+ *       one holding the entire image.
+ */
+bool test_window(bool remove_sky, bool interpolate)
+{
+    std::vector<double> image(samples * lines);
+    std::vector<double> window;
+
+    for (std::size_t k = 0; k < lines; ++k) {
+        for (std::size_t i = 0; i < samples; ++i) {
+            double const datum = i + 1000.0 * k;
+
+            image[k * samples + i] = datum;
+
+            if (i >= nibble_left && i < samples - nibble_right
+                && k >= nibble_top && k < lines - nibble_bottom)
+                window.push_back(datum);
+        }
+    }
+
+    MaRC::PhotoImage const full(std::move(image),
+                                samples,
+                                lines,
+                                make_config(remove_sky, false, interpolate),
+                                make_geometry());
+
+    MaRC::PhotoImage const part(std::move(window),
+                                samples,
+                                lines,
+                                make_config(remove_sky, true, interpolate),
+                                make_geometry());
+
+    std::size_t count = 0;
+
+    for (double lat = -90; lat <= 90; lat += 0.5) {
+        for (double lon = 0; lon < 360; lon += 0.5) {
+            double full_data   = 0;
+            double full_weight = 1e6;
+            double part_data   = 0;
+            double part_weight = 1e6;
+
+            bool const full_read = full.read_data(lat * C::degree,
+                                                  lon * C::degree,
+                                                  full_data,
+                                                  full_weight);
+
+            bool const part_read = part.read_data(lat * C::degree,
+                                                  lon * C::degree,
+                                                  part_data,
+                                                  part_weight);
+
+            if (full_read != part_read)
+                return false;
+
+            if (full_read) {
+                if (full_data != part_data || full_weight != part_weight)
+                    return false;
+
+                ++count;
+            }
+        }
+    }
+
+    // Make sure the body was actually visible in the window.
+    return count > 0;
+}
+
+/**
+ * @test Test that each band of a multi-band @c PhotoImage retrieves
+ *       the same data as a single band @c PhotoImage containing the
+ *       same image.
+ */
+bool test_bands(bool window, bool interpolate)
+{
+    constexpr std::size_t num_bands = 3;
+
+    std::size_t const band_samples =
+        window ? samples - nibble_left - nibble_right : samples;
+    std::size_t const band_lines =
+        window ? lines - nibble_top - nibble_bottom : lines;
+
+    MaRC::PhotoImage::band_list_type bands(num_bands);
+
+    for (std::size_t b = 0; b < num_bands; ++b) {
+        auto & band = bands[b];
+
+        band.resize(band_samples * band_lines);
+
+        for (std::size_t n = 0; n < band.size(); ++n)
+            band[n] = (b + 1) * 1e6 + n;
+    }
+
+    // Blank pixel at the body center in the second band only.
+    std::size_t const left = window ? nibble_left : 0;
+    std::size_t const top  = window ? nibble_top  : 0;
+
+    constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+    bands[1][(lines / 2 - top) * band_samples + samples / 2 - left] = nan;
+
+    // Single band images used to verify the multi-band image.
+    std::vector<std::unique_ptr<MaRC::PhotoImage>> images;
+
+    constexpr bool remove_sky = true;
+
+    for (auto const & band : bands) {
+        images.push_back(
+            std::make_unique<MaRC::PhotoImage>(
+                std::vector<double>(band),
+                samples,
+                lines,
+                make_config(remove_sky, window, interpolate),
+                make_geometry()));
+    }
+
+    MaRC::PhotoImage const cube(std::move(bands),
+                                samples,
+                                lines,
+                                make_config(remove_sky,
+                                            window,
+                                            interpolate),
+                                make_geometry());
+
+    if (cube.bands() != num_bands)
+        return false;
+
+    std::size_t count = 0;
+    bool blank = false;
+
+    for (double lat = -90; lat <= 90; lat += 0.25) {
+        for (double lon = 0; lon < 360; lon += 0.25) {
+            double data[num_bands];
+
+            bool const found = cube.read_bands(lat * C::degree,
+                                               lon * C::degree,
+                                               data);
+
+            bool any = false;
+
+            for (std::size_t b = 0; b < num_bands; ++b) {
+                double datum = 0;
+
+                bool const read = images[b]->read_data(lat * C::degree,
+                                                       lon * C::degree,
+                                                       datum);
+
+                if (read != !std::isnan(data[b])
+                    || (read && datum != data[b]))
+                    return false;
+
+                any = any || read;
+            }
+
+            if (found != any)
+                return false;
+
+            if (found) {
+                ++count;
+
+                if (std::isnan(data[1]))
+                    blank = true;
+            }
+        }
+    }
+
+    /*
+      Make sure the body was actually mapped, as well as the blank
+      pixel unless it was interpolated over.
+    */
+    return count > 0 && (interpolate || blank);
+}
+
+/**
+ * @test Test that source-driven mapping of a @c PhotoImage plots the
+ *       same data as a full traversal of the map, while only
+ *       covering part of the map.
+ */
+bool test_source_driven(MaRC::MapFactory const & projection,
+                        bool remove_sky,
+                        bool interpolate)
+{
+    constexpr std::size_t map_samples = 360;
+    constexpr std::size_t map_lines   = 180;
+
+    std::vector<double> image(samples * lines);
+
+    for (std::size_t n = 0; n < image.size(); ++n)
+        image[n] = static_cast<double>(n);
+
+    MaRC::PhotoImage const photo(std::move(image),
+                                 samples,
+                                 lines,
+                                 make_config(remove_sky,
+                                             false,
+                                             interpolate),
+                                 make_geometry());
+
+    auto const coverage =
+        projection.map_coverage({ &photo }, map_samples, map_lines);
+
+    if (coverage.samples() != map_samples
+        || coverage.lines() != map_lines)
+        return false;
+
+    MaRC::extrema<double> const minmax;
+
+    MaRC::plot_info<double> full_info(map_samples, map_lines);
+    MaRC::plot_info<double> info(map_samples, map_lines);
+
+    full_info.tile_culling(false);
+    info.source_driven(true);
+
+    auto const expected =
+        projection.make_map<double>(photo, minmax, full_info);
+
+    std::vector<MaRC::MapFactory::map_type<double>> maps;
+
+    projection.make_maps<double>(photo, minmax, info, maps);
+
+    auto const map = projection.make_map<double>(photo, minmax, info);
+
+    std::size_t plotted = 0;
+
+    for (std::size_t n = 0; n < expected.size(); ++n) {
+        bool const data = !std::isnan(expected[n]);
+
+        if (data != !std::isnan(map[n])
+            || data != !std::isnan(maps[0][n])
+            || (data && (expected[n] != map[n]
+                         || expected[n] != maps[0][n])))
+            return false;
+
+        if (data)
+            ++plotted;
+    }
+
+    // Make sure the photo was mapped, and that the map was only
+    // partially covered.
+    return plotted > 0 && !coverage.full();
+}
+
+bool test_source_driven()
+{
+    auto const cylindrical =
+        MaRC::SimpleCylindrical(body, -90, 90, 0, 360, false);
+
+    auto const polar = MaRC::PolarStereographic(body, -30, true);
+
+    // Partially overlap the photo, leaving much of the visible
+    // hemisphere uncovered.
+    MaRC::OrthographicCenter const center;
+
+    auto const orthographic =
+        MaRC::Orthographic(body, 0, 100, 0, -1, center);
+
+    return
+        test_source_driven(cylindrical, false, false)
+        && test_source_driven(cylindrical, true, false)
+        && test_source_driven(cylindrical, true, true)
+        && test_source_driven(polar, true, true)
+        && test_source_driven(orthographic, true, true)
+        && test_source_driven(orthographic, false, false);
+}
+
+/**
+ * @test Test that map tiles culled for a photo contain no mapped
+ *       pixels, and that culling them leaves the map unchanged.
+ */
+bool test_tile_culling(MaRC::MapFactory const & projection,
+                       bool remove_sky,
+                       bool source_driven)
+{
+    constexpr std::size_t map_samples = 360;
+    constexpr std::size_t map_lines   = 180;
+
+    std::vector<double> image(samples * lines);
+
+    for (std::size_t n = 0; n < image.size(); ++n)
+        image[n] = static_cast<double>(n);
+
+    MaRC::PhotoImage const photo(std::move(image),
+                                 samples,
+                                 lines,
+                                 make_config(remove_sky, false, true),
+                                 make_geometry());
+
+    auto const region = projection.data_region({ &photo },
+                                               map_samples,
+                                               map_lines,
+                                               source_driven);
+
+    MaRC::extrema<double> const minmax;
+
+    MaRC::plot_info<double> full_info(map_samples, map_lines);
+    MaRC::plot_info<double> info(map_samples, map_lines);
+
+    full_info.tile_culling(false);
+    info.source_driven(source_driven);
+
+    auto const expected =
+        projection.make_map<double>(photo, minmax, full_info);
+
+    auto const map = projection.make_map<double>(photo, minmax, info);
+
+    std::size_t plotted = 0;
+
+    for (std::size_t k = 0; k < map_lines; ++k) {
+        for (std::size_t i = 0; i < map_samples; ++i) {
+            auto const offset = k * map_samples + i;
+            bool const data = !std::isnan(expected[offset]);
+
+            // Culled map pixels must not have any data.
+            if (data != !std::isnan(map[offset])
+                || (data && (expected[offset] != map[offset]
+                             || !region.contains(i, k))))
+                return false;
+
+            if (data)
+                ++plotted;
+        }
+    }
+
+    // Make sure the photo was mapped, and that part of the map was
+    // culled.
+    return plotted > 0 && !region.full();
+}
+
+/**
+ * @test Test map tile culling for photos with different map
+ *       projections.
+ */
+bool test_tile_culling()
+{
+    auto const cylindrical =
+        MaRC::SimpleCylindrical(body, -90, 90, 0, 360, false);
+
+    auto const polar = MaRC::PolarStereographic(body, -30, true);
+
+    // Show part of the far side of the photo.
+    MaRC::OrthographicCenter const center;
+
+    auto const orthographic =
+        MaRC::Orthographic(body, 0, 100, 0, -1, center);
+
+    return
+        test_tile_culling(cylindrical, false, false)
+        && test_tile_culling(cylindrical, true, true)
+        && test_tile_culling(polar, true, false)
+        && test_tile_culling(polar, false, true)
+        && test_tile_culling(orthographic, false, false)
+        && test_tile_culling(orthographic, true, true);
+}
+
+int main()
+{
+    return
+        test_window(false, false)
+        && test_window(true, false)
+        && test_window(false, true)
+        && test_window(true, true)
+        && test_bands(false, false)
+        && test_bands(true, false)
+        && test_bands(false, true)
+        && test_bands(true, true)
+        && test_source_driven()
+        && test_tile_culling()
+        ? 0 : -1;
+}
@@ -1,7 +1,7 @@
 /**
  * @file PolarStereographic_Test.cpp
  *
- * Copyright (C) 2018 Ossama Othman
+ * Copyright (C) 2018, 2026 Ossama Othman
  *
  * SPDX-License-Identifier: GPL-2.0-or-later
  */
@@ -9,12 +9,16 @@
 #include <marc/PolarStereographic.h>
 #include <marc/OblateSpheroid.h>
 #include <marc/LatitudeImage.h>
+#include <marc/LongitudeImage.h>
 #include <marc/Mathematics.h>
 #include <marc/Constants.h>
 #include <marc/DefaultConfiguration.h>
 #include <marc/scale_and_offset.h>
 
 #include <memory>
+#include <array>
+#include <stdexcept>
+#include <cmath>
 #include <cstring>
 #include <algorithm>
 
@@ -317,6 +321,96 @@ bool test_distortion()
         && projection->distortion(equator) > map_center_distortion;
 }
 
+/**
+ * @test Test interpolation of map coordinates within a given
+ *       tolerance.
+ */
+bool test_coordinate_tolerance()
+{
+    constexpr std::size_t map_samples = 151;
+    constexpr std::size_t map_lines   = 101;
+
+    // A small fraction of a map pixel.
+    constexpr double tolerance = eq_rad * 1e-3;  // km
+
+    MaRC::LatitudeImage const latitudes(body, false, 1, 0);
+    MaRC::LongitudeImage const longitudes(1, 0);
+
+    using map_type = MaRC::MapFactory::map_type<double>;
+
+    auto const make_maps =
+        [&](double km, map_type & lat_map, map_type & lon_map)
+        {
+            auto const p =
+                std::make_unique<MaRC::PolarStereographic>(body,
+                                                           max_lat,
+                                                           north_pole);
+            p->coordinate_tolerance(km);
+
+            MaRC::extrema<double> const minmax;
+            MaRC::plot_info<double> lat_info(map_samples, map_lines);
+            MaRC::plot_info<double> lon_info(map_samples, map_lines);
+
+            lat_map = p->make_map<double>(latitudes, minmax, lat_info);
+            lon_map = p->make_map<double>(longitudes, minmax, lon_info);
+        };
+
+    map_type lat_exact, lon_exact, lat_map, lon_map;
+
+    make_maps(0, lat_exact, lon_exact);
+    make_maps(tolerance, lat_map, lon_map);
+
+    // Point on the surface of the body at the given degrees.
+    auto const point =
+        [](double lat, double lon)
+        {
+            lat *= C::degree;
+            lon *= C::degree;
+
+            double const r = body->centric_radius(lat);
+
+            return std::array<double, 3> {
+                r * std::cos(lat) * std::cos(lon),
+                r * std::cos(lat) * std::sin(lon),
+                r * std::sin(lat) };
+        };
+
+    std::size_t interpolated = 0;
+
+    for (std::size_t n = 0; n < lat_exact.size(); ++n) {
+        bool const on_body = !std::isnan(lat_exact[n]);
+
+        if (on_body != !std::isnan(lat_map[n]))
+            return false;
+
+        if (!on_body)
+            continue;
+
+        auto const a = point(lat_exact[n], lon_exact[n]);
+        auto const b = point(lat_map[n], lon_map[n]);
+
+        double const d =
+            std::hypot(a[0] - b[0], a[1] - b[1], a[2] - b[2]);
+
+        if (d > tolerance)
+            return false;
+
+        if (lat_map[n] != lat_exact[n] || lon_map[n] != lon_exact[n])
+            ++interpolated;
+    }
+
+    if (interpolated == 0)
+        return false;
+
+    try {
+        projection->coordinate_tolerance(-1);
+    } catch (std::invalid_argument const &) {
+        return true;
+    }
+
+    return false;
+}
+
 /// The canonical main entry point.
 int main()
 {
@@ -325,5 +419,6 @@ int main()
         && test_make_map()
         && test_make_grid()
         && test_distortion()
+        && test_coordinate_tolerance()
         ? 0 : -1;
 }
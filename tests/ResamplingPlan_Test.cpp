@@ -0,0 +1,384 @@
+/**
+ * @file ResamplingPlan_Test.cpp
+ *
+ * Copyright (C) 2026  Ossama Othman
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include <marc/ResamplingPlan.h>
+#include <marc/Mercator.h>
+#include <marc/PhotoImage.h>
+#include <marc/PhotoImageParameters.h>
+#include <marc/MosaicImage.h>
+#include <marc/weighted_average.h>
+#include <marc/LatitudeImage.h>
+#include <marc/ViewingGeometry.h>
+#include <marc/OblateSpheroid.h>
+#include <marc/BilinearInterpolation.h>
+#include <marc/PhotometricCorrection.h>
+
+#include <vector>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <cmath>
+
+
+namespace
+{
+    // Jupiter
+    constexpr bool   prograde   = true;
+    constexpr double eq_rad     = 71492;
+    constexpr double pol_rad    = 66854;
+
+    std::shared_ptr<MaRC::OblateSpheroid> body =
+        std::make_shared<MaRC::OblateSpheroid>(prograde, eq_rad, pol_rad);
+
+    auto projection = std::make_unique<MaRC::Mercator>(body);
+
+    // Map size
+    constexpr std::size_t map_samples = 180;
+    constexpr std::size_t map_lines   = 91;
+
+    // "Image" size
+    constexpr std::size_t samples = 400; // pixels
+    constexpr std::size_t lines   = 200;
+
+    constexpr std::size_t nibble_left   = 150;
+    constexpr std::size_t nibble_right  = 20;
+    constexpr std::size_t nibble_top    = 40;
+    constexpr std::size_t nibble_bottom = 15;
+
+    constexpr std::size_t window_samples =
+        samples - nibble_left - nibble_right;
+    constexpr std::size_t window_lines =
+        lines - nibble_top - nibble_bottom;
+
+    using source_list = MaRC::ResamplingPlan::source_list;
+    using map_type    = std::vector<double>;
+
+    /// Create test image data.
+    std::vector<double> make_data(double scale)
+    {
+        std::vector<double> image(samples * lines);
+
+        for (std::size_t k = 0; k < lines; ++k)
+            for (std::size_t i = 0; i < samples; ++i)
+                image[k * samples + i] = scale * (i + 1000.0 * k);
+
+        return image;
+    }
+
+    /// Photometric correction that doubles the data.
+    class doubling_correction final : public MaRC::PhotometricCorrection
+    {
+    public:
+
+        bool correct(MaRC::ViewingGeometry const & /* geometry */,
+                     double & data) override
+        {
+            data *= 2;
+
+            return true;
+        }
+
+    };
+
+    /// Create a photo holding only the non-nibbled window of
+    /// @a image.
+    std::unique_ptr<MaRC::SourceImage>
+    make_photo(std::vector<double> const & image,
+               double sub_observ_lon,
+               bool correct = false)
+    {
+        std::vector<double> window;
+
+        for (std::size_t k = nibble_top; k < lines - nibble_bottom; ++k)
+            for (std::size_t i = nibble_left;
+                 i < samples - nibble_right;
+                 ++i)
+                window.push_back(image[k * samples + i]);
+
+        auto geometry = std::make_unique<MaRC::ViewingGeometry>(body);
+
+        geometry->body_center(samples / 2.0, lines / 2.0);
+        geometry->sub_observ(10, sub_observ_lon);
+        geometry->position_angle(15);
+        geometry->sub_solar(0, sub_observ_lon);
+        geometry->range(1e7);
+        geometry->km_per_pixel(1000);
+        geometry->finalize_setup(samples, lines);
+
+        auto config = std::make_unique<MaRC::PhotoImageParameters>();
+
+        config->nibble_left(nibble_left);
+        config->nibble_right(nibble_right);
+        config->nibble_top(nibble_top);
+        config->nibble_bottom(nibble_bottom);
+        config->remove_sky(true);
+        config->interpolation_strategy(
+            std::make_unique<MaRC::BilinearInterpolation>(window_samples,
+                                                          window_lines,
+                                                          0, 0, 0, 0));
+
+        if (correct)
+            config->photometric_correction(
+                std::make_unique<doubling_correction>());
+
+        return std::make_unique<MaRC::PhotoImage>(std::move(window),
+                                                  samples,
+                                                  lines,
+                                                  std::move(config),
+                                                  std::move(geometry));
+    }
+
+    /// Map @a image directly.
+    map_type make_map(MaRC::SourceImage const & image)
+    {
+        MaRC::extrema<double> const minmax;
+        MaRC::plot_info<double> info(map_samples, map_lines);
+
+        return projection->template make_map<double>(image, minmax, info);
+    }
+
+    /// Map @a sources through @a plan.
+    map_type apply_plan(MaRC::ResamplingPlan const & plan,
+                        source_list const & sources)
+    {
+        MaRC::extrema<double> const minmax;
+        MaRC::plot_info<double> info(map_samples, map_lines);
+
+        map_type map;
+
+        plan.apply(sources, minmax, info, map);
+
+        return map;
+    }
+
+    /// Are the maps equal to within floating point error?
+    bool equal(map_type const & a, map_type const & b)
+    {
+        if (a.size() != b.size())
+            return false;
+
+        std::size_t count = 0;
+
+        for (std::size_t n = 0; n < a.size(); ++n) {
+            if (std::isnan(a[n]) || std::isnan(b[n])) {
+                if (std::isnan(a[n]) != std::isnan(b[n]))
+                    return false;
+            } else if (std::abs(a[n] - b[n])
+                       > 1e-9 * std::max(std::abs(a[n]), 1.0)) {
+                return false;
+            } else {
+                ++count;
+            }
+        }
+
+        // Make sure data was actually mapped.
+        return count > 0;
+    }
+}
+
+/**
+ * @test Test that a resampling plan maps a photo as well as new
+ *       data with the same geometry the same way the photo itself
+ *       is mapped.
+ */
+bool test_photo()
+{
+    auto const data = make_data(1);
+    auto const photo = make_photo(data, 30);
+
+    auto const plan =
+        projection->make_plan(*photo, map_samples, map_lines);
+
+    if (plan.empty() || plan.sources() != 1)
+        return false;
+
+    // New data with the same geometry.
+    auto const new_data = make_data(-3);
+    auto const new_photo = make_photo(new_data, 30);
+
+    return
+        equal(make_map(*photo), apply_plan(plan, { data }))
+        && equal(make_map(*new_photo), apply_plan(plan, { new_data }));
+}
+
+/**
+ * @test Test that a resampling plan maps a mosaic the same way the
+ *       mosaic itself is mapped.
+ */
+bool test_mosaic()
+{
+    auto const first  = make_data(1);
+    auto const second = make_data(2);
+
+    MaRC::MosaicImage::list_type images;
+    images.push_back(make_photo(first, 30));
+    images.push_back(make_photo(second, 40));
+
+    MaRC::MosaicImage const mosaic(
+        std::move(images),
+        std::make_unique<MaRC::weighted_average>());
+
+    auto const plan =
+        projection->make_plan(mosaic, map_samples, map_lines);
+
+    return
+        plan.sources() == 2
+        && equal(make_map(mosaic), apply_plan(plan, { first, second }));
+}
+
+/**
+ * @test Test that the source image data retrieved from photos and
+ *       mosaics maps the same way the images themselves are mapped.
+ */
+bool test_resampling_data()
+{
+    auto const first  = make_data(1);
+    auto const second = make_data(2);
+
+    auto const photo = make_photo(first, 30);
+
+    auto const photo_plan =
+        projection->make_plan(*photo, map_samples, map_lines);
+
+    source_list photo_data;
+
+    MaRC::MosaicImage::list_type images;
+    images.push_back(make_photo(first, 30));
+    images.push_back(make_photo(second, 40));
+
+    MaRC::MosaicImage const mosaic(
+        std::move(images),
+        std::make_unique<MaRC::weighted_average>());
+
+    auto const mosaic_plan =
+        projection->make_plan(mosaic, map_samples, map_lines);
+
+    source_list mosaic_data;
+
+    return
+        photo->resampling_data(0, photo_data)
+        && photo_data.size() == 1
+        && equal(make_map(*photo), apply_plan(photo_plan, photo_data))
+        && !photo->resampling_data(1, photo_data)
+        && mosaic.resampling_data(0, mosaic_data)
+        && mosaic_data.size() == 2
+        && equal(make_map(mosaic), apply_plan(mosaic_plan, mosaic_data));
+}
+
+/**
+ * @test Test that photos with a photometric correction, which
+ *       resampling plans cannot record, are rejected rather than
+ *       mapped differently than the photo itself.
+ */
+bool test_photometric_correction()
+{
+    auto const data = make_data(1);
+    auto const photo = make_photo(data, 30);
+    auto const corrected = make_photo(data, 30, true);
+
+    // The correction changes the data read from the photo.
+    auto const plan =
+        projection->make_plan(*photo, map_samples, map_lines);
+
+    if (equal(make_map(*corrected), apply_plan(plan, { data })))
+        return false;
+
+    source_list sources;
+
+    if (!corrected->resampling_sources().empty()
+        || corrected->resampling_data(0, sources)
+        || !sources.empty())
+        return false;
+
+    try {
+        (void) projection->make_plan(*corrected, map_samples, map_lines);
+    } catch (std::invalid_argument const &) {
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @test Test resampling plan serialization.
+ */
+bool test_save_load()
+{
+    auto const data = make_data(1);
+    auto const photo = make_photo(data, 30);
+
+    auto const plan =
+        projection->make_plan(*photo, map_samples, map_lines);
+
+    std::stringstream s;
+
+    plan.save(s);
+
+    auto const loaded = MaRC::ResamplingPlan::load(s);
+
+    if (loaded.size() != plan.size()
+        || !equal(apply_plan(loaded, { data }), apply_plan(plan, { data })))
+        return false;
+
+    // Truncated plan.
+    auto const str = s.str();
+    std::istringstream truncated(str.substr(0, str.size() / 2));
+
+    try {
+        (void) MaRC::ResamplingPlan::load(truncated);
+
+        return false;
+    } catch (std::runtime_error const &) {
+    }
+
+    // Mismatched source image data.
+    try {
+        (void) apply_plan(plan, { std::vector<double>(10) });
+
+        return false;
+    } catch (std::invalid_argument const &) {
+    }
+
+    return true;
+}
+
+/**
+ * @test Test that images not backed by pixels are rejected.
+ */
+bool test_unsupported()
+{
+    constexpr bool graphic_latitudes = false;
+
+    constexpr double scale  = 1;
+    constexpr double offset = 0;
+
+    MaRC::LatitudeImage const image(body,
+                                    graphic_latitudes,
+                                    scale,
+                                    offset);
+
+    try {
+        (void) projection->make_plan(image, map_samples, map_lines);
+    } catch (std::invalid_argument const &) {
+        return true;
+    }
+
+    return false;
+}
+
+int main()
+{
+    return
+        test_photo()
+        && test_mosaic()
+        && test_resampling_data()
+        && test_photometric_correction()
+        && test_save_load()
+        && test_unsupported()
+        ? 0 : -1;
+}
@@ -0,0 +1,270 @@
+/**
+ * @file Sphere_Test.cpp
+ *
+ * Copyright (C) 2026 Ossama Othman
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include <marc/Sphere.h>
+#include <marc/OblateSpheroid.h>
+#include <marc/ViewingGeometry.h>
+#include <marc/PolarStereographic.h>
+#include <marc/LatitudeImage.h>
+#include <marc/Constants.h>
+
+#include <memory>
+#include <type_traits>
+#include <cmath>
+
+
+namespace
+{
+    // Enceladus
+    constexpr bool   prograde = true;
+    constexpr double radius   = 252.1;  // kilometers
+
+    auto const sphere = std::make_shared<MaRC::Sphere>(prograde, radius);
+
+    // Equivalent oblate spheroid.
+    auto const spheroid =
+        std::make_shared<MaRC::OblateSpheroid>(prograde, radius, radius);
+
+    /**
+     * @brief Are @a a and @a b equal to within @a tolerance, or both
+     *        NaN?
+     */
+    bool close(double a, double b, double tolerance = 1e-12)
+    {
+        return (std::isnan(a) && std::isnan(b))
+            || std::abs(a - b) <= tolerance;
+    }
+}
+
+/**
+ * @test Test the sphere specific attributes.
+ */
+bool test_initialization()
+{
+    return
+        sphere->is_sphere()
+        && !spheroid->is_sphere()
+        && sphere->radius() == radius
+        && sphere->eq_rad() == radius
+        && sphere->pol_rad() == radius
+        && sphere->first_eccentricity() == 0
+        && sphere->prograde() == prograde;
+}
+
+/**
+ * @test Test latitude conversions and radii.
+ */
+bool test_latitudes()
+{
+    for (int n = -90; n <= 90; ++n) {
+        double const lat = n * C::degree;
+
+        MaRC::BodyData const & body = *sphere;
+
+        if (body.centric_latitude(lat) != lat
+            || body.graphic_latitude(lat) != lat
+            || body.centric_radius(lat) != radius
+            || !close(spheroid->graphic_latitude(lat), lat)
+            || !close(spheroid->centric_radius(lat), radius, 1e-10))
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ * @test Test that the photometric angle cosines match those of the
+ *       equivalent oblate spheroid.
+ */
+bool test_photometry()
+{
+    constexpr double sub_observ_lat = -14 * C::degree;
+    constexpr double sub_observ_lon = 160 * C::degree;
+    constexpr double sub_solar_lat  = 3 * C::degree;
+    constexpr double sub_solar_lon  = 120 * C::degree;
+    constexpr double range          = 50 * radius;
+
+    MaRC::BodyData const & a = *sphere;
+    MaRC::BodyData const & b = *spheroid;
+
+    for (int i = -89; i < 90; i += 7) {
+        for (int k = 0; k < 360; k += 11) {
+            double const lat = i * C::degree;
+            double const lon = k * C::degree;
+
+            double const mu =
+                a.mu(sub_observ_lat, sub_observ_lon, lat, lon, range);
+            double const mu0 =
+                a.mu0(sub_solar_lat, sub_solar_lon, lat, lon);
+            double const cos_phase =
+                a.cos_phase(sub_observ_lat,
+                            sub_observ_lon,
+                            sub_solar_lat,
+                            sub_solar_lon,
+                            lat,
+                            lon,
+                            range);
+
+            double mu_a, mu0_a, cos_phase_a;
+            double mu_b, mu0_b, cos_phase_b;
+
+            a.photometric_cosines(sub_observ_lat,
+                                  sub_observ_lon,
+                                  sub_solar_lat,
+                                  sub_solar_lon,
+                                  lat,
+                                  lon,
+                                  range,
+                                  mu_a,
+                                  mu0_a,
+                                  cos_phase_a);
+
+            b.photometric_cosines(sub_observ_lat,
+                                  sub_observ_lon,
+                                  sub_solar_lat,
+                                  sub_solar_lon,
+                                  lat,
+                                  lon,
+                                  range,
+                                  mu_b,
+                                  mu0_b,
+                                  cos_phase_b);
+
+            if (!close(mu,
+                       b.mu(sub_observ_lat,
+                            sub_observ_lon,
+                            lat,
+                            lon,
+                            range))
+                || !close(mu0,
+                          b.mu0(sub_solar_lat, sub_solar_lon, lat, lon))
+                || !close(cos_phase,
+                          b.cos_phase(sub_observ_lat,
+                                      sub_observ_lon,
+                                      sub_solar_lat,
+                                      sub_solar_lon,
+                                      lat,
+                                      lon,
+                                      range))
+                || !close(mu_a, mu_b)
+                || !close(mu0_a, mu0_b)
+                || !close(cos_phase_a, cos_phase_b)
+                || mu_a != mu
+                || mu0_a != mu0
+                || cos_phase_a != cos_phase)
+                return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @test Test body type dispatch.
+ */
+bool test_visit_body()
+{
+    auto const sphere_type =
+        [](auto const & body)
+        {
+            return std::is_same_v<std::decay_t<decltype(body)>,
+                                  MaRC::Sphere>;
+        };
+
+    MaRC::OblateSpheroid const & body = *sphere;
+
+    return
+        MaRC::visit_body(body, sphere_type)
+        && !MaRC::visit_body(*spheroid, sphere_type);
+}
+
+/**
+ * @test Test that image conversions match those of the equivalent
+ *       oblate spheroid.
+ */
+bool test_viewing_geometry()
+{
+    MaRC::ViewingGeometry a(sphere);
+    MaRC::ViewingGeometry b(spheroid);
+
+    for (auto * vg : { &a, &b }) {
+        vg->body_center(200.3, 150.8);
+        vg->sub_observ(-14, 160);
+        vg->position_angle(35);
+        vg->sub_solar(3, 120);
+        vg->range(50 * radius);
+        vg->focal_length(1501.039);
+        vg->scale(32.8084);
+        vg->use_terminator(true);
+        vg->finalize_setup(400, 300);
+    }
+
+    for (int i = -89; i < 90; i += 7) {
+        for (int k = 0; k < 360; k += 11) {
+            double const lat = i * C::degree;
+            double const lon = k * C::degree;
+
+            double xa, za;
+            double xb, zb;
+
+            bool const visible = a.latlon2pix(lat, lon, xa, za);
+
+            if (visible != b.latlon2pix(lat, lon, xb, zb)
+                || visible != a.is_visible(lat, lon)
+                || (visible
+                    && (!close(xa, xb, 1e-9) || !close(za, zb, 1e-9))))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @test Test that maps match those of the equivalent oblate
+ *       spheroid.
+ */
+bool test_maps()
+{
+    MaRC::PolarStereographic a(sphere, -30, true);
+    MaRC::PolarStereographic b(spheroid, -30, true);
+
+    MaRC::LatitudeImage const latitudes(sphere, false, 1, 0);
+
+    constexpr std::size_t samples = 101;
+    constexpr std::size_t lines   = 81;
+
+    MaRC::extrema<double> const minmax;
+    MaRC::plot_info<double> info_a(samples, lines);
+    MaRC::plot_info<double> info_b(samples, lines);
+
+    auto const map_a = a.make_map<double>(latitudes, minmax, info_a);
+    auto const map_b = b.make_map<double>(latitudes, minmax, info_b);
+
+    // Degrees
+    constexpr double tolerance = 1e-9;
+
+    for (std::size_t n = 0; n < map_a.size(); ++n)
+        if (!close(map_a[n], map_b[n], tolerance))
+            return false;
+
+    return true;
+}
+
+/// The canonical main entry point.
+int main()
+{
+    return
+        test_initialization()
+        && test_latitudes()
+        && test_photometry()
+        && test_visit_body()
+        && test_viewing_geometry()
+        && test_maps()
+        ? 0 : -1;
+}
@@ -1,7 +1,7 @@
 /**
  * @file Vector_Test.cpp
  *
- * Copyright (C) 2017, 2022  Ossama Othman
+ * Copyright (C) 2017, 2022, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: GPL-2.0-or-later
  */
@@ -215,6 +215,44 @@ bool test_dot_product()
     return MaRC::dot_product(a, b) == dp;
 }
 
+/**
+ * @test Test that the dot product sums its terms from left to right.
+ */
+bool test_dot_product_order()
+{
+    using vector_type = MaRC::Vector<double, 3>;
+
+    // The first term is lost to rounding when added to the second,
+    // but not when the last two terms are added first.
+    vector_type a{ 1, 1e16, -1e16 };
+    vector_type b{ 1, 1,     1    };
+
+    double const dp = (a[0] * b[0] + a[1] * b[1]) + a[2] * b[2];
+
+    return MaRC::dot_product(a, b) == dp;
+}
+
+/**
+ * @test Test compile-time evaluation of MaRC::Vector expressions.
+ */
+bool test_constexpr_expression()
+{
+    using vector_type = MaRC::Vector<int, 3>;
+
+    constexpr vector_type a(2, 3, 5);
+    constexpr vector_type b(7, 11, 13);
+
+    constexpr auto c = (b - a) * 2 + a;
+
+    static_assert(c[0] == 12 && c[1] == 19 && c[2] == 21,
+                  "Vector expression not evaluated at compile-time.");
+
+    static_assert(MaRC::dot_product(a, b) == 112,
+                  "Dot product not evaluated at compile-time.");
+
+    return true;
+}
+
 /// The canonical main entry point.
 int main()
 {
@@ -224,8 +262,11 @@ int main()
         && test_vector_comparison()
         && test_vector_addition()
         && test_vector_subtraction()
+        && test_vector_multiplication()
         && test_vector_magnitude()
         && test_unit_vector()
         && test_dot_product()
+        && test_dot_product_order()
+        && test_constexpr_expression()
         ? 0 : -1;
 }
@@ -1,7 +1,7 @@
 /**
  * @file ViewingGeometry_Test.cpp
  *
- * Copyright (C) 2017, 2022  Ossama Othman
+ * Copyright (C) 2017, 2022, 2026  Ossama Othman
  *
  * SPDX-License-Identifier: GPL-2.0-or-later
  */
@@ -11,6 +11,9 @@
 #include <marc/Constants.h>
 #include <marc/Mathematics.h>
 
+#include <vector>
+#include <cmath>
+
 
 namespace
 {
@@ -117,6 +120,53 @@ bool test_conversion(MaRC::ViewingGeometry & vg)
                               lon / C::degree, 4);
 }
 
+bool test_batch_conversion(MaRC::ViewingGeometry & vg)
+{
+    // Points along an image line crossing the limb on both sides of
+    // the body.
+    constexpr std::size_t n = 161;
+
+    std::vector<double> sample(n);
+    std::vector<double> line(n);
+
+    for (std::size_t i = 0; i < n; ++i) {
+        sample[i] = sample_center + (static_cast<double>(i) - 80) * 50;
+        line[i]   = line_center - 1000 + static_cast<double>(i);
+    }
+
+    std::vector<double> lat;
+    std::vector<double> lon;
+    vg.pix2latlon(sample, line, lat, lon);
+
+    if (lat.size() != n || lon.size() != n)
+        return false;
+
+    // Absolute tolerance in radians.
+    constexpr double tolerance = 1e-12;
+
+    std::size_t on_body = 0;
+
+    for (std::size_t i = 0; i < n; ++i) {
+        double expected_lat = 0;
+        double expected_lon = 0;
+
+        bool const hit =
+            vg.pix2latlon(sample[i], line[i], expected_lat, expected_lon);
+
+        if (hit == std::isnan(lat[i])
+            || hit == std::isnan(lon[i])
+            || (hit
+                && (std::abs(lat[i] - expected_lat) > tolerance
+                    || std::abs(lon[i] - expected_lon) > tolerance)))
+            return false;
+
+        if (hit)
+            ++on_body;
+    }
+
+    return on_body > 0 && on_body < n;
+}
+
 bool test_lat_lon_center()
 {
     MaRC::ViewingGeometry vg(body);  // Different instance from main.
@@ -149,6 +199,7 @@ int main()
         test_initialization(vg)
         && test_visibility(vg)
         && test_conversion(vg)
+        && test_batch_conversion(vg)
         && test_lat_lon_center()
         ? 0 : -1;
 }
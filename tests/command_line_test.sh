@@ -39,3 +39,35 @@ test $? -eq $EX_USAGE || exit 1
 
 $marc -- foo > /dev/null 2>&1
 test $? -ne 0 || exit 1
+
+# Invalid map plane lookahead.
+$marc --lookahead=foo foo > /dev/null 2>&1
+test $? -eq $EX_USAGE || exit 1
+
+$marc --lookahead=-1 foo > /dev/null 2>&1
+test $? -eq $EX_USAGE || exit 1
+
+# Invalid map batch size.
+$marc --batch=foo foo > /dev/null 2>&1
+test $? -eq $EX_USAGE || exit 1
+
+$marc --batch=0 foo > /dev/null 2>&1
+test $? -eq $EX_USAGE || exit 1
+
+# Invalid compression tile size.
+$marc --tile=foo foo > /dev/null 2>&1
+test $? -eq $EX_USAGE || exit 1
+
+$marc --tile=100 foo > /dev/null 2>&1
+test $? -eq $EX_USAGE || exit 1
+
+$marc --tile=0x1 foo > /dev/null 2>&1
+test $? -eq $EX_USAGE || exit 1
+
+# Invalid floating point quantization level.
+$marc --quantize=foo foo > /dev/null 2>&1
+test $? -eq $EX_USAGE || exit 1
+
+# Empty resampling plan file name.
+$marc --resampling-plan= foo > /dev/null 2>&1
+test $? -eq $EX_USAGE || exit 1
@@ -0,0 +1,88 @@
+/**
+ * @file conformal_latitude_test.cpp
+ *
+ * Copyright (C) 2026 Ossama Othman
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include <marc/conformal_latitude.h>
+#include <marc/Constants.h>
+
+#include <stdexcept>
+#include <cmath>
+
+
+/**
+ * @test Test that MaRC::conformal_latitude::graphic() inverts
+ *       MaRC::conformal_latitude::conformal() across all latitudes.
+ */
+bool test_round_trip(double e)
+{
+    MaRC::conformal_latitude const c(e);
+
+    // Maximum documented error in radians.
+    constexpr double tolerance = 1e-12;
+
+    constexpr int steps = 20000;
+
+    for (int i = -steps; i <= steps; ++i) {
+        double const latg = static_cast<double>(i) / steps * C::pi_2;
+        double const chi  = c.conformal(latg);
+
+        // The conformal latitude is never further from the equator.
+        if (std::abs(chi) > std::abs(latg) + tolerance
+            || std::abs(c.graphic(chi) - latg) > tolerance)
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ * @test Test that latitudes on a sphere are already conformal.
+ */
+bool test_sphere()
+{
+    MaRC::conformal_latitude const c(0);
+
+    for (double latg = -C::pi_2; latg <= C::pi_2; latg += 0.01)
+        if (std::abs(c.conformal(latg) - latg) > 1e-15
+            || std::abs(c.graphic(latg) - latg) > 1e-15)
+            return false;
+
+    return true;
+}
+
+/**
+ * @test Test that MaRC::conformal_latitude rejects invalid
+ *       eccentricities.
+ */
+bool test_invalid_eccentricity()
+{
+    try {
+        MaRC::conformal_latitude const c(1);
+    } catch (std::invalid_argument const &) {
+        try {
+            MaRC::conformal_latitude const c(-0.1);
+        } catch (std::invalid_argument const &) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/// The canonical main entry point.
+int main()
+{
+    return
+        test_round_trip(0.0818192)  // Earth (WGS 84)
+        && test_round_trip(0.354)   // Jupiter
+        && test_round_trip(0.7)
+        && test_round_trip(0.866)   // Polar radius half of equatorial
+        && test_round_trip(0.99)
+        && test_sphere()
+        && test_invalid_eccentricity()
+        ? 0 : -1;
+}
@@ -0,0 +1,327 @@
+/**
+ * @file fast_math_test.cpp
+ *
+ * Copyright (C) 2026 Ossama Othman
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include <marc/fast_math.h>
+#include <marc/Orthographic.h>
+#include <marc/PolarStereographic.h>
+#include <marc/OblateSpheroid.h>
+#include <marc/LatitudeImage.h>
+#include <marc/LongitudeImage.h>
+
+#include <memory>
+#include <initializer_list>
+#include <limits>
+#include <cmath>
+
+
+namespace
+{
+    /**
+     * @brief Additional error allowance in ULP.
+     *
+     * The reference results are computed in @c long double.  Allow
+     * for the reference itself being off by up to a half ULP where
+     * @c long double is no more precise than @c double.
+     */
+    constexpr double slack =
+        std::numeric_limits<long double>::digits
+        > std::numeric_limits<double>::digits ? 0 : 1;
+
+    /// Number of arguments at which each function is checked.
+    constexpr int samples = 200000;
+
+    /**
+     * @brief Error of @a value in units in the last place.
+     *
+     * @param[in] value     Value to be checked.
+     * @param[in] reference Higher precision reference value.
+     */
+    double ulp_error(double value, long double reference)
+    {
+        double const r = std::abs(static_cast<double>(reference));
+        double const ulp =
+            (r == 0
+             ? std::numeric_limits<double>::denorm_min()
+             : std::nextafter(r, std::numeric_limits<double>::infinity())
+               - r);
+
+        return static_cast<double>(std::abs(value - reference) / ulp);
+    }
+
+    /**
+     * @brief Deterministic argument spread over [@a lo, @a hi].
+     *
+     * The golden ratio based offset keeps the arguments from lining
+     * up with multiples of pi.
+     */
+    double argument(int i, double lo, double hi)
+    {
+        constexpr double phi = 0.6180339887498949;
+
+        double const f = std::fmod((i + 0.5) * phi, 1.0);
+
+        return lo + (hi - lo) * f;
+    }
+
+    /**
+     * @brief Check the error of a function of one argument.
+     *
+     * @param[in] f         Function being checked.
+     * @param[in] reference Higher precision reference function.
+     * @param[in] lo        Lower bound of the arguments.
+     * @param[in] hi        Upper bound of the arguments.
+     * @param[in] bound     Maximum error in ULP.
+     */
+    template <typename F, typename R>
+    bool check(F f, R reference, double lo, double hi, double bound)
+    {
+        for (int i = 0; i < samples; ++i) {
+            double const x = argument(i, lo, hi);
+
+            if (ulp_error(f(x), reference(x)) > bound + slack)
+                return false;
+        }
+
+        return true;
+    }
+
+    /// Are @a a and @a b identical, including the sign of zero?
+    bool same(double a, double b)
+    {
+        return (std::isnan(a) && std::isnan(b))
+            || (a == b && std::signbit(a) == std::signbit(b));
+    }
+
+    constexpr double infinity =
+        std::numeric_limits<double>::infinity();
+    constexpr double not_a_number =
+        std::numeric_limits<double>::quiet_NaN();
+}
+
+/**
+ * @test Test the accuracy of the sine, cosine and tangent.
+ */
+bool test_trigonometric()
+{
+    auto const sin_fast = [](double x) { return MaRC::fast::sin(x); };
+    auto const cos_fast = [](double x) { return MaRC::fast::cos(x); };
+    auto const tan_fast = [](double x) { return MaRC::fast::tan(x); };
+    auto const sin_ref  = [](long double x) { return std::sin(x); };
+    auto const cos_ref  = [](long double x) { return std::cos(x); };
+    auto const tan_ref  = [](long double x) { return std::tan(x); };
+
+    auto const sincos_consistent =
+        [](double x)
+        {
+            double s, c;
+            MaRC::fast::sincos(x, s, c);
+
+            return same(s, MaRC::fast::sin(x))
+                && same(c, MaRC::fast::cos(x));
+        };
+
+    for (double range : { 1.0, 10.0, 1e3, 1e5 })
+        if (!check(sin_fast, sin_ref, -range, range, 1.5)
+            || !check(cos_fast, cos_ref, -range, range, 1.5)
+            || !check(tan_fast, tan_ref, -range, range, 3)
+            || !sincos_consistent(range / 3))
+            return false;
+
+    return same(MaRC::fast::sin(0.0), 0.0)
+        && same(MaRC::fast::sin(-0.0), -0.0)
+        && same(MaRC::fast::cos(0.0), 1.0)
+        && std::isnan(MaRC::fast::sin(infinity))
+        && std::isnan(MaRC::fast::cos(-infinity))
+        && std::isnan(MaRC::fast::tan(not_a_number));
+}
+
+/**
+ * @test Test the accuracy of the arc tangent.
+ */
+bool test_atan()
+{
+    auto const atan_fast = [](double x) { return MaRC::fast::atan(x); };
+    auto const atan_ref  = [](long double x) { return std::atan(x); };
+
+    if (!check(atan_fast, atan_ref, -2, 2, 2)
+        || !check(atan_fast, atan_ref, -1e3, 1e3, 2))
+        return false;
+
+    // Quadrant and sign handling over a spread of arguments.
+    for (int i = 0; i < samples; ++i) {
+        double const y = argument(i, -1e4, 1e4);
+        double x = argument(i * 7 + 3, -1e4, 1e4);
+
+        // Include nearly vertical directions.
+        if (i % 3 == 0)
+            x *= 1e-6;
+
+        long double const reference =
+            std::atan2(static_cast<long double>(y),
+                       static_cast<long double>(x));
+
+        if (ulp_error(MaRC::fast::atan2(y, x), reference) > 2 + slack)
+            return false;
+    }
+
+    // Special values, including signed zeros, match std::atan2().
+    constexpr double special[] =
+        { 0.0, -0.0, 1.0, -1.0, 1e-310, -1e-310,
+          infinity, -infinity, not_a_number };
+
+    for (double y : special) {
+        for (double x : special) {
+            double const expected = std::atan2(y, x);
+            double const actual   = MaRC::fast::atan2(y, x);
+
+            if (!same(expected, actual)
+                && ulp_error(actual, expected) > 1)
+                return false;
+        }
+    }
+
+    return same(MaRC::fast::atan(-0.0), -0.0)
+        && MaRC::fast::atan(infinity) == std::atan(infinity)
+        && std::isnan(MaRC::fast::atan(not_a_number));
+}
+
+/**
+ * @test Test the accuracy of the hypotenuse.
+ */
+bool test_hypot()
+{
+    for (int i = 0; i < samples; ++i) {
+        double const x = argument(i, -1e4, 1e4);
+        double const y = argument(i * 5 + 1, -1e4, 1e4);
+
+        long double const reference =
+            std::hypot(static_cast<long double>(x),
+                       static_cast<long double>(y));
+
+        if (ulp_error(MaRC::fast::hypot(x, y), reference) > 1.5 + slack)
+            return false;
+    }
+
+    return MaRC::fast::hypot(-3, 4) == 5
+        && MaRC::fast::hypot(0, 0) == 0
+        && std::isnan(MaRC::fast::hypot(not_a_number, 1));
+}
+
+/**
+ * @test Test the accuracy of the natural logarithm.
+ */
+bool test_log()
+{
+    auto const log_fast = [](double x) { return MaRC::fast::log(x); };
+    auto const log_ref  = [](long double x) { return std::log(x); };
+
+    // Arguments spread over most of the double exponent range.
+    auto const log_exp_fast =
+        [](double x) { return MaRC::fast::log(std::exp(x)); };
+    auto const log_exp_ref =
+        [](long double x)
+        {
+            return std::log(
+                static_cast<long double>(std::exp(static_cast<double>(x))));
+        };
+
+    if (!check(log_fast, log_ref, 0.5, 2, 1)
+        || !check(log_exp_fast, log_exp_ref, -740, 700, 1))
+        return false;
+
+    return MaRC::fast::log(1) == 0
+        && MaRC::fast::log(0) == -infinity
+        && MaRC::fast::log(-0.0) == -infinity
+        && MaRC::fast::log(infinity) == infinity
+        && std::isnan(MaRC::fast::log(-1))
+        && std::isnan(MaRC::fast::log(not_a_number));
+}
+
+/**
+ * @test Test that maps created with fast math match those created
+ *       with the standard library functions, including which map
+ *       pixels are blank.
+ */
+bool test_maps()
+{
+    // Jupiter
+    auto const body =
+        std::make_shared<MaRC::OblateSpheroid>(true, 71492, 66854);
+
+    MaRC::LatitudeImage const latitudes(body, false, 1, 0);
+    MaRC::LongitudeImage const longitudes(1, 0);
+
+    using map_type = MaRC::MapFactory::map_type<double>;
+
+    auto const equal_maps =
+        [&](MaRC::MapFactory & exact, MaRC::MapFactory & fast)
+        {
+            constexpr std::size_t map_samples = 201;
+            constexpr std::size_t map_lines   = 151;
+
+            exact.math(MaRC::math_mode::exact);
+            fast.math(MaRC::math_mode::fast);
+
+            MaRC::extrema<double> const minmax;
+
+            for (auto const * image :
+                     { static_cast<MaRC::SourceImage const *>(&latitudes),
+                       static_cast<MaRC::SourceImage const *>(&longitudes)
+                     }) {
+                MaRC::plot_info<double> exact_info(map_samples, map_lines);
+                MaRC::plot_info<double> fast_info(map_samples, map_lines);
+
+                map_type const a =
+                    exact.make_map<double>(*image, minmax, exact_info);
+                map_type const b =
+                    fast.make_map<double>(*image, minmax, fast_info);
+
+                // Within a tiny fraction of a map pixel, in degrees.
+                constexpr double tolerance = 1e-9;
+
+                for (std::size_t n = 0; n < a.size(); ++n)
+                    if (std::isnan(a[n]) != std::isnan(b[n])
+                        || std::abs(a[n] - b[n]) > tolerance)
+                        return false;
+            }
+
+            return true;
+        };
+
+    MaRC::Orthographic ortho_exact(body,
+                                   -14,
+                                   160,
+                                   35,
+                                   -1,
+                                   MaRC::OrthographicCenter());
+    MaRC::Orthographic ortho_fast(body,
+                                  -14,
+                                  160,
+                                  35,
+                                  -1,
+                                  MaRC::OrthographicCenter());
+
+    MaRC::PolarStereographic ps_exact(body, -30, true);
+    MaRC::PolarStereographic ps_fast(body, -30, true);
+
+    return ortho_exact.math() == MaRC::math_mode::exact
+        && equal_maps(ortho_exact, ortho_fast)
+        && equal_maps(ps_exact, ps_fast);
+}
+
+/// The canonical main entry point.
+int main()
+{
+    return
+        test_trigonometric()
+        && test_atan()
+        && test_hypot()
+        && test_log()
+        && test_maps()
+        ? 0 : -1;
+}
@@ -0,0 +1,205 @@
+/**
+ * @file graticule_test.cpp
+ *
+ * Copyright (C) 2026 Ossama Othman
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include <marc/graticule.h>
+#include <marc/Orthographic.h>
+#include <marc/PolarStereographic.h>
+#include <marc/OblateSpheroid.h>
+#include <marc/Constants.h>
+
+#include <memory>
+#include <vector>
+#include <stdexcept>
+#include <algorithm>
+#include <cstdint>
+
+
+namespace
+{
+    using grid_type = std::vector<std::uint8_t>;
+
+    /**
+     * @brief Are all grid line pixels in a single 8-connected
+     *        component?
+     *
+     * @param[in] grid    Grid to be checked.
+     * @param[in] samples Number of samples in the grid.
+     * @param[in] lines   Number of lines in the grid.
+     */
+    bool connected(grid_type const & grid,
+                   std::size_t samples,
+                   std::size_t lines)
+    {
+        auto const first =
+            std::find_if(grid.begin(),
+                         grid.end(),
+                         [](auto p) { return p != 0; });
+
+        if (first == grid.end())
+            return false;  // Empty grid.
+
+        std::vector<bool> seen(grid.size());
+        std::vector<std::size_t> pending {
+            static_cast<std::size_t>(first - grid.begin())
+        };
+
+        seen[pending.back()] = true;
+
+        std::size_t count = 0;
+
+        while (!pending.empty()) {
+            std::size_t const offset = pending.back();
+            pending.pop_back();
+            ++count;
+
+            std::size_t const i = offset % samples;
+            std::size_t const k = offset / samples;
+
+            for (std::size_t kk = (k > 0 ? k - 1 : k);
+                 kk <= k + 1 && kk < lines;
+                 ++kk) {
+                for (std::size_t ii = (i > 0 ? i - 1 : i);
+                     ii <= i + 1 && ii < samples;
+                     ++ii) {
+                    std::size_t const n = kk * samples + ii;
+
+                    if (grid[n] != 0 && !seen[n]) {
+                        seen[n] = true;
+                        pending.push_back(n);
+                    }
+                }
+            }
+        }
+
+        return
+            count == static_cast<std::size_t>(
+                std::count_if(grid.begin(),
+                              grid.end(),
+                              [](auto p) { return p != 0; }));
+    }
+}
+
+/**
+ * @test Test grid size validation.
+ */
+bool test_grid_size()
+{
+    auto const forward =
+        [](double, double, double &, double &) { return true; };
+
+    grid_type grid(10 * 20 - 1);
+
+    try {
+        MaRC::plot_graticule(10, 20, 10, 10, forward, grid);
+    } catch (std::invalid_argument const &) {
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @test Test that grid lines fill exactly the expected map pixels in
+ *       a projection where they are straight map rows and columns.
+ */
+bool test_rows_and_columns()
+{
+    constexpr std::size_t samples = 360;
+    constexpr std::size_t lines   = 181;
+
+    // One map pixel per degree, with grid lines through the centers
+    // of the map pixels.
+    auto const forward =
+        [](double lat, double lon, double & sample, double & line)
+        {
+            sample = lon / C::degree + 0.5;
+            line   = lat / C::degree + 90.5;
+
+            return true;
+        };
+
+    constexpr double lat_interval = 30;
+    constexpr double lon_interval = 45;
+
+    grid_type grid(samples * lines);
+
+    MaRC::plot_graticule(samples,
+                         lines,
+                         lat_interval,
+                         lon_interval,
+                         forward,
+                         grid);
+
+    for (std::size_t k = 0; k < lines; ++k) {
+        bool const lat_line =
+            (k % 30 == 0 && k != 0 && k != lines - 1);
+
+        for (std::size_t i = 0; i < samples; ++i) {
+            bool const lon_line = (i % 45 == 0);
+            bool const expected = lat_line || lon_line;
+
+            if ((grid[k * samples + i] != 0) != expected)
+                return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @test Test that grid lines remain unbroken in large maps.
+ */
+bool test_connected()
+{
+    // Jupiter
+    auto const body =
+        std::make_shared<MaRC::OblateSpheroid>(true, 71492, 66854);
+
+    MaRC::Orthographic const ortho(body,
+                                   -14,
+                                   160,
+                                   35,
+                                   -1,
+                                   MaRC::OrthographicCenter());
+
+    MaRC::PolarStereographic const ps(body, -30, true);
+
+    // The equator, and the prime meridian continued over the poles
+    // on to the opposite meridian, cross on the visible side of the
+    // body in both projections.
+    constexpr double lat_interval = 90;
+    constexpr double lon_interval = 180;
+
+    for (std::size_t const size : { 100, 3000 }) {
+        if (!connected(ortho.make_grid(size,
+                                       size,
+                                       lat_interval,
+                                       lon_interval),
+                       size,
+                       size)
+            || !connected(ps.make_grid(size,
+                                       size,
+                                       lat_interval,
+                                       lon_interval),
+                          size,
+                          size))
+            return false;
+    }
+
+    return true;
+}
+
+/// The canonical main entry point.
+int main()
+{
+    return
+        test_grid_size()
+        && test_rows_and_columns()
+        && test_connected()
+        ? 0 : -1;
+}
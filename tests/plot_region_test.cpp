@@ -0,0 +1,348 @@
+/**
+ * @file plot_region_test.cpp
+ *
+ * Copyright (C) 2026 Ossama Othman
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include <marc/plot_region.h>
+
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <cstddef>
+
+
+namespace
+{
+    /**
+     * @brief Check the internal consistency of a region.
+     *
+     * Spans on each line must be non-empty, within the map, sorted,
+     * and neither overlapping nor adjacent.  Their total length must
+     * match the region size.
+     */
+    bool consistent(MaRC::plot_region const & region)
+    {
+        std::size_t size = 0;
+
+        for (std::size_t k = 0; k < region.lines(); ++k) {
+            std::size_t next = 0;
+            bool first = true;
+
+            for (auto const & s : region.spans(k)) {
+                if (s.first >= s.last
+                    || s.last > region.samples()
+                    || (!first && s.first <= next))
+                    return false;
+
+                size += s.last - s.first;
+                next = s.last;
+                first = false;
+            }
+        }
+
+        return size == region.size();
+    }
+}
+
+/**
+ * @test Test a MaRC::plot_region spanning the entire map.
+ */
+bool test_entire_map()
+{
+    constexpr std::size_t samples = 13;
+    constexpr std::size_t lines   = 7;
+
+    MaRC::plot_region const region(samples, lines);
+
+    if (region.samples() != samples
+        || region.lines() != lines
+        || region.size() != samples * lines
+        || !region.full()
+        || !consistent(region))
+        return false;
+
+    for (std::size_t k = 0; k < lines; ++k)
+        for (std::size_t i = 0; i < samples; ++i)
+            if (!region.contains(i, k))
+                return false;
+
+    return !region.contains(samples, 0) && !region.contains(0, lines);
+}
+
+/**
+ * @test Test that a MaRC::plot_region made of tiles contains exactly
+ *       the pixels in its non-empty tiles.
+ */
+bool test_tiles(std::size_t samples, std::size_t lines, std::size_t tile)
+{
+    auto const tile_samples = (samples + tile - 1) / tile;
+    auto const tile_lines   = (lines   + tile - 1) / tile;
+
+    std::vector<bool> tiles(tile_samples * tile_lines);
+
+    // Scattered tiles, including isolated, adjacent and edge tiles.
+    for (std::size_t n = 0; n < tiles.size(); ++n)
+        tiles[n] = (n * 7 % 5 < 2) || n + 1 == tiles.size();
+
+    MaRC::plot_region const region(samples, lines, tile, tiles);
+
+    if (!consistent(region) || region.full())
+        return false;
+
+    std::size_t size = 0;
+
+    for (std::size_t k = 0; k < lines; ++k) {
+        for (std::size_t i = 0; i < samples; ++i) {
+            bool const expected =
+                tiles[(k / tile) * tile_samples + i / tile];
+
+            if (region.contains(i, k) != expected)
+                return false;
+
+            if (expected)
+                ++size;
+        }
+    }
+
+    return size == region.size();
+}
+
+/**
+ * @test Test MaRC::plot_region with no non-empty tiles.
+ */
+bool test_empty()
+{
+    constexpr std::size_t samples = 20;
+    constexpr std::size_t lines   = 10;
+    constexpr std::size_t tile    = 8;
+
+    std::vector<bool> const tiles(3 * 2, false);
+
+    MaRC::plot_region const region(samples, lines, tile, tiles);
+
+    if (region.size() != 0 || !consistent(region))
+        return false;
+
+    for (std::size_t k = 0; k < lines; ++k)
+        if (!region.spans(k).empty())
+            return false;
+
+    return true;
+}
+
+/**
+ * @test Test that MaRC::plot_region rejects tile masks that don't
+ *       match the map.
+ */
+bool test_invalid_tiles()
+{
+    try {
+        MaRC::plot_region const region(20, 10, 8, std::vector<bool>(4));
+    } catch (std::invalid_argument const &) {
+        try {
+            MaRC::plot_region const region(20, 10, 0, std::vector<bool>());
+        } catch (std::invalid_argument const &) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @test Test that a MaRC::plot_region made of spans contains exactly
+ *       those spans, merged.
+ */
+bool test_spans()
+{
+    using span = MaRC::plot_region::span;
+
+    std::vector<std::vector<span>> rows {
+        { { 6, 9 }, { 0, 2 }, { 2, 4 } },
+        { },
+        { { 1, 5 }, { 3, 7 }, { 9, 10 } }
+    };
+
+    MaRC::plot_region const region(10, 3, rows);
+
+    if (!consistent(region)
+        || region.size() != 7 + 0 + 7
+        || region.contains(4, 0)
+        || !region.contains(3, 0)
+        || !region.spans(1).empty()
+        || region.contains(7, 2)
+        || !region.contains(9, 2))
+        return false;
+
+    rows[2].push_back({ 5, 11 });
+
+    try {
+        MaRC::plot_region const beyond(10, 3, rows);
+    } catch (std::invalid_argument const &) {
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @test Test that a MaRC::plot_region culled top-down only refines
+ *       mixed blocks, and contains exactly the pixels in the full
+ *       blocks and the smallest mixed blocks.
+ */
+bool test_culling(std::size_t samples, std::size_t lines, std::size_t tile)
+{
+    using extent = MaRC::plot_region::tile_extent;
+    using state  = MaRC::plot_region::tile_state;
+
+    // Disk of map pixels to be plotted.
+    auto const in_disk =
+        [samples, lines](std::size_t i, std::size_t k)
+        {
+            double const x = i + 0.5 - 0.37 * samples;
+            double const y = k + 0.5 - 0.42 * lines;
+            double const r = 0.3 * std::min(samples, lines);
+
+            return x * x + y * y <= r * r;
+        };
+
+    struct block
+    {
+        extent e;
+        state  s;
+    };
+
+    std::vector<block> classified;
+    bool valid = true;
+
+    auto const contains =
+        [](extent const & outer, extent const & inner)
+        {
+            return
+                inner.first_sample    >= outer.first_sample
+                && inner.last_sample  <= outer.last_sample
+                && inner.first_line   >= outer.first_line
+                && inner.last_line    <= outer.last_line;
+        };
+
+    auto const classify =
+        [&](std::vector<extent> const & tiles)
+        {
+            std::vector<state> states;
+
+            for (auto const & t : tiles) {
+                // Blocks are only refined if they are mixed.
+                for (auto const & b : classified)
+                    if (b.s != state::mixed && contains(b.e, t))
+                        valid = false;
+
+                std::size_t count  = 0;
+                std::size_t inside = 0;
+
+                for (auto k = t.first_line; k < t.last_line; ++k)
+                    for (auto i = t.first_sample; i < t.last_sample; ++i) {
+                        ++count;
+
+                        if (in_disk(i, k))
+                            ++inside;
+                    }
+
+                auto const s =
+                    (inside == 0
+                     ? state::empty
+                     : (inside == count ? state::full : state::mixed));
+
+                classified.push_back({ t, s });
+                states.push_back(s);
+            }
+
+            return states;
+        };
+
+    MaRC::plot_region const region(samples, lines, tile, classify);
+
+    if (!valid
+        || !consistent(region)
+        || region.full()
+        || region.size() == 0
+        || classified.empty()
+        || classified.front().e.last_sample != samples
+        || classified.front().e.last_line != lines)
+        return false;
+
+    std::size_t size = 0;
+
+    for (std::size_t k = 0; k < lines; ++k) {
+        for (std::size_t i = 0; i < samples; ++i) {
+            bool expected = false;
+
+            for (auto const & b : classified) {
+                auto const & e = b.e;
+
+                if (i >= e.first_sample && i < e.last_sample
+                    && k >= e.first_line && k < e.last_line
+                    && (b.s == state::full
+                        || (b.s == state::mixed
+                            && e.last_sample - e.first_sample <= tile
+                            && e.last_line - e.first_line <= tile)))
+                    expected = true;
+            }
+
+            if (region.contains(i, k) != expected
+                || (in_disk(i, k) && !expected))
+                return false;
+
+            if (expected)
+                ++size;
+        }
+    }
+
+    return size == region.size();
+}
+
+/**
+ * @test Test that MaRC::plot_region rejects classifiers that don't
+ *       classify every block.
+ */
+bool test_invalid_classifier()
+{
+    using extent = MaRC::plot_region::tile_extent;
+    using state  = MaRC::plot_region::tile_state;
+
+    try {
+        MaRC::plot_region const region(
+            20,
+            10,
+            8,
+            [](std::vector<extent> const &)
+            {
+                return std::vector<state>();
+            });
+    } catch (std::invalid_argument const &) {
+        return true;
+    }
+
+    return false;
+}
+
+/// The canonical main entry point.
+int main()
+{
+    return
+        test_entire_map()
+        && test_tiles(64, 32, 8)
+        && test_tiles(101, 37, 8)
+        && test_tiles(5, 3, 2)
+        && test_tiles(300, 170, 4)
+        && test_empty()
+        && test_invalid_tiles()
+        && test_spans()
+        && test_culling(100, 70, 4)
+        && test_culling(64, 64, 8)
+        && test_culling(37, 90, 8)
+        && test_invalid_classifier()
+        ? 0 : -1;
+}
@@ -0,0 +1,156 @@
+/**
+ * @file resampling_plan_file_test.cpp
+ *
+ * Copyright (C) 2026 Ossama Othman
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * @author Ossama Othman
+ */
+
+#include "../src/resampling_plan_file.h"
+
+#include <marc/Mercator.h>
+#include <marc/PhotoImage.h>
+#include <marc/PhotoImageParameters.h>
+#include <marc/ViewingGeometry.h>
+#include <marc/OblateSpheroid.h>
+
+#include <vector>
+#include <memory>
+#include <stdexcept>
+#include <cstdio>
+
+
+namespace
+{
+    char const filename[] = "resampling_plan_file_test.plan";
+
+    constexpr std::size_t map_samples = 90;
+    constexpr std::size_t map_lines   = 45;
+
+    constexpr std::size_t samples = 100;
+    constexpr std::size_t lines   = 80;
+
+    std::shared_ptr<MaRC::OblateSpheroid> body =
+        std::make_shared<MaRC::OblateSpheroid>(true, 71492, 66854);
+
+    MaRC::Mercator const projection(body);
+
+    /// Create a photo of Jupiter with the given data scale.
+    std::unique_ptr<MaRC::SourceImage> make_photo(double scale)
+    {
+        std::vector<double> image(samples * lines);
+
+        for (std::size_t n = 0; n < image.size(); ++n)
+            image[n] = scale * n;
+
+        auto geometry = std::make_unique<MaRC::ViewingGeometry>(body);
+
+        geometry->body_center(samples / 2.0, lines / 2.0);
+        geometry->sub_observ(10, 30);
+        geometry->position_angle(0);
+        geometry->sub_solar(0, 30);
+        geometry->range(1e7);
+        geometry->km_per_pixel(2000);
+        geometry->finalize_setup(samples, lines);
+
+        return std::make_unique<MaRC::PhotoImage>(
+            std::move(image),
+            samples,
+            lines,
+            std::make_unique<MaRC::PhotoImageParameters>(),
+            std::move(geometry));
+    }
+}
+
+/**
+ * @test Test that plans recorded in a resampling plan file are read
+ *       back in order by later runs.
+ */
+bool test_record_and_reuse()
+{
+    auto const first  = make_photo(1);
+    auto const second = make_photo(2);
+
+    std::remove(filename);
+
+    std::size_t first_size  = 0;
+    std::size_t second_size = 0;
+
+    {
+        MaRC::resampling_plan_file plans(filename);
+
+        if (!plans.recording())
+            return false;
+
+        first_size =
+            plans.next(projection, *first, map_samples, map_lines).size();
+
+        // Different map dimensions, hence a different plan.
+        second_size =
+            plans.next(projection, *second, map_lines, map_lines).size();
+    }
+
+    MaRC::resampling_plan_file plans(filename);
+
+    if (plans.recording())
+        return false;
+
+    auto const plan =
+        plans.next(projection, *second, map_samples, map_lines);
+
+    if (first_size == 0
+        || plan.size() != first_size
+        || plan.samples() != map_samples
+        || plans.next(projection,
+                      *first,
+                      map_lines,
+                      map_lines).size() != second_size)
+        return false;
+
+    // No more recorded plans.
+    try {
+        plans.next(projection, *first, map_samples, map_lines);
+    } catch (std::runtime_error const &) {
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @test Test that plans that do not match the map being created are
+ *       rejected.
+ */
+bool test_mismatch()
+{
+    auto const photo = make_photo(1);
+
+    std::remove(filename);
+
+    {
+        MaRC::resampling_plan_file plans(filename);
+
+        plans.next(projection, *photo, map_samples, map_lines);
+    }
+
+    MaRC::resampling_plan_file plans(filename);
+
+    try {
+        plans.next(projection, *photo, map_lines, map_lines);
+    } catch (std::runtime_error const &) {
+        return true;
+    }
+
+    return false;
+}
+
+int main()
+{
+    bool const result = test_record_and_reuse() && test_mismatch();
+
+    std::remove(filename);
+
+    return result ? 0 : -1;
+}
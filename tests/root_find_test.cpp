@@ -1,7 +1,7 @@
 /**
  * @file root_find_test.cpp
  *
- * Copyright (C) 2017 Ossama Othman
+ * Copyright (C) 2017, 2026 Ossama Othman
  *
  * SPDX-License-Identifier: GPL-2.0-or-later
  */
@@ -9,6 +9,10 @@
 #include <marc/root_find.h>
 #include <marc/Mathematics.h>
 
+#include <vector>
+#include <stdexcept>
+#include <cmath>
+
 
 /**
  * @test Test the MaRC::root_find() function.
@@ -42,8 +46,102 @@ bool test_root_find()
         && MaRC::almost_zero(MaRC::root_find(y, x0, f), epsilons);
 }
 
+/**
+ * @test Test the MaRC::root_find() function template with an
+ *       analytic derivative.
+ */
+bool test_analytic_derivative()
+{
+    constexpr int ulps = 2;
+
+    auto const f  = [](double x) { return std::sinh(x); };
+    auto const df = [](double x) { return std::cosh(x); };
+
+    constexpr double x = 0.75;
+    double const y = f(x);
+
+    return
+        MaRC::almost_equal(MaRC::root_find(y, -2.0, 3.0, f, df), x, ulps)
+        && MaRC::almost_equal(MaRC::root_find(y,
+                                              -2.0,
+                                              3.0,
+                                              f,
+                                              MaRC::numerical_derivative(f)),
+                              x,
+                              ulps);
+}
+
+/**
+ * @test Test the batch MaRC::root_find() function template.
+ */
+bool test_batch()
+{
+    constexpr int ulps = 2;
+
+    auto const f  = [](double x) { return x * x * x + x; };
+    auto const df = [](double x) { return 3 * x * x + 1; };
+
+    constexpr double xl = -3;
+    constexpr double xh =  4;
+
+    // Include roots at both ends of the bracket.
+    std::vector<double> const expected { xl, -1.5, 0.25, 1, 2.5, xh };
+
+    std::vector<double> y;
+    for (auto const x : expected)
+        y.push_back(f(x));
+
+    std::vector<double> roots;
+    MaRC::root_find(y, xl, xh, f, df, roots);
+
+    if (roots.size() != expected.size())
+        return false;
+
+    for (std::size_t i = 0; i < roots.size(); ++i)
+        if (!MaRC::almost_equal(roots[i], expected[i], ulps)
+            || !MaRC::almost_equal(roots[i],
+                                   MaRC::root_find(y[i], xl, xh, f, df),
+                                   ulps))
+            return false;
+
+    return true;
+}
+
+/**
+ * @test Test that the MaRC::root_find() function templates reject
+ *       unsuitable brackets.
+ */
+bool test_invalid_bracket()
+{
+    auto const f  = [](double x) { return x * x + 1; };
+    auto const df = [](double x) { return 2 * x; };
+
+    try {
+        MaRC::root_find(0, -1.0, 1.0, f, df);
+    } catch (std::invalid_argument const &) {
+        try {
+            std::vector<double> x;
+            MaRC::root_find(std::vector<double>{ 1.5, 0 },
+                            0.0,
+                            1.0,
+                            f,
+                            df,
+                            x);
+        } catch (std::invalid_argument const &) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 /// The canonical main entry point.
 int main()
 {
-    return test_root_find() ? 0 : -1;
+    return
+        test_root_find()
+        && test_analytic_derivative()
+        && test_batch()
+        && test_invalid_bracket()
+        ? 0 : -1;
 }
@@ -0,0 +1,165 @@
+/**
+ * @file thread_pool_test.cpp
+ *
+ * Copyright (C) 2026 Ossama Othman
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * @author Ossama Othman
+ */
+
+#include "../src/thread_pool.h"
+
+#include <vector>
+#include <string>
+#include <stdexcept>
+#include <atomic>
+#include <thread>
+#include <chrono>
+
+
+/**
+ * @test Test that MaRC::thread_pool runs every task in a batch, and
+ *       that index-addressed results are deterministic.
+ */
+bool test_run(std::size_t threads)
+{
+    MaRC::thread_pool pool(threads);
+
+    constexpr std::size_t count = 300;
+
+    // Run more than one batch through the same pool.
+    for (int batch = 0; batch < 3; ++batch) {
+        std::vector<std::size_t> results(count, 0);
+
+        pool.run(count,
+                 [&results](std::size_t i)
+                 {
+                     results[i] = i * i;
+                 });
+
+        for (std::size_t i = 0; i < count; ++i)
+            if (results[i] != i * i)
+                return false;
+    }
+
+    return true;
+}
+
+/**
+ * @test Test that MaRC::thread_pool reports the exception thrown by
+ *       the lowest indexed task.
+ */
+bool test_error(std::size_t threads)
+{
+    MaRC::thread_pool pool(threads);
+
+    constexpr std::size_t count = 50;
+
+    try {
+        pool.run(count,
+                 [](std::size_t i)
+                 {
+                     if (i % 10 == 7)
+                         throw std::runtime_error(std::to_string(i));
+                 });
+    } catch (std::runtime_error const & e) {
+        return std::string(e.what()) == "7";
+    }
+
+    return false;
+}
+
+/**
+ * @test Test that batches run concurrently from two threads make
+ *       progress together, rather than one batch waiting for the
+ *       other to complete.
+ */
+bool test_concurrent_run()
+{
+    // Fewer worker threads than tasks in both batches.
+    MaRC::thread_pool pool(2);
+
+    constexpr std::size_t count = 4;
+
+    std::atomic<bool> started[2] = { false, false };
+    std::atomic<bool> timed_out(false);
+
+    // Each task waits for the other batch to start.
+    auto const batch =
+        [&](std::size_t self)
+        {
+            pool.run(count,
+                     [&, self](std::size_t)
+                     {
+                         started[self] = true;
+
+                         auto const deadline =
+                             std::chrono::steady_clock::now()
+                             + std::chrono::seconds(10);
+
+                         while (!started[1 - self]) {
+                             if (std::chrono::steady_clock::now()
+                                 > deadline) {
+                                 timed_out = true;
+                                 return;
+                             }
+
+                             std::this_thread::yield();
+                         }
+                     });
+        };
+
+    std::thread first(batch, 0);
+    std::thread second(batch, 1);
+
+    first.join();
+    second.join();
+
+    return !timed_out;
+}
+
+/**
+ * @test Test that tasks may run batches in the same pool.
+ */
+bool test_nested_run()
+{
+    MaRC::thread_pool pool(2);
+
+    constexpr std::size_t count = 8;
+
+    std::vector<std::size_t> results(count * count, 0);
+
+    pool.run(count,
+             [&](std::size_t i)
+             {
+                 pool.run(count,
+                          [&, i](std::size_t j)
+                          {
+                              results[i * count + j] = i + j;
+                          });
+             });
+
+    for (std::size_t i = 0; i < count; ++i)
+        for (std::size_t j = 0; j < count; ++j)
+            if (results[i * count + j] != i + j)
+                return false;
+
+    return true;
+}
+
+/// The canonical main entry point.
+int main()
+{
+    constexpr std::size_t single_thread = 1;
+    constexpr std::size_t many_threads  = 4;
+
+    return
+        test_run(single_thread)
+        && test_run(many_threads)
+        && test_error(single_thread)
+        && test_error(many_threads)
+        && test_concurrent_run()
+        && test_nested_run()
+        ? 0 : -1;
+}
@@ -0,0 +1,225 @@
+/**
+ * @file vector_batch_test.cpp
+ *
+ * Copyright (C) 2026 Ossama Othman
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include <marc/vector_batch.h>
+#include <marc/OblateSpheroid.h>
+#include <marc/Geometry.h>
+#include <marc/Constants.h>
+
+#include <vector>
+#include <stdexcept>
+#include <cmath>
+
+
+namespace
+{
+    // Jupiter
+    constexpr bool   prograde = true;
+    constexpr double eq_rad   = 71492;
+    constexpr double pol_rad  = 66854;
+
+    // Relative tolerance of batch results compared to the
+    // corresponding single vector results.
+    constexpr double tolerance = 1e-14;
+
+    bool close(double expected, double actual)
+    {
+        return std::abs(actual - expected)
+            <= tolerance * std::max(std::abs(expected), 1.);
+    }
+
+    bool close(MaRC::DVector const & expected,
+               MaRC::DVector const & actual)
+    {
+        for (std::size_t i = 0; i < 3; ++i)
+            if (!close(expected[i], actual[i]))
+                return false;
+
+        return true;
+    }
+
+    /// Batch of vectors with a variety of magnitudes and signs.
+    MaRC::vector_batch make_batch(std::size_t n)
+    {
+        MaRC::vector_batch v(n);
+
+        for (std::size_t i = 0; i < n; ++i) {
+            double const t = static_cast<double>(i);
+
+            v.set(i, MaRC::DVector(std::sin(t) * 1000,
+                                   std::cos(t * 3) * 10 - 3,
+                                   t / 7 - 2));
+        }
+
+        return v;
+    }
+
+    /// Rotation matrix similar to those used for viewing geometry.
+    MaRC::DMatrix rotation()
+    {
+        return
+            MaRC::Geometry::RotYMatrix(27.175 * C::degree)
+            * MaRC::Geometry::RotXMatrix(-15.63 * C::degree)
+            * MaRC::Geometry::RotZMatrix(-144.37 * C::degree);
+    }
+}
+
+/**
+ * @test Test that batch matrix-vector multiplication matches
+ *       multiplying one vector at a time.
+ */
+bool test_multiply()
+{
+    // Odd size to exercise any vectorized loop remainder.
+    constexpr std::size_t n = 37;
+
+    auto const v = make_batch(n);
+    auto const A = rotation();
+    MaRC::DVector const origin(3, -700, 1e4);
+
+    MaRC::vector_batch r;
+    MaRC::multiply(A, v, r);
+
+    MaRC::vector_batch s;
+    MaRC::multiply(A, v, origin, s);
+
+    // Multiply in place.
+    auto t = v;
+    MaRC::multiply(A, t, origin, t);
+
+    if (r.size() != n || s.size() != n || t.size() != n)
+        return false;
+
+    for (std::size_t i = 0; i < n; ++i) {
+        auto const relative = A * (v[i] - origin);
+
+        if (!close(A * v[i], r[i])
+            || !close(relative, s[i])
+            || !close(relative, t[i]))
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ * @test Test batch conversion of spherical coordinates to Cartesian
+ *       coordinates.
+ */
+bool test_spherical_to_cartesian()
+{
+    MaRC::OblateSpheroid const body(prograde, eq_rad, pol_rad);
+
+    std::vector<double> lat;
+    std::vector<double> lon;
+
+    for (double n = -90; n <= 90; n += 7.5) {
+        lat.push_back(n * C::degree);
+        lon.push_back(n * 4 * C::degree);
+    }
+
+    std::vector<double> radius;
+    body.centric_radius(lat, radius);
+
+    MaRC::vector_batch r;
+    MaRC::spherical_to_cartesian(lat, lon, radius, r);
+
+    if (radius.size() != lat.size() || r.size() != lat.size())
+        return false;
+
+    for (std::size_t i = 0; i < lat.size(); ++i) {
+        double const rho = body.centric_radius(lat[i]);
+
+        MaRC::DVector const expected(
+             rho * std::cos(lat[i]) * std::sin(lon[i]),
+            -rho * std::cos(lat[i]) * std::cos(lon[i]),
+             rho * std::sin(lat[i]));
+
+        if (!close(rho, radius[i]) || !close(expected, r[i]))
+            return false;
+    }
+
+    // Arrays of different sizes.
+    lon.pop_back();
+
+    try {
+        MaRC::spherical_to_cartesian(lat, lon, radius, r);
+    } catch (std::invalid_argument const &) {
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @test Test that the batch ellipse intersection matches
+ *       intersecting one line at a time, including lines that miss
+ *       the body.
+ */
+bool test_ellipse_intersection()
+{
+    MaRC::OblateSpheroid const body(prograde, eq_rad, pol_rad);
+
+    // Observer position in body coordinates.
+    MaRC::DVector const observer(-3e5, -1.1e6, 2e5);
+
+    // Lines of sight sweeping across the body and beyond its limb.
+    constexpr std::size_t n = 101;
+
+    MaRC::vector_batch dvec(n);
+
+    for (std::size_t i = 0; i < n; ++i) {
+        double const t = (static_cast<double>(i) / (n - 1) - 0.5) * 3;
+
+        MaRC::DVector const target(t * eq_rad, 0, -t * pol_rad / 2);
+
+        dvec.set(i, target - observer);
+    }
+
+    std::vector<double> lat;
+    std::vector<double> lon;
+    body.ellipse_intersection(observer, dvec, lat, lon);
+
+    if (lat.size() != n || lon.size() != n)
+        return false;
+
+    std::size_t hits = 0;
+
+    for (std::size_t i = 0; i < n; ++i) {
+        double expected_lat = 0;
+        double expected_lon = 0;
+
+        bool const hit =
+            body.ellipse_intersection(observer,
+                                      dvec[i],
+                                      expected_lat,
+                                      expected_lon) == 0;
+
+        if (hit != !std::isnan(lat[i])
+            || hit != !std::isnan(lon[i])
+            || (hit && (!close(expected_lat, lat[i])
+                        || !close(expected_lon, lon[i]))))
+            return false;
+
+        if (hit)
+            ++hits;
+    }
+
+    // Some lines should hit the body, and some should miss it.
+    return hits > 0 && hits < n;
+}
+
+/// The canonical main entry point.
+int main()
+{
+    return
+        test_multiply()
+        && test_spherical_to_cartesian()
+        && test_ellipse_intersection()
+        ? 0 : -1;
+}